@@ -67,6 +67,7 @@ namespace JsRTApiTest
         WithSetup(JsRuntimeAttributeEnableIdleProcessing, handler);
         WithSetup(JsRuntimeAttributeDisableNativeCodeGeneration, handler);
         WithSetup(JsRuntimeAttributeDisableEval, handler);
+        WithSetup(JsRuntimeAttributeEnableLargeCollectionBudget, handler);
         WithSetup((JsRuntimeAttributes)(JsRuntimeAttributeDisableBackgroundWork | JsRuntimeAttributeAllowScriptInterrupt | JsRuntimeAttributeEnableIdleProcessing), handler);
     }
 
@@ -1148,6 +1149,285 @@ namespace JsRTApiTest
         JsRTApiTest::RunWithAttributes(JsRTApiTest::ContextCleanupTest);
     }
 
+    void CHAKRA_CALLBACK CollectionCallback(void *callbackState, const JsCollectionInfo *collectionInfo)
+    {
+        JsCollectionInfo *lastCollection = (JsCollectionInfo *)callbackState;
+        *lastCollection = *collectionInfo;
+    }
+
+    struct InCollectionHeapStatistics
+    {
+        JsRuntimeHandle runtime;
+        int callCount;
+        int inUseCount;
+    };
+
+    void CHAKRA_CALLBACK HeapStatisticsBeforeCollectCallback(JsRef ref, void *callbackState)
+    {
+        InCollectionHeapStatistics *state = (InCollectionHeapStatistics *)callbackState;
+        JsRuntimeHeapStatistics statistics;
+        unsigned int bucketCount = 0;
+        state->callCount++;
+        if (JsGetRuntimeHeapStatistics(state->runtime, &statistics) == JsErrorRuntimeInUse &&
+            JsGetRuntimeHeapBucketStatistics(state->runtime, nullptr, 0, &bucketCount) == JsErrorRuntimeInUse)
+        {
+            state->inUseCount++;
+        }
+    }
+
+    void HeapStatisticsTest(JsRuntimeAttributes attributes, JsRuntimeHandle runtime)
+    {
+        JsCollectionInfo lastCollection;
+        memset(&lastCollection, 0, sizeof(lastCollection));
+        lastCollection.reason = JsCollectionReasonOther;
+
+        REQUIRE(JsSetRuntimeCollectionCallback(runtime, &lastCollection, CollectionCallback) == JsNoError);
+
+        JsValueRef result = JS_INVALID_REFERENCE;
+        REQUIRE(JsRunScript(_u("var a = []; for (var i = 0; i < 10000; i++) { a.push({ i: i }); } a = null;"), JS_SOURCE_CONTEXT_NONE, _u(""), &result) == JsNoError);
+        REQUIRE(JsCollectGarbage(runtime) == JsNoError);
+
+        CHECK(lastCollection.reason == JsCollectionReasonExplicit);
+        CHECK(lastCollection.bytesBefore != 0);
+        CHECK(lastCollection.elapsedTime >= lastCollection.markTime);
+        CHECK(lastCollection.elapsedTime >= lastCollection.pauseTime);
+
+        JsRuntimeHeapStatistics statistics;
+        REQUIRE(JsGetRuntimeHeapStatistics(runtime, &statistics) == JsNoError);
+        CHECK(statistics.collectionCount >= 1);
+        CHECK(statistics.recyclerUsedBytes != 0);
+        CHECK(statistics.recyclerCommittedBytes >= statistics.recyclerUsedBytes);
+        CHECK(statistics.recyclerReservedBytes >= statistics.recyclerCommittedBytes);
+        CHECK(statistics.totalCollectionTime >= statistics.maxCollectionTime);
+
+        unsigned int bucketCount = 0;
+        REQUIRE(JsGetRuntimeHeapBucketStatistics(runtime, nullptr, 0, &bucketCount) == JsNoError);
+        REQUIRE(bucketCount != 0);
+
+        JsHeapBucketStatistics *buckets = new JsHeapBucketStatistics[bucketCount];
+        unsigned int actualBucketCount = 0;
+        REQUIRE(JsGetRuntimeHeapBucketStatistics(runtime, buckets, bucketCount, &actualBucketCount) == JsNoError);
+        CHECK(actualBucketCount == bucketCount);
+
+        size_t allocatedObjectCount = 0;
+        for (unsigned int i = 0; i < actualBucketCount; i++)
+        {
+            CHECK(buckets[i].objectSize != 0);
+            CHECK((i == 0 || buckets[i].objectSize > buckets[i - 1].objectSize));
+            allocatedObjectCount += buckets[i].allocatedObjectCount;
+        }
+        CHECK(allocatedObjectCount != 0);
+        delete[] buckets;
+
+        // The counters can't be read in the middle of a collection
+        InCollectionHeapStatistics inCollection = { runtime, 0, 0 };
+        for (int i = 0; i < 100; i++)
+        {
+            JsValueRef object = JS_INVALID_REFERENCE;
+            REQUIRE(JsCreateObject(&object) == JsNoError);
+            REQUIRE(JsSetObjectBeforeCollectCallback(object, &inCollection, HeapStatisticsBeforeCollectCallback) == JsNoError);
+        }
+        REQUIRE(JsCollectGarbage(runtime) == JsNoError);
+        CHECK(inCollection.callCount != 0);
+        CHECK(inCollection.inUseCount == inCollection.callCount);
+
+        REQUIRE(JsSetRuntimeCollectionCallback(runtime, nullptr, nullptr) == JsNoError);
+    }
+
+    TEST_CASE("ApiTest_HeapStatisticsTest", "[ApiTest]")
+    {
+        JsRTApiTest::RunWithAttributes(JsRTApiTest::HeapStatisticsTest);
+    }
+
+    bool CHAKRA_CALLBACK HeapSnapshotWriteCallback(void *callbackState, const unsigned char *bytes, size_t byteCount)
+    {
+        std::vector<unsigned char> *snapshot = (std::vector<unsigned char> *)callbackState;
+        snapshot->insert(snapshot->end(), bytes, bytes + byteCount);
+        return true;
+    }
+
+    bool CHAKRA_CALLBACK HeapSnapshotCancelCallback(void *callbackState, const unsigned char *bytes, size_t byteCount)
+    {
+        (*(int *)callbackState)++;
+        return false;
+    }
+
+    void HeapSnapshotTest(JsRuntimeAttributes attributes, JsRuntimeHandle runtime)
+    {
+        JsValueRef result = JS_INVALID_REFERENCE;
+        REQUIRE(JsRunScript(_u("var leakyHolder = { leakyProperty: [ { a: 1 }, function f() {} ] }; var m = new Map([[1, {}]]);"), JS_SOURCE_CONTEXT_NONE, _u(""), &result) == JsNoError);
+
+        // Objects whose internal properties hold engine data rather than Vars: a prototype used with new
+        // (its cached type), a thrown error (its stack trace) and a WeakMap key (its weak map data).
+        REQUIRE(JsRunScript(_u("function F() { this.x = 1; } var instance = new F(); var thrown; try { throw new Error('e'); } catch (e) { thrown = e; } ")
+            _u("var weakMapKey = {}; var weakMap = new WeakMap(); weakMap.set(weakMapKey, instance);"), JS_SOURCE_CONTEXT_NONE, _u(""), &result) == JsNoError);
+
+        // A property name longer than the names used to be cut to
+        REQUIRE(JsRunScript(_u("var longNameHolder = {}; longNameHolder['n'.repeat(300)] = 1;"), JS_SOURCE_CONTEXT_NONE, _u(""), &result) == JsNoError);
+
+        std::vector<unsigned char> snapshot;
+        REQUIRE(JsTakeHeapSnapshot(runtime, HeapSnapshotWriteCallback, &snapshot) == JsNoError);
+
+        // Header, then the End record with its node and edge counts.
+        REQUIRE(snapshot.size() > 8 + 17);
+        CHECK(memcmp(snapshot.data(), "CHHS", 4) == 0);
+        size_t end = snapshot.size() - 17;
+        CHECK(snapshot[end] == JsHeapSnapshotRecordEnd);
+        uint64_t nodeCount;
+        memcpy(&nodeCount, &snapshot[end + 1], sizeof(nodeCount));
+        CHECK(nodeCount != 0);
+
+        // Property names are written as UTF-16 string records.
+        const char16 propertyName[] = _u("leakyProperty");
+        const unsigned char *nameBytes = (const unsigned char *)propertyName;
+        size_t nameByteCount = sizeof(propertyName) - sizeof(char16);
+        CHECK(std::search(snapshot.begin(), snapshot.end(), nameBytes, nameBytes + nameByteCount) != snapshot.end());
+
+        const char16 weakMapKeyName[] = _u("weakMapKey");
+        nameBytes = (const unsigned char *)weakMapKeyName;
+        nameByteCount = sizeof(weakMapKeyName) - sizeof(char16);
+        CHECK(std::search(snapshot.begin(), snapshot.end(), nameBytes, nameBytes + nameByteCount) != snapshot.end());
+
+        // Names are written whole: the length and all 300 characters.
+        std::vector<char16> longName(300, _u('n'));
+        nameBytes = (const unsigned char *)longName.data();
+        nameByteCount = longName.size() * sizeof(char16);
+        auto longNameRecord = std::search(snapshot.begin(), snapshot.end(), nameBytes, nameBytes + nameByteCount);
+        REQUIRE(longNameRecord != snapshot.end());
+        uint32_t longNameLength;
+        memcpy(&longNameLength, &*(longNameRecord - sizeof(longNameLength)), sizeof(longNameLength));
+        CHECK(longNameLength == 300);
+
+        // A callback that returns false stops the snapshot without failing the call.
+        int callCount = 0;
+        CHECK(JsTakeHeapSnapshot(runtime, HeapSnapshotCancelCallback, &callCount) == JsNoError);
+        CHECK(callCount == 1);
+    }
+
+    TEST_CASE("ApiTest_HeapSnapshotTest", "[ApiTest]")
+    {
+        JsRTApiTest::RunWithAttributes(JsRTApiTest::HeapSnapshotTest);
+    }
+
+    void ParseJsonUtf8Test(JsRuntimeAttributes attributes, JsRuntimeHandle runtime)
+    {
+        // The length excludes the trailing text, so the buffer is not null terminated where parsing stops
+        const char json[] = "{\"a\":[1,2.5,-3e2,12345678901234567890,\"x\\u0041\",true,null],\"caf\xc3\xa9\":\"\xe2\x82\xac\xf0\x9f\x98\x80\"}trailing";
+        JsValueRef value = JS_INVALID_REFERENCE;
+        REQUIRE(JsParseJsonUtf8(json, strlen(json) - strlen("trailing"), &value) == JsNoError);
+
+        JsValueRef global = JS_INVALID_REFERENCE;
+        JsPropertyIdRef propertyId = JS_INVALID_REFERENCE;
+        REQUIRE(JsGetGlobalObject(&global) == JsNoError);
+        REQUIRE(JsGetPropertyIdFromName(_u("parsed"), &propertyId) == JsNoError);
+        REQUIRE(JsSetProperty(global, propertyId, value, true) == JsNoError);
+
+        JsValueRef result = JS_INVALID_REFERENCE;
+        bool equal = false;
+        REQUIRE(JsRunScript(_u("JSON.stringify(parsed) === JSON.stringify({ a: [1, 2.5, -300, 12345678901234567890, 'xA', true, null], 'caf\\u00e9': '\\u20ac\\ud83d\\ude00' })"),
+            JS_SOURCE_CONTEXT_NONE, _u(""), &result) == JsNoError);
+        REQUIRE(JsBooleanToBool(result, &equal) == JsNoError);
+        CHECK(equal);
+
+        // Invalid JSON throws a SyntaxError, as JSON.parse does
+        JsValueRef exception = JS_INVALID_REFERENCE;
+        CHECK(JsParseJsonUtf8("{\"a\":}", 6, &value) == JsErrorScriptException);
+        REQUIRE(JsGetAndClearException(&exception) == JsNoError);
+        CHECK(JsParseJsonUtf8("\"unterminated", 13, &value) == JsErrorScriptException);
+        REQUIRE(JsGetAndClearException(&exception) == JsNoError);
+    }
+
+    TEST_CASE("ApiTest_ParseJsonUtf8Test", "[ApiTest]")
+    {
+        JsRTApiTest::RunWithAttributes(JsRTApiTest::ParseJsonUtf8Test);
+    }
+
+    bool CHAKRA_CALLBACK StringifyJsonWriteCallback(void *callbackState, const char *chunk, size_t length)
+    {
+        std::vector<char> *text = (std::vector<char> *)callbackState;
+        text->insert(text->end(), chunk, chunk + length);
+        return true;
+    }
+
+    bool CHAKRA_CALLBACK StringifyJsonCancelCallback(void *callbackState, const char *chunk, size_t length)
+    {
+        (*(int *)callbackState)++;
+        return false;
+    }
+
+    void StringifyJsonUtf8Test(JsRuntimeAttributes attributes, JsRuntimeHandle runtime)
+    {
+        // Large enough to be flushed several times, with a toJSON member that needs the stringify session
+        JsValueRef value = JS_INVALID_REFERENCE;
+        REQUIRE(JsRunScript(_u("var rows = []; for (var i = 0; i < 5000; i++) { rows.push({ id: i, name: 'caf\\u00e9 \\ud83d\\ude00', tags: [1.5, null, true] }); } ")
+            _u("rows.push({ date: new Date(0), nested: { toJSON: function () { return 'x'; } } }); rows"),
+            JS_SOURCE_CONTEXT_NONE, _u(""), &value) == JsNoError);
+
+        JsValueRef space = JS_INVALID_REFERENCE;
+        REQUIRE(JsIntToNumber(2, &space) == JsNoError);
+
+        std::vector<char> text;
+        REQUIRE(JsStringifyJsonUtf8(value, space, StringifyJsonWriteCallback, &text) == JsNoError);
+
+        JsValueRef expected = JS_INVALID_REFERENCE;
+        char *expectedText = nullptr;
+        size_t expectedLength = 0;
+        REQUIRE(JsRunScript(_u("JSON.stringify(rows, null, 2)"), JS_SOURCE_CONTEXT_NONE, _u(""), &expected) == JsNoError);
+        REQUIRE(JsStringToPointerUtf8Copy(expected, &expectedText, &expectedLength) == JsNoError);
+        CHECK(text.size() == expectedLength);
+        CHECK(std::equal(text.begin(), text.end(), expectedText));
+        JsStringFree(expectedText);
+
+        // Objects and arrays the fast path can't write are streamed member by member; the text must still match
+        const char16 *generic[] = {
+            _u("var dictionary = {}; for (var i = 0; i < 2000; i++) { dictionary['k' + i] = { v: i }; delete dictionary['k' + (i >> 1)]; } var generic = dictionary; generic"),
+            _u("var indexed = { a: 1 }; for (var i = 0; i < 2000; i++) { indexed[i] = [i, 'x' + i]; } var generic = indexed; generic"),
+            _u("var generic = [{ d: (function () { var o = { a: 1, b: 2 }; delete o.a; o.c = [1, , 3]; return o; })(), p: new Proxy({ x: 1, y: [2] }, {}) }, Object.create({ hidden: 1 }, { shown: { value: 2, enumerable: true } })]; generic"),
+            _u("var generic = [new Number(1), new String('s'), new Boolean(false), function () { }, Symbol(), undefined, { toJSON: function () { return { t: [1, { u: 2 }] }; } }]; generic")
+        };
+        for (int i = 0; i < _countof(generic); i++)
+        {
+            REQUIRE(JsRunScript(generic[i], JS_SOURCE_CONTEXT_NONE, _u(""), &value) == JsNoError);
+
+            text.clear();
+            REQUIRE(JsStringifyJsonUtf8(value, space, StringifyJsonWriteCallback, &text) == JsNoError);
+            REQUIRE(JsRunScript(_u("JSON.stringify(generic, null, 2)"), JS_SOURCE_CONTEXT_NONE, _u(""), &expected) == JsNoError);
+            REQUIRE(JsStringToPointerUtf8Copy(expected, &expectedText, &expectedLength) == JsNoError);
+            CHECK(text.size() == expectedLength);
+            CHECK(std::equal(text.begin(), text.end(), expectedText));
+            JsStringFree(expectedText);
+        }
+
+        // A value without JSON text writes nothing
+        JsValueRef undefined = JS_INVALID_REFERENCE;
+        REQUIRE(JsGetUndefinedValue(&undefined) == JsNoError);
+        text.clear();
+        CHECK(JsStringifyJsonUtf8(undefined, JS_INVALID_REFERENCE, StringifyJsonWriteCallback, &text) == JsNoError);
+        CHECK(text.empty());
+
+        // Returning false from the callback stops the output
+        int callCount = 0;
+        CHECK(JsStringifyJsonUtf8(value, JS_INVALID_REFERENCE, StringifyJsonCancelCallback, &callCount) == JsNoError);
+        CHECK(callCount == 1);
+
+        // Cycles throw a TypeError, as JSON.stringify does
+        JsValueRef exception = JS_INVALID_REFERENCE;
+        REQUIRE(JsRunScript(_u("var cyclic = { a: [] }; cyclic.a.push(cyclic); cyclic"), JS_SOURCE_CONTEXT_NONE, _u(""), &value) == JsNoError);
+        text.clear();
+        CHECK(JsStringifyJsonUtf8(value, JS_INVALID_REFERENCE, StringifyJsonWriteCallback, &text) == JsErrorScriptException);
+        REQUIRE(JsGetAndClearException(&exception) == JsNoError);
+
+        REQUIRE(JsRunScript(_u("var cyclicIndexed = { 0: [] }; cyclicIndexed[0].push(new Proxy(cyclicIndexed, {})); cyclicIndexed"), JS_SOURCE_CONTEXT_NONE, _u(""), &value) == JsNoError);
+        text.clear();
+        CHECK(JsStringifyJsonUtf8(value, JS_INVALID_REFERENCE, StringifyJsonWriteCallback, &text) == JsErrorScriptException);
+        REQUIRE(JsGetAndClearException(&exception) == JsNoError);
+    }
+
+    TEST_CASE("ApiTest_StringifyJsonUtf8Test", "[ApiTest]")
+    {
+        JsRTApiTest::RunWithAttributes(JsRTApiTest::StringifyJsonUtf8Test);
+    }
+
     void ObjectMethodTest(JsRuntimeAttributes attributes, JsRuntimeHandle runtime)
     {
         JsValueRef proto = JS_INVALID_REFERENCE;
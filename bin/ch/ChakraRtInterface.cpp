@@ -77,6 +77,10 @@ bool ChakraRTInterface::LoadChakraDll(ArgInfo* argInfo, HINSTANCE *outLibrary)
     m_jsApiHooks.pfJsrtCreateRuntime = (JsAPIHooks::JsrtCreateRuntimePtr)GetChakraCoreSymbol(library, "JsCreateRuntime");
     m_jsApiHooks.pfJsrtCreateContext = (JsAPIHooks::JsrtCreateContextPtr)GetChakraCoreSymbol(library, "JsCreateContext");
     m_jsApiHooks.pfJsrtSetRuntimeMemoryLimit = (JsAPIHooks::JsrtSetRuntimeMemoryLimitPtr)GetChakraCoreSymbol(library, "JsSetRuntimeMemoryLimit");
+    m_jsApiHooks.pfJsrtGetRuntimeMemoryUsage = (JsAPIHooks::JsrtGetRuntimeMemoryUsagePtr)GetChakraCoreSymbol(library, "JsGetRuntimeMemoryUsage");
+    m_jsApiHooks.pfJsrtGetRuntimeHeapStatistics = (JsAPIHooks::JsrtGetRuntimeHeapStatisticsPtr)GetChakraCoreSymbol(library, "JsGetRuntimeHeapStatistics");
+    m_jsApiHooks.pfJsrtSetRuntimeMemoryAllocationCallback = (JsAPIHooks::JsrtSetRuntimeMemoryAllocationCallbackPtr)GetChakraCoreSymbol(library, "JsSetRuntimeMemoryAllocationCallback");
+    m_jsApiHooks.pfJsrtSetRuntimeCollectionCallback = (JsAPIHooks::JsrtSetRuntimeCollectionCallbackPtr)GetChakraCoreSymbol(library, "JsSetRuntimeCollectionCallback");
     m_jsApiHooks.pfJsrtSetCurrentContext = (JsAPIHooks::JsrtSetCurrentContextPtr)GetChakraCoreSymbol(library, "JsSetCurrentContext");
     m_jsApiHooks.pfJsrtGetCurrentContext = (JsAPIHooks::JsrtGetCurrentContextPtr)GetChakraCoreSymbol(library, "JsGetCurrentContext");
     m_jsApiHooks.pfJsrtDisposeRuntime = (JsAPIHooks::JsrtDisposeRuntimePtr)GetChakraCoreSymbol(library, "JsDisposeRuntime");
@@ -154,6 +158,8 @@ bool ChakraRTInterface::LoadChakraDll(ArgInfo* argInfo, HINSTANCE *outLibrary)
     m_jsApiHooks.pfJsrtTTDStartTimeTravelRecording = (JsAPIHooks::JsrtTTDStartTimeTravelRecordingPtr)GetChakraCoreSymbol(library, "JsTTDStartTimeTravelRecording");
     m_jsApiHooks.pfJsrtTTDStopTimeTravelRecording = (JsAPIHooks::JsrtTTDStopTimeTravelRecordingPtr)GetChakraCoreSymbol(library, "JsTTDStopTimeTravelRecording");
     m_jsApiHooks.pfJsrtTTDEmitTimeTravelRecording = (JsAPIHooks::JsrtTTDEmitTimeTravelRecordingPtr)GetChakraCoreSymbol(library, "JsTTDEmitTimeTravelRecording");
+    m_jsApiHooks.pfJsrtTTDEmitStartupSnapshot = (JsAPIHooks::JsrtTTDEmitStartupSnapshotPtr)GetChakraCoreSymbol(library, "JsTTDEmitStartupSnapshot");
+    m_jsApiHooks.pfJsrtTTDInflateStartupSnapshot = (JsAPIHooks::JsrtTTDInflateStartupSnapshotPtr)GetChakraCoreSymbol(library, "JsTTDInflateStartupSnapshot");
 
     m_jsApiHooks.pfJsrtTTDStartTimeTravelDebugging = (JsAPIHooks::JsrtTTDStartTimeTravelDebuggingPtr)GetChakraCoreSymbol(library, "JsTTDStartTimeTravelDebugging");
     m_jsApiHooks.pfJsrtTTDPauseTimeTravelBeforeRuntimeOperation = (JsAPIHooks::JsrtTTDPauseTimeTravelBeforeRuntimeOperationPtr)GetChakraCoreSymbol(library, "JsTTDPauseTimeTravelBeforeRuntimeOperation");
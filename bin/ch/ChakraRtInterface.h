@@ -9,6 +9,10 @@ struct JsAPIHooks
     typedef JsErrorCode (WINAPI *JsrtCreateRuntimePtr)(JsRuntimeAttributes attributes, JsThreadServiceCallback threadService, JsRuntimeHandle *runtime);
     typedef JsErrorCode (WINAPI *JsrtCreateContextPtr)(JsRuntimeHandle runtime, JsContextRef *newContext);
     typedef JsErrorCode (WINAPI *JsrtSetRuntimeMemoryLimitPtr)(JsRuntimeHandle runtime, size_t memoryLimit);
+    typedef JsErrorCode (WINAPI *JsrtGetRuntimeMemoryUsagePtr)(JsRuntimeHandle runtime, size_t *memoryUsage);
+    typedef JsErrorCode (WINAPI *JsrtGetRuntimeHeapStatisticsPtr)(JsRuntimeHandle runtime, JsRuntimeHeapStatistics *statistics);
+    typedef JsErrorCode (WINAPI *JsrtSetRuntimeMemoryAllocationCallbackPtr)(JsRuntimeHandle runtime, void *callbackState, JsMemoryAllocationCallback allocationCallback);
+    typedef JsErrorCode (WINAPI *JsrtSetRuntimeCollectionCallbackPtr)(JsRuntimeHandle runtime, void *callbackState, JsCollectionCallback collectionCallback);
     typedef JsErrorCode (WINAPI *JsrtSetCurrentContextPtr)(JsContextRef context);
     typedef JsErrorCode (WINAPI *JsrtGetCurrentContextPtr)(JsContextRef* context);
     typedef JsErrorCode (WINAPI *JsrtDisposeRuntimePtr)(JsRuntimeHandle runtime);
@@ -86,6 +90,8 @@ struct JsAPIHooks
     typedef JsErrorCode(WINAPI *JsrtTTDStartTimeTravelRecordingPtr)();
     typedef JsErrorCode(WINAPI *JsrtTTDStopTimeTravelRecordingPtr)();
     typedef JsErrorCode(WINAPI *JsrtTTDEmitTimeTravelRecordingPtr)();
+    typedef JsErrorCode(WINAPI *JsrtTTDEmitStartupSnapshotPtr)();
+    typedef JsErrorCode(WINAPI *JsrtTTDInflateStartupSnapshotPtr)();
     typedef JsErrorCode(WINAPI *JsrtTTDStartTimeTravelDebuggingPtr)();
     typedef JsErrorCode(WINAPI *JsrtTTDPauseTimeTravelBeforeRuntimeOperationPtr)();
     typedef JsErrorCode(WINAPI *JsrtTTDReStartTimeTravelAfterRuntimeOperationPtr)();
@@ -100,6 +106,10 @@ struct JsAPIHooks
     JsrtCreateRuntimePtr pfJsrtCreateRuntime;
     JsrtCreateContextPtr pfJsrtCreateContext;
     JsrtSetRuntimeMemoryLimitPtr pfJsrtSetRuntimeMemoryLimit;
+    JsrtGetRuntimeMemoryUsagePtr pfJsrtGetRuntimeMemoryUsage;
+    JsrtGetRuntimeHeapStatisticsPtr pfJsrtGetRuntimeHeapStatistics;
+    JsrtSetRuntimeMemoryAllocationCallbackPtr pfJsrtSetRuntimeMemoryAllocationCallback;
+    JsrtSetRuntimeCollectionCallbackPtr pfJsrtSetRuntimeCollectionCallback;
     JsrtSetCurrentContextPtr pfJsrtSetCurrentContext;
     JsrtGetCurrentContextPtr pfJsrtGetCurrentContext;
     JsrtDisposeRuntimePtr pfJsrtDisposeRuntime;
@@ -178,6 +188,8 @@ struct JsAPIHooks
     JsrtTTDStartTimeTravelRecordingPtr pfJsrtTTDStartTimeTravelRecording;
     JsrtTTDStopTimeTravelRecordingPtr pfJsrtTTDStopTimeTravelRecording;
     JsrtTTDEmitTimeTravelRecordingPtr pfJsrtTTDEmitTimeTravelRecording;
+    JsrtTTDEmitStartupSnapshotPtr pfJsrtTTDEmitStartupSnapshot;
+    JsrtTTDInflateStartupSnapshotPtr pfJsrtTTDInflateStartupSnapshot;
     JsrtTTDStartTimeTravelDebuggingPtr pfJsrtTTDStartTimeTravelDebugging;
     JsrtTTDPauseTimeTravelBeforeRuntimeOperationPtr pfJsrtTTDPauseTimeTravelBeforeRuntimeOperation;
     JsrtTTDReStartTimeTravelAfterRuntimeOperationPtr pfJsrtTTDReStartTimeTravelAfterRuntimeOperation;
@@ -270,6 +282,10 @@ public:
     static JsErrorCode WINAPI JsCreateRuntime(JsRuntimeAttributes attributes, JsThreadServiceCallback threadService, JsRuntimeHandle *runtime) { return HOOK_JS_API(CreateRuntime(attributes, threadService, runtime)); }
     static JsErrorCode WINAPI JsCreateContext(JsRuntimeHandle runtime, JsContextRef *newContext) { return HOOK_JS_API(CreateContext(runtime, newContext)); }
     static JsErrorCode WINAPI JsSetRuntimeMemoryLimit(JsRuntimeHandle runtime, size_t memory) { return HOOK_JS_API(SetRuntimeMemoryLimit(runtime, memory)); }
+    static JsErrorCode WINAPI JsGetRuntimeMemoryUsage(JsRuntimeHandle runtime, size_t *memoryUsage) { return HOOK_JS_API(GetRuntimeMemoryUsage(runtime, memoryUsage)); }
+    static JsErrorCode WINAPI JsGetRuntimeHeapStatistics(JsRuntimeHandle runtime, JsRuntimeHeapStatistics *statistics) { return HOOK_JS_API(GetRuntimeHeapStatistics(runtime, statistics)); }
+    static JsErrorCode WINAPI JsSetRuntimeMemoryAllocationCallback(JsRuntimeHandle runtime, void *callbackState, JsMemoryAllocationCallback allocationCallback) { return HOOK_JS_API(SetRuntimeMemoryAllocationCallback(runtime, callbackState, allocationCallback)); }
+    static JsErrorCode WINAPI JsSetRuntimeCollectionCallback(JsRuntimeHandle runtime, void *callbackState, JsCollectionCallback collectionCallback) { return HOOK_JS_API(SetRuntimeCollectionCallback(runtime, callbackState, collectionCallback)); }
     static JsErrorCode WINAPI JsSetCurrentContext(JsContextRef context) { return HOOK_JS_API(SetCurrentContext(context)); }
     static JsErrorCode WINAPI JsGetCurrentContext(JsContextRef* context) { return HOOK_JS_API(GetCurrentContext(context)); }
     static JsErrorCode WINAPI JsDisposeRuntime(JsRuntimeHandle runtime) { return HOOK_JS_API(DisposeRuntime(runtime)); }
@@ -359,6 +375,8 @@ public:
     static JsErrorCode WINAPI JsTTDStartTimeTravelRecording() { return HOOK_JS_API(TTDStartTimeTravelRecording()); }
     static JsErrorCode WINAPI JsTTDStopTimeTravelRecording() { return HOOK_JS_API(TTDStopTimeTravelRecording()); }
     static JsErrorCode WINAPI JsTTDEmitTimeTravelRecording() { return HOOK_JS_API(TTDEmitTimeTravelRecording()); }
+    static JsErrorCode WINAPI JsTTDEmitStartupSnapshot() { return HOOK_JS_API(TTDEmitStartupSnapshot()); }
+    static JsErrorCode WINAPI JsTTDInflateStartupSnapshot() { return HOOK_JS_API(TTDInflateStartupSnapshot()); }
     static JsErrorCode WINAPI JsTTDStartTimeTravelDebugging() { return HOOK_JS_API(TTDStartTimeTravelDebugging()); }
 
     static JsErrorCode WINAPI JsTTDPauseTimeTravelBeforeRuntimeOperation() { return HOOK_JS_API(TTDPauseTimeTravelBeforeRuntimeOperation()); }
@@ -8,6 +8,8 @@ FLAG(BSTR, dbgbaseline,                     "Baseline file to compare debugger o
 FLAG(bool, DebugLaunch,                     "Create the test debugger and execute test in the debug mode", false)
 FLAG(BSTR, GenerateLibraryByteCodeHeader,   "Generate bytecode header file from library code", NULL)
 FLAG(int,  InspectMaxStringLength,          "Max string length to dump in locals inspection", 16)
+FLAG(bool, PrintRuntimeStats,               "Print peak/final runtime memory, collection count and collection times after the script runs", false)
 FLAG(BSTR, Serialized,                      "If source is UTF8, deserializes from bytecode file", NULL)
+FLAG(bool, LargeCollectionBudget,           "Create the runtime with a larger allocation budget between collections", false)
 #undef FLAG
 #endif
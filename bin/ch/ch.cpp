@@ -18,6 +18,7 @@ JsRuntimeHandle chRuntime = JS_INVALID_RUNTIME_HANDLE;
 
 BOOL doTTRecord = false;
 BOOL doTTDebug = false;
+BOOL doTTStartupSnapshot = false;
 char* ttUri = nullptr;
 UINT32 snapInterval = MAXUINT32;
 UINT32 snapHistoryLength = MAXUINT32;
@@ -33,6 +34,85 @@ HRESULT __stdcall OnChakraCoreLoadedEntry(TestHooks& testHooks)
 
 JsRuntimeAttributes jsrtAttributes = JsRuntimeAttributeAllowScriptInterrupt;
 
+// Runtime statistics reported with -PrintRuntimeStats (parsed by test/runbenchmarks.py)
+struct RuntimeStats
+{
+    // The allocation callback can be called from the recycler's background threads
+    LONGLONG volatile currentBytes;
+    LONGLONG volatile peakBytes;
+    unsigned int collectionCount;
+    unsigned long long totalPauseTime;
+    unsigned long long maxPauseTime;
+};
+
+RuntimeStats runtimeStats = { 0, 0, 0, 0, 0 };
+
+bool CHAKRA_CALLBACK RuntimeStatsAllocationCallback(void *callbackState, JsMemoryEventType allocationEvent, size_t allocationSize)
+{
+    RuntimeStats* stats = (RuntimeStats*)callbackState;
+    if (allocationEvent == JsMemoryAllocate)
+    {
+        LONGLONG currentBytes = InterlockedExchangeAdd64(&stats->currentBytes, (LONGLONG)allocationSize) + (LONGLONG)allocationSize;
+        LONGLONG peakBytes = stats->peakBytes;
+        while (currentBytes > peakBytes)
+        {
+            LONGLONG oldPeakBytes = InterlockedCompareExchange64(&stats->peakBytes, currentBytes, peakBytes);
+            if (oldPeakBytes == peakBytes)
+            {
+                break;
+            }
+            peakBytes = oldPeakBytes;
+        }
+    }
+    else if (allocationEvent == JsMemoryFree)
+    {
+        InterlockedExchangeAdd64(&stats->currentBytes, -(LONGLONG)allocationSize);
+    }
+    return true;
+}
+
+void CHAKRA_CALLBACK RuntimeStatsCollectionCallback(void *callbackState, const JsCollectionInfo *collectionInfo)
+{
+    RuntimeStats* stats = (RuntimeStats*)callbackState;
+    stats->collectionCount++;
+    stats->totalPauseTime += collectionInfo->pauseTime;
+    if (collectionInfo->pauseTime > stats->maxPauseTime)
+    {
+        stats->maxPauseTime = collectionInfo->pauseTime;
+    }
+}
+
+void StartRuntimeStats(JsRuntimeHandle runtime)
+{
+    if (HostConfigFlags::flags.PrintRuntimeStats)
+    {
+        ChakraRTInterface::JsSetRuntimeMemoryAllocationCallback(runtime, &runtimeStats, &RuntimeStatsAllocationCallback);
+        ChakraRTInterface::JsSetRuntimeCollectionCallback(runtime, &runtimeStats, &RuntimeStatsCollectionCallback);
+    }
+}
+
+void PrintRuntimeStats(JsRuntimeHandle runtime)
+{
+    if (HostConfigFlags::flags.PrintRuntimeStats)
+    {
+        size_t finalBytes = 0;
+        ChakraRTInterface::JsGetRuntimeMemoryUsage(runtime, &finalBytes);
+
+        wprintf(_u("### PEAKMEMORY: %llu bytes\n"), (unsigned long long)runtimeStats.peakBytes);
+        wprintf(_u("### FINALMEMORY: %llu bytes\n"), (unsigned long long)finalBytes);
+        wprintf(_u("### GCCOUNT: %u\n"), runtimeStats.collectionCount);
+
+        JsRuntimeHeapStatistics heapStatistics;
+        if (ChakraRTInterface::JsGetRuntimeHeapStatistics(runtime, &heapStatistics) == JsNoError)
+        {
+            wprintf(_u("### GCTIME: %llu us\n"), heapStatistics.totalCollectionTime);
+            wprintf(_u("### GCMAXTIME: %llu us\n"), heapStatistics.maxCollectionTime);
+        }
+        wprintf(_u("### GCPAUSETIME: %llu us\n"), runtimeStats.totalPauseTime);
+        wprintf(_u("### GCMAXPAUSE: %llu us\n"), runtimeStats.maxPauseTime);
+    }
+}
+
 int HostExceptionFilter(int exceptionCode, _EXCEPTION_POINTERS *ep)
 {
     ChakraRTInterface::NotifyUnhandledException(ep);
@@ -337,7 +417,14 @@ Error:
 #if ENABLE_TTD
     if(doTTRecord)
     {
-        ChakraRTInterface::JsTTDStopTimeTravelRecording();
+        if(doTTStartupSnapshot)
+        {
+            ChakraRTInterface::JsTTDEmitStartupSnapshot();
+        }
+        else
+        {
+            ChakraRTInterface::JsTTDStopTimeTravelRecording();
+        }
     }
 #endif
 
@@ -471,6 +558,11 @@ HRESULT ExecuteTest(const char* fileName)
             jsrtAttributes = (JsRuntimeAttributes)(jsrtAttributes | JsRuntimeAttributeSerializeLibraryByteCode);
         }
 
+        if (HostConfigFlags::flags.LargeCollectionBudget)
+        {
+            jsrtAttributes = (JsRuntimeAttributes)(jsrtAttributes | JsRuntimeAttributeEnableLargeCollectionBudget);
+        }
+
 #if ENABLE_TTD
         if (doTTRecord)
         {
@@ -486,12 +578,39 @@ HRESULT ExecuteTest(const char* fileName)
             IfJsErrorFailLog(ChakraRTInterface::JsTTDCreateContext(runtime, &context));
             IfJsErrorFailLog(ChakraRTInterface::JsSetCurrentContext(context));
         }
+        else if (doTTDebug && doTTStartupSnapshot)
+        {
+            //Inflate the startup snapshot recorded with -TTStartupSnapshot into a fresh context and run the script in it
+            jsrtAttributes = static_cast<JsRuntimeAttributes>(jsrtAttributes | JsRuntimeAttributeEnableExperimentalFeatures);
+
+            IfJsErrorFailLog(ChakraRTInterface::JsTTDCreateDebugRuntime(jsrtAttributes, ttUri, (charcount_t) strlen(ttUri), nullptr, &runtime));
+            chRuntime = runtime;
+            StartRuntimeStats(runtime);
+
+            ChakraRTInterface::JsTTDSetIOCallbacks(runtime, &Helpers::GetTTDDirectory, &Helpers::TTInitializeForWriteLogStreamCallback, &Helpers::TTGetLogStreamCallback, &Helpers::TTGetSnapshotStreamCallback, &Helpers::TTGetSrcCodeStreamCallback, &Helpers::TTReadBytesFromStreamCallback, &Helpers::TTWriteBytesToStreamCallback, &Helpers::TTFlushAndCloseStreamCallback);
+
+            JsContextRef context = JS_INVALID_REFERENCE;
+            IfJsErrorFailLog(ChakraRTInterface::JsTTDCreateContext(runtime, &context));
+            IfJsErrorFailLog(ChakraRTInterface::JsSetCurrentContext(context));
+
+            LARGE_INTEGER inflateStart, inflateEnd, frequency;
+            QueryPerformanceFrequency(&frequency);
+            QueryPerformanceCounter(&inflateStart);
+            IfJsErrorFailLog(ChakraRTInterface::JsTTDInflateStartupSnapshot());
+            QueryPerformanceCounter(&inflateEnd);
+
+            if (HostConfigFlags::flags.PrintRuntimeStats)
+            {
+                wprintf(_u("### STARTUPINFLATETIME: %llu us\n"), (unsigned long long)((inflateEnd.QuadPart - inflateStart.QuadPart) * 1000000 / frequency.QuadPart));
+            }
+        }
         else
         {
             AssertMsg(!doTTDebug, "Should be handled in the else case above!!!");
 
             IfJsErrorFailLog(ChakraRTInterface::JsCreateRuntime(jsrtAttributes, nullptr, &runtime));
             chRuntime = runtime;
+            StartRuntimeStats(runtime);
 
             if (HostConfigFlags::flags.DebugLaunch)
             {
@@ -506,6 +625,7 @@ HRESULT ExecuteTest(const char* fileName)
 #else
         IfJsErrorFailLog(ChakraRTInterface::JsCreateRuntime(jsrtAttributes, nullptr, &runtime));
         chRuntime = runtime;
+        StartRuntimeStats(runtime);
 
         if (HostConfigFlags::flags.DebugLaunch)
         {
@@ -576,6 +696,7 @@ Error:
 
     if (runtime != JS_INVALID_RUNTIME_HANDLE)
     {
+        PrintRuntimeStats(runtime);
         ChakraRTInterface::JsDisposeRuntime(runtime);
     }
 
@@ -664,6 +785,10 @@ int _cdecl wmain(int argc, __in_ecount(argc) LPWSTR argv[])
             doTTDebug = true;
             ttUri = utf8::WideToNarrow(argv[i] + wcslen(_u("-TTDebug:"))).Detach();
         }
+        else if(wcscmp(argv[i], _u("-TTStartupSnapshot")) == 0)
+        {
+            doTTStartupSnapshot = true;
+        }
         else if(wcsstr(argv[i], _u("-TTSnapInterval:")) == argv[i])
         {
             LPCWSTR intervalStr = argv[i] + wcslen(_u("-TTSnapInterval:"));
@@ -94,6 +94,9 @@ namespace Js
         template<typename EncodedChar>
         static double StrToDbl(const EncodedChar *psz, const EncodedChar **ppchLim, bool& likelyInt);
 
+        // Correctly rounded luDigits * 10^lwExp10. Returns false in the rare cases that need big number arithmetic.
+        static bool TryDblFromDecimal(uint64 luDigits, int32 lwExp10, double *pdbl);
+
         static BOOL FDblToStr(double dbl, __out_ecount(nDstBufSize) char16 *psz, int nDstBufSize);
         static int FDblToStr(double dbl, NumberUtilities::FormatType ft, int nDigits, __out_ecount(cchDst) char16 *pchDst, int cchDst);
 
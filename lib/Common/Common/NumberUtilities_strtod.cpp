@@ -14,6 +14,7 @@ static const int32 klwMaxExp10 = 310;     // Upper bound on base 10 exponent
 static const int32 klwMinExp10 = -325;    // Lower bound on base 10 exponent
 static const int kcbMaxRgb = 50;
 static const int kcchMaxSig = 20;        // 20 significant digits. ECMA allows this.
+static const int kcchMaxUint64Dig = 19;  // Any 19 digits fit in a uint64.
 
 // Small powers of ten. These are all the powers of ten that have an exact
 // representation in IEEE double precision format.
@@ -888,6 +889,355 @@ LFail:
     return dbl;
 }
 
+/***************************************************************************
+Correctly rounded conversion of a decimal with up to 19 digits, using the
+Eisel-Lemire algorithm (Daniel Lemire, "Number Parsing at a Gigabyte per
+Second").
+
+The digits, as a normalized 64 bit integer, are multiplied by a 64 bit
+approximation of 5^exp10, and the top 54 bits of the 128 bit product give
+the rounded significand. The approximation is truncated, so the exact
+product is a little bigger than the computed one; if that could change
+the result, or if the value is exactly halfway between two doubles and
+the product is not exact, this fails and the caller falls back to the
+BIGNUM conversion. That is rare for real inputs.
+***************************************************************************/
+static const int32 klwMinExp10Pow5 = -342;
+static const int32 klwMaxExp10Pow5 = 308;
+
+// The high 64 bits of 5^q for q = klwMinExp10Pow5 .. klwMaxExp10Pow5,
+// normalized so that the high bit is set and truncated.
+static const uint64 g_rgluPow5[] =
+{
+    0xEEF453D6923BD65Aull, 0x9558B4661B6565F8ull, 0xBAAEE17FA23EBF76ull,
+    0xE95A99DF8ACE6F53ull, 0x91D8A02BB6C10594ull, 0xB64EC836A47146F9ull,
+    0xE3E27A444D8D98B7ull, 0x8E6D8C6AB0787F72ull, 0xB208EF855C969F4Full,
+    0xDE8B2B66B3BC4723ull, 0x8B16FB203055AC76ull, 0xADDCB9E83C6B1793ull,
+    0xD953E8624B85DD78ull, 0x87D4713D6F33AA6Bull, 0xA9C98D8CCB009506ull,
+    0xD43BF0EFFDC0BA48ull, 0x84A57695FE98746Dull, 0xA5CED43B7E3E9188ull,
+    0xCF42894A5DCE35EAull, 0x818995CE7AA0E1B2ull, 0xA1EBFB4219491A1Full,
+    0xCA66FA129F9B60A6ull, 0xFD00B897478238D0ull, 0x9E20735E8CB16382ull,
+    0xC5A890362FDDBC62ull, 0xF712B443BBD52B7Bull, 0x9A6BB0AA55653B2Dull,
+    0xC1069CD4EABE89F8ull, 0xF148440A256E2C76ull, 0x96CD2A865764DBCAull,
+    0xBC807527ED3E12BCull, 0xEBA09271E88D976Bull, 0x93445B8731587EA3ull,
+    0xB8157268FDAE9E4Cull, 0xE61ACF033D1A45DFull, 0x8FD0C16206306BABull,
+    0xB3C4F1BA87BC8696ull, 0xE0B62E2929ABA83Cull, 0x8C71DCD9BA0B4925ull,
+    0xAF8E5410288E1B6Full, 0xDB71E91432B1A24Aull, 0x892731AC9FAF056Eull,
+    0xAB70FE17C79AC6CAull, 0xD64D3D9DB981787Dull, 0x85F0468293F0EB4Eull,
+    0xA76C582338ED2621ull, 0xD1476E2C07286FAAull, 0x82CCA4DB847945CAull,
+    0xA37FCE126597973Cull, 0xCC5FC196FEFD7D0Cull, 0xFF77B1FCBEBCDC4Full,
+    0x9FAACF3DF73609B1ull, 0xC795830D75038C1Dull, 0xF97AE3D0D2446F25ull,
+    0x9BECCE62836AC577ull, 0xC2E801FB244576D5ull, 0xF3A20279ED56D48Aull,
+    0x9845418C345644D6ull, 0xBE5691EF416BD60Cull, 0xEDEC366B11C6CB8Full,
+    0x94B3A202EB1C3F39ull, 0xB9E08A83A5E34F07ull, 0xE858AD248F5C22C9ull,
+    0x91376C36D99995BEull, 0xB58547448FFFFB2Dull, 0xE2E69915B3FFF9F9ull,
+    0x8DD01FAD907FFC3Bull, 0xB1442798F49FFB4Aull, 0xDD95317F31C7FA1Dull,
+    0x8A7D3EEF7F1CFC52ull, 0xAD1C8EAB5EE43B66ull, 0xD863B256369D4A40ull,
+    0x873E4F75E2224E68ull, 0xA90DE3535AAAE202ull, 0xD3515C2831559A83ull,
+    0x8412D9991ED58091ull, 0xA5178FFF668AE0B6ull, 0xCE5D73FF402D98E3ull,
+    0x80FA687F881C7F8Eull, 0xA139029F6A239F72ull, 0xC987434744AC874Eull,
+    0xFBE9141915D7A922ull, 0x9D71AC8FADA6C9B5ull, 0xC4CE17B399107C22ull,
+    0xF6019DA07F549B2Bull, 0x99C102844F94E0FBull, 0xC0314325637A1939ull,
+    0xF03D93EEBC589F88ull, 0x96267C7535B763B5ull, 0xBBB01B9283253CA2ull,
+    0xEA9C227723EE8BCBull, 0x92A1958A7675175Full, 0xB749FAED14125D36ull,
+    0xE51C79A85916F484ull, 0x8F31CC0937AE58D2ull, 0xB2FE3F0B8599EF07ull,
+    0xDFBDCECE67006AC9ull, 0x8BD6A141006042BDull, 0xAECC49914078536Dull,
+    0xDA7F5BF590966848ull, 0x888F99797A5E012Dull, 0xAAB37FD7D8F58178ull,
+    0xD5605FCDCF32E1D6ull, 0x855C3BE0A17FCD26ull, 0xA6B34AD8C9DFC06Full,
+    0xD0601D8EFC57B08Bull, 0x823C12795DB6CE57ull, 0xA2CB1717B52481EDull,
+    0xCB7DDCDDA26DA268ull, 0xFE5D54150B090B02ull, 0x9EFA548D26E5A6E1ull,
+    0xC6B8E9B0709F109Aull, 0xF867241C8CC6D4C0ull, 0x9B407691D7FC44F8ull,
+    0xC21094364DFB5636ull, 0xF294B943E17A2BC4ull, 0x979CF3CA6CEC5B5Aull,
+    0xBD8430BD08277231ull, 0xECE53CEC4A314EBDull, 0x940F4613AE5ED136ull,
+    0xB913179899F68584ull, 0xE757DD7EC07426E5ull, 0x9096EA6F3848984Full,
+    0xB4BCA50B065ABE63ull, 0xE1EBCE4DC7F16DFBull, 0x8D3360F09CF6E4BDull,
+    0xB080392CC4349DECull, 0xDCA04777F541C567ull, 0x89E42CAAF9491B60ull,
+    0xAC5D37D5B79B6239ull, 0xD77485CB25823AC7ull, 0x86A8D39EF77164BCull,
+    0xA8530886B54DBDEBull, 0xD267CAA862A12D66ull, 0x8380DEA93DA4BC60ull,
+    0xA46116538D0DEB78ull, 0xCD795BE870516656ull, 0x806BD9714632DFF6ull,
+    0xA086CFCD97BF97F3ull, 0xC8A883C0FDAF7DF0ull, 0xFAD2A4B13D1B5D6Cull,
+    0x9CC3A6EEC6311A63ull, 0xC3F490AA77BD60FCull, 0xF4F1B4D515ACB93Bull,
+    0x991711052D8BF3C5ull, 0xBF5CD54678EEF0B6ull, 0xEF340A98172AACE4ull,
+    0x9580869F0E7AAC0Eull, 0xBAE0A846D2195712ull, 0xE998D258869FACD7ull,
+    0x91FF83775423CC06ull, 0xB67F6455292CBF08ull, 0xE41F3D6A7377EECAull,
+    0x8E938662882AF53Eull, 0xB23867FB2A35B28Dull, 0xDEC681F9F4C31F31ull,
+    0x8B3C113C38F9F37Eull, 0xAE0B158B4738705Eull, 0xD98DDAEE19068C76ull,
+    0x87F8A8D4CFA417C9ull, 0xA9F6D30A038D1DBCull, 0xD47487CC8470652Bull,
+    0x84C8D4DFD2C63F3Bull, 0xA5FB0A17C777CF09ull, 0xCF79CC9DB955C2CCull,
+    0x81AC1FE293D599BFull, 0xA21727DB38CB002Full, 0xCA9CF1D206FDC03Bull,
+    0xFD442E4688BD304Aull, 0x9E4A9CEC15763E2Eull, 0xC5DD44271AD3CDBAull,
+    0xF7549530E188C128ull, 0x9A94DD3E8CF578B9ull, 0xC13A148E3032D6E7ull,
+    0xF18899B1BC3F8CA1ull, 0x96F5600F15A7B7E5ull, 0xBCB2B812DB11A5DEull,
+    0xEBDF661791D60F56ull, 0x936B9FCEBB25C995ull, 0xB84687C269EF3BFBull,
+    0xE65829B3046B0AFAull, 0x8FF71A0FE2C2E6DCull, 0xB3F4E093DB73A093ull,
+    0xE0F218B8D25088B8ull, 0x8C974F7383725573ull, 0xAFBD2350644EEACFull,
+    0xDBAC6C247D62A583ull, 0x894BC396CE5DA772ull, 0xAB9EB47C81F5114Full,
+    0xD686619BA27255A2ull, 0x8613FD0145877585ull, 0xA798FC4196E952E7ull,
+    0xD17F3B51FCA3A7A0ull, 0x82EF85133DE648C4ull, 0xA3AB66580D5FDAF5ull,
+    0xCC963FEE10B7D1B3ull, 0xFFBBCFE994E5C61Full, 0x9FD561F1FD0F9BD3ull,
+    0xC7CABA6E7C5382C8ull, 0xF9BD690A1B68637Bull, 0x9C1661A651213E2Dull,
+    0xC31BFA0FE5698DB8ull, 0xF3E2F893DEC3F126ull, 0x986DDB5C6B3A76B7ull,
+    0xBE89523386091465ull, 0xEE2BA6C0678B597Full, 0x94DB483840B717EFull,
+    0xBA121A4650E4DDEBull, 0xE896A0D7E51E1566ull, 0x915E2486EF32CD60ull,
+    0xB5B5ADA8AAFF80B8ull, 0xE3231912D5BF60E6ull, 0x8DF5EFABC5979C8Full,
+    0xB1736B96B6FD83B3ull, 0xDDD0467C64BCE4A0ull, 0x8AA22C0DBEF60EE4ull,
+    0xAD4AB7112EB3929Dull, 0xD89D64D57A607744ull, 0x87625F056C7C4A8Bull,
+    0xA93AF6C6C79B5D2Dull, 0xD389B47879823479ull, 0x843610CB4BF160CBull,
+    0xA54394FE1EEDB8FEull, 0xCE947A3DA6A9273Eull, 0x811CCC668829B887ull,
+    0xA163FF802A3426A8ull, 0xC9BCFF6034C13052ull, 0xFC2C3F3841F17C67ull,
+    0x9D9BA7832936EDC0ull, 0xC5029163F384A931ull, 0xF64335BCF065D37Dull,
+    0x99EA0196163FA42Eull, 0xC06481FB9BCF8D39ull, 0xF07DA27A82C37088ull,
+    0x964E858C91BA2655ull, 0xBBE226EFB628AFEAull, 0xEADAB0ABA3B2DBE5ull,
+    0x92C8AE6B464FC96Full, 0xB77ADA0617E3BBCBull, 0xE55990879DDCAABDull,
+    0x8F57FA54C2A9EAB6ull, 0xB32DF8E9F3546564ull, 0xDFF9772470297EBDull,
+    0x8BFBEA76C619EF36ull, 0xAEFAE51477A06B03ull, 0xDAB99E59958885C4ull,
+    0x88B402F7FD75539Bull, 0xAAE103B5FCD2A881ull, 0xD59944A37C0752A2ull,
+    0x857FCAE62D8493A5ull, 0xA6DFBD9FB8E5B88Eull, 0xD097AD07A71F26B2ull,
+    0x825ECC24C873782Full, 0xA2F67F2DFA90563Bull, 0xCBB41EF979346BCAull,
+    0xFEA126B7D78186BCull, 0x9F24B832E6B0F436ull, 0xC6EDE63FA05D3143ull,
+    0xF8A95FCF88747D94ull, 0x9B69DBE1B548CE7Cull, 0xC24452DA229B021Bull,
+    0xF2D56790AB41C2A2ull, 0x97C560BA6B0919A5ull, 0xBDB6B8E905CB600Full,
+    0xED246723473E3813ull, 0x9436C0760C86E30Bull, 0xB94470938FA89BCEull,
+    0xE7958CB87392C2C2ull, 0x90BD77F3483BB9B9ull, 0xB4ECD5F01A4AA828ull,
+    0xE2280B6C20DD5232ull, 0x8D590723948A535Full, 0xB0AF48EC79ACE837ull,
+    0xDCDB1B2798182244ull, 0x8A08F0F8BF0F156Bull, 0xAC8B2D36EED2DAC5ull,
+    0xD7ADF884AA879177ull, 0x86CCBB52EA94BAEAull, 0xA87FEA27A539E9A5ull,
+    0xD29FE4B18E88640Eull, 0x83A3EEEEF9153E89ull, 0xA48CEAAAB75A8E2Bull,
+    0xCDB02555653131B6ull, 0x808E17555F3EBF11ull, 0xA0B19D2AB70E6ED6ull,
+    0xC8DE047564D20A8Bull, 0xFB158592BE068D2Eull, 0x9CED737BB6C4183Dull,
+    0xC428D05AA4751E4Cull, 0xF53304714D9265DFull, 0x993FE2C6D07B7FABull,
+    0xBF8FDB78849A5F96ull, 0xEF73D256A5C0F77Cull, 0x95A8637627989AADull,
+    0xBB127C53B17EC159ull, 0xE9D71B689DDE71AFull, 0x9226712162AB070Dull,
+    0xB6B00D69BB55C8D1ull, 0xE45C10C42A2B3B05ull, 0x8EB98A7A9A5B04E3ull,
+    0xB267ED1940F1C61Cull, 0xDF01E85F912E37A3ull, 0x8B61313BBABCE2C6ull,
+    0xAE397D8AA96C1B77ull, 0xD9C7DCED53C72255ull, 0x881CEA14545C7575ull,
+    0xAA242499697392D2ull, 0xD4AD2DBFC3D07787ull, 0x84EC3C97DA624AB4ull,
+    0xA6274BBDD0FADD61ull, 0xCFB11EAD453994BAull, 0x81CEB32C4B43FCF4ull,
+    0xA2425FF75E14FC31ull, 0xCAD2F7F5359A3B3Eull, 0xFD87B5F28300CA0Dull,
+    0x9E74D1B791E07E48ull, 0xC612062576589DDAull, 0xF79687AED3EEC551ull,
+    0x9ABE14CD44753B52ull, 0xC16D9A0095928A27ull, 0xF1C90080BAF72CB1ull,
+    0x971DA05074DA7BEEull, 0xBCE5086492111AEAull, 0xEC1E4A7DB69561A5ull,
+    0x9392EE8E921D5D07ull, 0xB877AA3236A4B449ull, 0xE69594BEC44DE15Bull,
+    0x901D7CF73AB0ACD9ull, 0xB424DC35095CD80Full, 0xE12E13424BB40E13ull,
+    0x8CBCCC096F5088CBull, 0xAFEBFF0BCB24AAFEull, 0xDBE6FECEBDEDD5BEull,
+    0x89705F4136B4A597ull, 0xABCC77118461CEFCull, 0xD6BF94D5E57A42BCull,
+    0x8637BD05AF6C69B5ull, 0xA7C5AC471B478423ull, 0xD1B71758E219652Bull,
+    0x83126E978D4FDF3Bull, 0xA3D70A3D70A3D70Aull, 0xCCCCCCCCCCCCCCCCull,
+    0x8000000000000000ull, 0xA000000000000000ull, 0xC800000000000000ull,
+    0xFA00000000000000ull, 0x9C40000000000000ull, 0xC350000000000000ull,
+    0xF424000000000000ull, 0x9896800000000000ull, 0xBEBC200000000000ull,
+    0xEE6B280000000000ull, 0x9502F90000000000ull, 0xBA43B74000000000ull,
+    0xE8D4A51000000000ull, 0x9184E72A00000000ull, 0xB5E620F480000000ull,
+    0xE35FA931A0000000ull, 0x8E1BC9BF04000000ull, 0xB1A2BC2EC5000000ull,
+    0xDE0B6B3A76400000ull, 0x8AC7230489E80000ull, 0xAD78EBC5AC620000ull,
+    0xD8D726B7177A8000ull, 0x878678326EAC9000ull, 0xA968163F0A57B400ull,
+    0xD3C21BCECCEDA100ull, 0x84595161401484A0ull, 0xA56FA5B99019A5C8ull,
+    0xCECB8F27F4200F3Aull, 0x813F3978F8940984ull, 0xA18F07D736B90BE5ull,
+    0xC9F2C9CD04674EDEull, 0xFC6F7C4045812296ull, 0x9DC5ADA82B70B59Dull,
+    0xC5371912364CE305ull, 0xF684DF56C3E01BC6ull, 0x9A130B963A6C115Cull,
+    0xC097CE7BC90715B3ull, 0xF0BDC21ABB48DB20ull, 0x96769950B50D88F4ull,
+    0xBC143FA4E250EB31ull, 0xEB194F8E1AE525FDull, 0x92EFD1B8D0CF37BEull,
+    0xB7ABC627050305ADull, 0xE596B7B0C643C719ull, 0x8F7E32CE7BEA5C6Full,
+    0xB35DBF821AE4F38Bull, 0xE0352F62A19E306Eull, 0x8C213D9DA502DE45ull,
+    0xAF298D050E4395D6ull, 0xDAF3F04651D47B4Cull, 0x88D8762BF324CD0Full,
+    0xAB0E93B6EFEE0053ull, 0xD5D238A4ABE98068ull, 0x85A36366EB71F041ull,
+    0xA70C3C40A64E6C51ull, 0xD0CF4B50CFE20765ull, 0x82818F1281ED449Full,
+    0xA321F2D7226895C7ull, 0xCBEA6F8CEB02BB39ull, 0xFEE50B7025C36A08ull,
+    0x9F4F2726179A2245ull, 0xC722F0EF9D80AAD6ull, 0xF8EBAD2B84E0D58Bull,
+    0x9B934C3B330C8577ull, 0xC2781F49FFCFA6D5ull, 0xF316271C7FC3908Aull,
+    0x97EDD871CFDA3A56ull, 0xBDE94E8E43D0C8ECull, 0xED63A231D4C4FB27ull,
+    0x945E455F24FB1CF8ull, 0xB975D6B6EE39E436ull, 0xE7D34C64A9C85D44ull,
+    0x90E40FBEEA1D3A4Aull, 0xB51D13AEA4A488DDull, 0xE264589A4DCDAB14ull,
+    0x8D7EB76070A08AECull, 0xB0DE65388CC8ADA8ull, 0xDD15FE86AFFAD912ull,
+    0x8A2DBF142DFCC7ABull, 0xACB92ED9397BF996ull, 0xD7E77A8F87DAF7FBull,
+    0x86F0AC99B4E8DAFDull, 0xA8ACD7C0222311BCull, 0xD2D80DB02AABD62Bull,
+    0x83C7088E1AAB65DBull, 0xA4B8CAB1A1563F52ull, 0xCDE6FD5E09ABCF26ull,
+    0x80B05E5AC60B6178ull, 0xA0DC75F1778E39D6ull, 0xC913936DD571C84Cull,
+    0xFB5878494ACE3A5Full, 0x9D174B2DCEC0E47Bull, 0xC45D1DF942711D9Aull,
+    0xF5746577930D6500ull, 0x9968BF6ABBE85F20ull, 0xBFC2EF456AE276E8ull,
+    0xEFB3AB16C59B14A2ull, 0x95D04AEE3B80ECE5ull, 0xBB445DA9CA61281Full,
+    0xEA1575143CF97226ull, 0x924D692CA61BE758ull, 0xB6E0C377CFA2E12Eull,
+    0xE498F455C38B997Aull, 0x8EDF98B59A373FECull, 0xB2977EE300C50FE7ull,
+    0xDF3D5E9BC0F653E1ull, 0x8B865B215899F46Cull, 0xAE67F1E9AEC07187ull,
+    0xDA01EE641A708DE9ull, 0x884134FE908658B2ull, 0xAA51823E34A7EEDEull,
+    0xD4E5E2CDC1D1EA96ull, 0x850FADC09923329Eull, 0xA6539930BF6BFF45ull,
+    0xCFE87F7CEF46FF16ull, 0x81F14FAE158C5F6Eull, 0xA26DA3999AEF7749ull,
+    0xCB090C8001AB551Cull, 0xFDCB4FA002162A63ull, 0x9E9F11C4014DDA7Eull,
+    0xC646D63501A1511Dull, 0xF7D88BC24209A565ull, 0x9AE757596946075Full,
+    0xC1A12D2FC3978937ull, 0xF209787BB47D6B84ull, 0x9745EB4D50CE6332ull,
+    0xBD176620A501FBFFull, 0xEC5D3FA8CE427AFFull, 0x93BA47C980E98CDFull,
+    0xB8A8D9BBE123F017ull, 0xE6D3102AD96CEC1Dull, 0x9043EA1AC7E41392ull,
+    0xB454E4A179DD1877ull, 0xE16A1DC9D8545E94ull, 0x8CE2529E2734BB1Dull,
+    0xB01AE745B101E9E4ull, 0xDC21A1171D42645Dull, 0x899504AE72497EBAull,
+    0xABFA45DA0EDBDE69ull, 0xD6F8D7509292D603ull, 0x865B86925B9BC5C2ull,
+    0xA7F26836F282B732ull, 0xD1EF0244AF2364FFull, 0x8335616AED761F1Full,
+    0xA402B9C5A8D3A6E7ull, 0xCD036837130890A1ull, 0x802221226BE55A64ull,
+    0xA02AA96B06DEB0FDull, 0xC83553C5C8965D3Dull, 0xFA42A8B73ABBF48Cull,
+    0x9C69A97284B578D7ull, 0xC38413CF25E2D70Dull, 0xF46518C2EF5B8CD1ull,
+    0x98BF2F79D5993802ull, 0xBEEEFB584AFF8603ull, 0xEEAABA2E5DBF6784ull,
+    0x952AB45CFA97A0B2ull, 0xBA756174393D88DFull, 0xE912B9D1478CEB17ull,
+    0x91ABB422CCB812EEull, 0xB616A12B7FE617AAull, 0xE39C49765FDF9D94ull,
+    0x8E41ADE9FBEBC27Dull, 0xB1D219647AE6B31Cull, 0xDE469FBD99A05FE3ull,
+    0x8AEC23D680043BEEull, 0xADA72CCC20054AE9ull, 0xD910F7FF28069DA4ull,
+    0x87AA9AFF79042286ull, 0xA99541BF57452B28ull, 0xD3FA922F2D1675F2ull,
+    0x847C9B5D7C2E09B7ull, 0xA59BC234DB398C25ull, 0xCF02B2C21207EF2Eull,
+    0x8161AFB94B44F57Dull, 0xA1BA1BA79E1632DCull, 0xCA28A291859BBF93ull,
+    0xFCB2CB35E702AF78ull, 0x9DEFBF01B061ADABull, 0xC56BAEC21C7A1916ull,
+    0xF6C69A72A3989F5Bull, 0x9A3C2087A63F6399ull, 0xC0CB28A98FCF3C7Full,
+    0xF0FDF2D3F3C30B9Full, 0x969EB7C47859E743ull, 0xBC4665B596706114ull,
+    0xEB57FF22FC0C7959ull, 0x9316FF75DD87CBD8ull, 0xB7DCBF5354E9BECEull,
+    0xE5D3EF282A242E81ull, 0x8FA475791A569D10ull, 0xB38D92D760EC4455ull,
+    0xE070F78D3927556Aull, 0x8C469AB843B89562ull, 0xAF58416654A6BABBull,
+    0xDB2E51BFE9D0696Aull, 0x88FCF317F22241E2ull, 0xAB3C2FDDEEAAD25Aull,
+    0xD60B3BD56A5586F1ull, 0x85C7056562757456ull, 0xA738C6BEBB12D16Cull,
+    0xD106F86E69D785C7ull, 0x82A45B450226B39Cull, 0xA34D721642B06084ull,
+    0xCC20CE9BD35C78A5ull, 0xFF290242C83396CEull, 0x9F79A169BD203E41ull,
+    0xC75809C42C684DD1ull, 0xF92E0C3537826145ull, 0x9BBCC7A142B17CCBull,
+    0xC2ABF989935DDBFEull, 0xF356F7EBF83552FEull, 0x98165AF37B2153DEull,
+    0xBE1BF1B059E9A8D6ull, 0xEDA2EE1C7064130Cull, 0x9485D4D1C63E8BE7ull,
+    0xB9A74A0637CE2EE1ull, 0xE8111C87C5C1BA99ull, 0x910AB1D4DB9914A0ull,
+    0xB54D5E4A127F59C8ull, 0xE2A0B5DC971F303Aull, 0x8DA471A9DE737E24ull,
+    0xB10D8E1456105DADull, 0xDD50F1996B947518ull, 0x8A5296FFE33CC92Full,
+    0xACE73CBFDC0BFB7Bull, 0xD8210BEFD30EFA5Aull, 0x8714A775E3E95C78ull,
+    0xA8D9D1535CE3B396ull, 0xD31045A8341CA07Cull, 0x83EA2B892091E44Dull,
+    0xA4E4B66B68B65D60ull, 0xCE1DE40642E3F4B9ull, 0x80D2AE83E9CE78F3ull,
+    0xA1075A24E4421730ull, 0xC94930AE1D529CFCull, 0xFB9B7CD9A4A7443Cull,
+    0x9D412E0806E88AA5ull, 0xC491798A08A2AD4Eull, 0xF5B5D7EC8ACB58A2ull,
+    0x9991A6F3D6BF1765ull, 0xBFF610B0CC6EDD3Full, 0xEFF394DCFF8A948Eull,
+    0x95F83D0A1FB69CD9ull, 0xBB764C4CA7A4440Full, 0xEA53DF5FD18D5513ull,
+    0x92746B9BE2F8552Cull, 0xB7118682DBB66A77ull, 0xE4D5E82392A40515ull,
+    0x8F05B1163BA6832Dull, 0xB2C71D5BCA9023F8ull, 0xDF78E4B2BD342CF6ull,
+    0x8BAB8EEFB6409C1Aull, 0xAE9672ABA3D0C320ull, 0xDA3C0F568CC4F3E8ull,
+    0x8865899617FB1871ull, 0xAA7EEBFB9DF9DE8Dull, 0xD51EA6FA85785631ull,
+    0x8533285C936B35DEull, 0xA67FF273B8460356ull, 0xD01FEF10A657842Cull,
+    0x8213F56A67F6B29Bull, 0xA298F2C501F45F42ull, 0xCB3F2F7642717713ull,
+    0xFE0EFB53D30DD4D7ull, 0x9EC95D1463E8A506ull, 0xC67BB4597CE2CE48ull,
+    0xF81AA16FDC1B81DAull, 0x9B10A4E5E9913128ull, 0xC1D4CE1F63F57D72ull,
+    0xF24A01A73CF2DCCFull, 0x976E41088617CA01ull, 0xBD49D14AA79DBC82ull,
+    0xEC9C459D51852BA2ull, 0x93E1AB8252F33B45ull, 0xB8DA1662E7B00A17ull,
+    0xE7109BFBA19C0C9Dull, 0x906A617D450187E2ull, 0xB484F9DC9641E9DAull,
+    0xE1A63853BBD26451ull, 0x8D07E33455637EB2ull, 0xB049DC016ABC5E5Full,
+    0xDC5C5301C56B75F7ull, 0x89B9B3E11B6329BAull, 0xAC2820D9623BF429ull,
+    0xD732290FBACAF133ull, 0x867F59A9D4BED6C0ull, 0xA81F301449EE8C70ull,
+    0xD226FC195C6A2F8Cull, 0x83585D8FD9C25DB7ull, 0xA42E74F3D032F525ull,
+    0xCD3A1230C43FB26Full, 0x80444B5E7AA7CF85ull, 0xA0555E361951C366ull,
+    0xC86AB5C39FA63440ull, 0xFA856334878FC150ull, 0x9C935E00D4B9D8D2ull,
+    0xC3B8358109E84F07ull, 0xF4A642E14C6262C8ull, 0x98E7E9CCCFBD7DBDull,
+    0xBF21E44003ACDD2Cull, 0xEEEA5D5004981478ull, 0x95527A5202DF0CCBull,
+    0xBAA718E68396CFFDull, 0xE950DF20247C83FDull, 0x91D28B7416CDD27Eull,
+    0xB6472E511C81471Dull, 0xE3D8F9E563A198E5ull, 0x8E679C2F5E44FF8Full
+};
+
+// The high 64 bits of the 128 bit product.
+static inline uint64 LuMul64(uint64 lu1, uint64 lu2, uint64 *pluLo)
+{
+    uint64 luHi1 = lu1 >> 32;
+    uint64 luLo1 = lu1 & 0xFFFFFFFF;
+    uint64 luHi2 = lu2 >> 32;
+    uint64 luLo2 = lu2 & 0xFFFFFFFF;
+    uint64 luLoLo = luLo1 * luLo2;
+    uint64 luHiLo = luHi1 * luLo2;
+    uint64 luLoHi = luLo1 * luHi2;
+    uint64 luMid = (luLoLo >> 32) + (luHiLo & 0xFFFFFFFF) + (luLoHi & 0xFFFFFFFF);
+
+    *pluLo = (luMid << 32) | (luLoLo & 0xFFFFFFFF);
+    return luHi1 * luHi2 + (luHiLo >> 32) + (luLoHi >> 32) + (luMid >> 32);
+}
+
+static inline double DblFromBits(uint64 lu)
+{
+    double dbl;
+    Js::NumberUtilities::LuHiDbl(dbl) = (uint32)(lu >> 32);
+    Js::NumberUtilities::LuLoDbl(dbl) = (uint32)lu;
+    return dbl;
+}
+
+bool Js::NumberUtilities::TryDblFromDecimal(uint64 luDigits, int32 lwExp10, double *pdbl)
+{
+    if (0 == luDigits)
+    {
+        *pdbl = 0;
+        return true;
+    }
+    if (lwExp10 < klwMinExp10Pow5)
+    {
+        // Less than 10^19 * 10^-343, which rounds to 0.
+        *pdbl = 0;
+        return true;
+    }
+    if (lwExp10 > klwMaxExp10Pow5)
+    {
+        // At least 10^309, which rounds to infinity.
+        *pdbl = DblFromBits(NumberConstants::k_PosInf);
+        return true;
+    }
+
+    int cbitShift = 0;
+    while (0 == (luDigits & 0x8000000000000000ull))
+    {
+        luDigits <<= 1;
+        cbitShift++;
+    }
+
+    uint64 luLo;
+    uint64 luHi = LuMul64(luDigits, g_rgluPow5[lwExp10 - klwMinExp10Pow5], &luLo);
+
+    // The product is exact if 5^lwExp10 fits in 64 bits. Otherwise the exact
+    // product is less than the computed one plus luDigits, so a carry from
+    // luLo can reach the significand only if the bits below it are all ones.
+    BOOL fExact = lwExp10 >= 0 && lwExp10 <= 27;
+    if (!fExact && 0x1FF == (luHi & 0x1FF))
+        return false;
+
+    int fUpperBit = (int)(luHi >> 63);
+    uint64 luSig = luHi >> (fUpperBit + 9);
+
+    // The biased exponent. The product of the value's exponent and log2(10)
+    // is computed as (217706 * q) >> 16, which is exact enough for |q| < 1500.
+    int32 lwExp2 = ((217706 * lwExp10) >> 16) + 63 + fUpperBit - cbitShift + 1023;
+
+    if (lwExp2 <= 0)
+    {
+        // Denormal or zero. The value can't be halfway between two denormals.
+        if (-lwExp2 + 1 >= 64)
+        {
+            *pdbl = 0;
+            return true;
+        }
+        luSig >>= -lwExp2 + 1;
+        luSig += luSig & 1;
+        luSig >>= 1;
+        lwExp2 = luSig < 0x0010000000000000ull ? 0 : 1;
+        *pdbl = DblFromBits(((uint64)lwExp2 << 52) | (luSig & 0x000FFFFFFFFFFFFFull));
+        return true;
+    }
+
+    // If an exact product is halfway between two doubles, round to even. An
+    // inexact one that looks halfway is really a little bigger and rounds up;
+    // an exact halfway value would have had all ones below the significand.
+    if (fExact && 1 == (luSig & 3) && 0 == luLo && luHi == luSig << (fUpperBit + 9))
+    {
+        luSig &= ~1ull;
+    }
+
+    // Round to nearest.
+    luSig += luSig & 1;
+    luSig >>= 1;
+    if (luSig >= 0x0020000000000000ull)
+    {
+        luSig = 0x0010000000000000ull;
+        lwExp2++;
+    }
+    if (lwExp2 >= 0x7FF)
+    {
+        *pdbl = DblFromBits(NumberConstants::k_PosInf);
+        return true;
+    }
+
+    *pdbl = DblFromBits(((uint64)lwExp2 << 52) | (luSig & 0x000FFFFFFFFFFFFFull));
+    return true;
+}
+
 
 /***************************************************************************
 String to Double.
@@ -904,6 +1254,8 @@ double Js::NumberUtilities::StrToDbl( const EncodedChar *psz, const EncodedChar
 #if DBG
     bool canUseLowPrec = false;
     double dblLowPrec;
+    bool canUseEiselLemire = false;
+    double dblEiselLemire = 0;
     Js::NumberUtilities::LuHiDbl(dblLowPrec) = 0x7FFFFFFF;
     Js::NumberUtilities::LuLoDbl(dblLowPrec) = 0xFFFFFFFF;
     Assert(Js::NumberUtilities::IsNan(dblLowPrec));
@@ -1189,6 +1541,34 @@ LEnd:
         goto LDone;
     }
 
+    // Try the Eisel-Lemire algorithm, which needs the digits as a uint64.
+    if (cchDig <= kcchMaxUint64Dig)
+    {
+        uint64 luDigits = 0;
+        for (pch = pchMinDig; pch < pchLimDig; pch++)
+        {
+            if (*pch != '.')
+            {
+                Assert(Js::NumberUtilities::IsDigit(*pch));
+                luDigits = luDigits * 10 + (*pch - '0');
+            }
+        }
+
+        double dblFast;
+        if (Js::NumberUtilities::TryDblFromDecimal(luDigits, lwExp - cchDig, &dblFast))
+        {
+#if DBG
+            // In the debug version, execute the big number code also and
+            // verify that the results are the same.
+            canUseEiselLemire = true;
+            dblEiselLemire = dblFast;
+#else //!DBG
+            dbl = dblFast;
+            goto LDone;
+#endif //!DBG
+        }
+    }
+
     // Convert to a big number.
     Assert(pchLimDig - pchMinDig >= 0 && pchLimDig - pchMinDig <= LONG_MAX);
     num.SetFromRgchExp(pchMinDig, (int32)(pchLimDig - pchMinDig), lwExp);
@@ -1244,6 +1624,7 @@ LDone:
     //    Assert(Js::NumberUtilities::IsNan(dblLowPrec) || dblLowPrec == dbl);
 
 #if DBG
+    Assert(!canUseEiselLemire || dbl == dblEiselLemire);
     if(canUseLowPrec)
     {
         // Use the same final behavior in debug builds as for non-debug builds by using the low-precision value
@@ -1859,6 +2240,349 @@ LFail:
     return FALSE;
 }
 
+/***************************************************************************
+Shortest round trip digits using Grisu3 (Florian Loitsch, "Printing
+Floating-Point Numbers Quickly and Accurately with Integers").
+
+A DIYFP is f * 2^e with a 64 bit significand. The value and its rounding
+boundaries are scaled by a cached power of ten so that the integral part
+fits in 32 bits, and the digits are then generated with integer arithmetic.
+The generated digits are the shortest that round trip and, of those, the
+closest to the value; these are the digits FDblToRgbPrecise produces. When
+the imprecision of the cached power makes the result uncertain, which
+happens for about 0.5% of all doubles, it fails and the caller falls back
+to the other conversions.
+***************************************************************************/
+struct DIYFP
+{
+    uint64 m_f;
+    int m_wExp;
+
+    DIYFP() : m_f(0), m_wExp(0) {}
+    DIYFP(uint64 f, int wExp) : m_f(f), m_wExp(wExp) {}
+
+    // Shift the significand left until its high bit is set.
+    void Normalize(void)
+    {
+        Assert(m_f != 0);
+        while (0 == (m_f & 0xFFC0000000000000ull))
+        {
+            m_f <<= 10;
+            m_wExp -= 10;
+        }
+        while (0 == (m_f & 0x8000000000000000ull))
+        {
+            m_f <<= 1;
+            m_wExp--;
+        }
+    }
+
+    // The product, rounded to 64 bits. The exponents need not match.
+    static DIYFP Mul(const DIYFP &a, const DIYFP &b)
+    {
+        uint64 luAHi = a.m_f >> 32;
+        uint64 luALo = a.m_f & 0xFFFFFFFF;
+        uint64 luBHi = b.m_f >> 32;
+        uint64 luBLo = b.m_f & 0xFFFFFFFF;
+        uint64 luHiHi = luAHi * luBHi;
+        uint64 luLoHi = luALo * luBHi;
+        uint64 luHiLo = luAHi * luBLo;
+        uint64 luLoLo = luALo * luBLo;
+        uint64 luMid = (luLoLo >> 32) + (luLoHi & 0xFFFFFFFF) + (luHiLo & 0xFFFFFFFF);
+
+        // Round the low 64 bits.
+        luMid += 1u << 31;
+        return DIYFP(luHiHi + (luLoHi >> 32) + (luHiLo >> 32) + (luMid >> 32), a.m_wExp + b.m_wExp + 64);
+    }
+};
+
+// 10^k for k = -348, -340, ..., 340, as normalized DIYFPs rounded to nearest.
+struct CACHEDPOWER
+{
+    uint64 m_f;
+    int16 m_wExp2;
+    int16 m_wExp10;
+};
+
+static const CACHEDPOWER g_rgpowCached[] =
+{
+    { 0xFA8FD5A0081C0288ull, -1220, -348 },
+    { 0xBAAEE17FA23EBF76ull, -1193, -340 },
+    { 0x8B16FB203055AC76ull, -1166, -332 },
+    { 0xCF42894A5DCE35EAull, -1140, -324 },
+    { 0x9A6BB0AA55653B2Dull, -1113, -316 },
+    { 0xE61ACF033D1A45DFull, -1087, -308 },
+    { 0xAB70FE17C79AC6CAull, -1060, -300 },
+    { 0xFF77B1FCBEBCDC4Full, -1034, -292 },
+    { 0xBE5691EF416BD60Cull, -1007, -284 },
+    { 0x8DD01FAD907FFC3Cull,  -980, -276 },
+    { 0xD3515C2831559A83ull,  -954, -268 },
+    { 0x9D71AC8FADA6C9B5ull,  -927, -260 },
+    { 0xEA9C227723EE8BCBull,  -901, -252 },
+    { 0xAECC49914078536Dull,  -874, -244 },
+    { 0x823C12795DB6CE57ull,  -847, -236 },
+    { 0xC21094364DFB5637ull,  -821, -228 },
+    { 0x9096EA6F3848984Full,  -794, -220 },
+    { 0xD77485CB25823AC7ull,  -768, -212 },
+    { 0xA086CFCD97BF97F4ull,  -741, -204 },
+    { 0xEF340A98172AACE5ull,  -715, -196 },
+    { 0xB23867FB2A35B28Eull,  -688, -188 },
+    { 0x84C8D4DFD2C63F3Bull,  -661, -180 },
+    { 0xC5DD44271AD3CDBAull,  -635, -172 },
+    { 0x936B9FCEBB25C996ull,  -608, -164 },
+    { 0xDBAC6C247D62A584ull,  -582, -156 },
+    { 0xA3AB66580D5FDAF6ull,  -555, -148 },
+    { 0xF3E2F893DEC3F126ull,  -529, -140 },
+    { 0xB5B5ADA8AAFF80B8ull,  -502, -132 },
+    { 0x87625F056C7C4A8Bull,  -475, -124 },
+    { 0xC9BCFF6034C13053ull,  -449, -116 },
+    { 0x964E858C91BA2655ull,  -422, -108 },
+    { 0xDFF9772470297EBDull,  -396, -100 },
+    { 0xA6DFBD9FB8E5B88Full,  -369,  -92 },
+    { 0xF8A95FCF88747D94ull,  -343,  -84 },
+    { 0xB94470938FA89BCFull,  -316,  -76 },
+    { 0x8A08F0F8BF0F156Bull,  -289,  -68 },
+    { 0xCDB02555653131B6ull,  -263,  -60 },
+    { 0x993FE2C6D07B7FACull,  -236,  -52 },
+    { 0xE45C10C42A2B3B06ull,  -210,  -44 },
+    { 0xAA242499697392D3ull,  -183,  -36 },
+    { 0xFD87B5F28300CA0Eull,  -157,  -28 },
+    { 0xBCE5086492111AEBull,  -130,  -20 },
+    { 0x8CBCCC096F5088CCull,  -103,  -12 },
+    { 0xD1B71758E219652Cull,   -77,   -4 },
+    { 0x9C40000000000000ull,   -50,    4 },
+    { 0xE8D4A51000000000ull,   -24,   12 },
+    { 0xAD78EBC5AC620000ull,     3,   20 },
+    { 0x813F3978F8940984ull,    30,   28 },
+    { 0xC097CE7BC90715B3ull,    56,   36 },
+    { 0x8F7E32CE7BEA5C70ull,    83,   44 },
+    { 0xD5D238A4ABE98068ull,   109,   52 },
+    { 0x9F4F2726179A2245ull,   136,   60 },
+    { 0xED63A231D4C4FB27ull,   162,   68 },
+    { 0xB0DE65388CC8ADA8ull,   189,   76 },
+    { 0x83C7088E1AAB65DBull,   216,   84 },
+    { 0xC45D1DF942711D9Aull,   242,   92 },
+    { 0x924D692CA61BE758ull,   269,  100 },
+    { 0xDA01EE641A708DEAull,   295,  108 },
+    { 0xA26DA3999AEF774Aull,   322,  116 },
+    { 0xF209787BB47D6B85ull,   348,  124 },
+    { 0xB454E4A179DD1877ull,   375,  132 },
+    { 0x865B86925B9BC5C2ull,   402,  140 },
+    { 0xC83553C5C8965D3Dull,   428,  148 },
+    { 0x952AB45CFA97A0B3ull,   455,  156 },
+    { 0xDE469FBD99A05FE3ull,   481,  164 },
+    { 0xA59BC234DB398C25ull,   508,  172 },
+    { 0xF6C69A72A3989F5Cull,   534,  180 },
+    { 0xB7DCBF5354E9BECEull,   561,  188 },
+    { 0x88FCF317F22241E2ull,   588,  196 },
+    { 0xCC20CE9BD35C78A5ull,   614,  204 },
+    { 0x98165AF37B2153DFull,   641,  212 },
+    { 0xE2A0B5DC971F303Aull,   667,  220 },
+    { 0xA8D9D1535CE3B396ull,   694,  228 },
+    { 0xFB9B7CD9A4A7443Cull,   720,  236 },
+    { 0xBB764C4CA7A44410ull,   747,  244 },
+    { 0x8BAB8EEFB6409C1Aull,   774,  252 },
+    { 0xD01FEF10A657842Cull,   800,  260 },
+    { 0x9B10A4E5E9913129ull,   827,  268 },
+    { 0xE7109BFBA19C0C9Dull,   853,  276 },
+    { 0xAC2820D9623BF429ull,   880,  284 },
+    { 0x80444B5E7AA7CF85ull,   907,  292 },
+    { 0xBF21E44003ACDD2Dull,   933,  300 },
+    { 0x8E679C2F5E44FF8Full,   960,  308 },
+    { 0xD433179D9C8CB841ull,   986,  316 },
+    { 0x9E19DB92B4E31BA9ull,  1013,  324 },
+    { 0xEB96BF6EBADF77D9ull,  1039,  332 },
+    { 0xAF87023B9BF0EE6Bull,  1066,  340 }
+};
+static const int kwCachedPowersMinExp10 = -348;
+static const int kwCachedPowersExp10Step = 8;
+
+// The scaled value's binary exponent is kept in this range, so that its
+// integral part fits in 32 bits and its digits can be generated with
+// 64 bit arithmetic.
+static const int kwGrisuMinExp2 = -60;
+static const int kwGrisuMaxExp2 = -32;
+
+static const uint32 g_rgluTens[] =
+{
+    0, 1, 10, 100, 1000, 10000, 100000, 1000000, 10000000, 100000000, 1000000000
+};
+
+// Get the cached power of ten that brings the exponent of a normalized DIYFP
+// with the given exponent into [kwGrisuMinExp2, kwGrisuMaxExp2].
+static const CACHEDPOWER *PowCachedForExp2(int wExp2)
+{
+    // 0.30103 is log10(2).
+    int wExp2Min = kwGrisuMinExp2 - (wExp2 + 64);
+    double dblK = ceil((wExp2Min + 63) * 0.30102999566398114);
+    int iT = ((int)dblK - kwCachedPowersMinExp10 - 1) / kwCachedPowersExp10Step + 1;
+    Assert(iT >= 0 && iT < (int)_countof(g_rgpowCached));
+    __analysis_assume(iT >= 0 && iT < (int)_countof(g_rgpowCached));
+    return &g_rgpowCached[iT];
+}
+
+// Move the last digit towards the value, within the interval, while that gets
+// it closer. Returns false if the interval's imprecision means that the result
+// may not be the closest or may not round trip.
+static BOOL FRoundWeed(byte *prgb, int cb, uint64 luDistHighW, uint64 luUnsafeInterval, uint64 luRest, uint64 luTenKappa, uint64 luUnit)
+{
+    uint64 luSmallDist = luDistHighW - luUnit;
+    uint64 luBigDist = luDistHighW + luUnit;
+
+    // Step down while that is guaranteed to get closer to the value, also
+    // when the value is assumed to be at its lowest bound (luSmallDist).
+    while (luRest < luSmallDist &&
+        luUnsafeInterval - luRest >= luTenKappa &&
+        (luRest + luTenKappa < luSmallDist || luSmallDist - luRest >= luRest + luTenKappa - luSmallDist))
+    {
+        prgb[cb - 1]--;
+        luRest += luTenKappa;
+    }
+
+    // If stepping down once more could get closer to the value at its
+    // highest bound (luBigDist), we can't tell which digit is the closest.
+    if (luRest < luBigDist &&
+        luUnsafeInterval - luRest >= luTenKappa &&
+        (luRest + luTenKappa < luBigDist || luBigDist - luRest > luRest + luTenKappa - luBigDist))
+    {
+        return FALSE;
+    }
+
+    // The result must be safely inside the interval.
+    return 2 * luUnit <= luRest && luRest <= luUnsafeInterval - 4 * luUnit;
+}
+
+// Generate the shortest digits of a number in (numLow, numHigh) that is the
+// closest to numW. The three share the same exponent, which is in the
+// range [kwGrisuMinExp2, kwGrisuMaxExp2]. The result is
+// 0.prgb[0]prgb[1]... * 10^*pwKappa, with *pwKappa relative to the scaling.
+static BOOL FGrisuDigitGen(DIYFP numLow, DIYFP numW, DIYFP numHigh, _Out_writes_to_(kcbMaxRgb, *pcb) byte *prgb, int *pcb, int *pwKappa)
+{
+    Assert(numLow.m_wExp == numW.m_wExp && numW.m_wExp == numHigh.m_wExp);
+    Assert(numLow.m_f + 1 <= numHigh.m_f - 1);
+    Assert(kwGrisuMinExp2 <= numW.m_wExp && numW.m_wExp <= kwGrisuMaxExp2);
+
+    // The boundaries are off by at most one unit in either direction, so
+    // generate the digits for the widest possible interval and check the
+    // result against the narrowest one.
+    uint64 luUnit = 1;
+    DIYFP numTooLow(numLow.m_f - luUnit, numLow.m_wExp);
+    DIYFP numTooHigh(numHigh.m_f + luUnit, numHigh.m_wExp);
+    uint64 luUnsafeInterval = numTooHigh.m_f - numTooLow.m_f;
+    int cShift = -numW.m_wExp;
+    uint64 luOne = 1ull << cShift;
+
+    uint32 luIntegrals = (uint32)(numTooHigh.m_f >> cShift);
+    uint64 luFractionals = numTooHigh.m_f & (luOne - 1);
+
+    // Find the largest power of ten that is not bigger than the integral part.
+    int iT = ((64 - cShift + 1) * 1233 >> 12) + 1;
+    Assert(iT > 0 && iT < (int)_countof(g_rgluTens));
+    __analysis_assume(iT > 0 && iT < (int)_countof(g_rgluTens));
+    if (luIntegrals < g_rgluTens[iT])
+        iT--;
+    uint32 luDivisor = g_rgluTens[iT];
+    int wKappa = iT;
+    int cb = 0;
+    Assert(luIntegrals >= luDivisor && luDivisor > 0);
+
+    // The integral digits.
+    while (wKappa > 0)
+    {
+        Assert(cb < kcbMaxRgb);
+        prgb[cb++] = (byte)(luIntegrals / luDivisor);
+        luIntegrals %= luDivisor;
+        wKappa--;
+
+        uint64 luRest = ((uint64)luIntegrals << cShift) + luFractionals;
+        if (luRest < luUnsafeInterval)
+        {
+            *pcb = cb;
+            *pwKappa = wKappa;
+            return FRoundWeed(prgb, cb, numTooHigh.m_f - numW.m_f, luUnsafeInterval, luRest,
+                (uint64)luDivisor << cShift, luUnit);
+        }
+        luDivisor /= 10;
+    }
+
+    // The fractional digits. The unit, and so the uncertainty, grows with
+    // every digit.
+    for (;;)
+    {
+        luFractionals *= 10;
+        luUnit *= 10;
+        luUnsafeInterval *= 10;
+        Assert(cb < kcbMaxRgb);
+        prgb[cb++] = (byte)(luFractionals >> cShift);
+        luFractionals &= luOne - 1;
+        wKappa--;
+        if (luFractionals < luUnsafeInterval)
+        {
+            *pcb = cb;
+            *pwKappa = wKappa;
+            return FRoundWeed(prgb, cb, (numTooHigh.m_f - numW.m_f) * luUnit, luUnsafeInterval, luFractionals,
+                luOne, luUnit);
+        }
+    }
+}
+
+_Success_(return)
+static BOOL FDblToRgbShortest(double dbl, _Out_writes_to_(kcbMaxRgb, (*ppbLim - prgb)) byte *prgb, int *pwExp10, byte **ppbLim)
+{
+    // Caller should take care of 0, negative and non-finite values.
+    Assert(Js::NumberUtilities::IsFinite(dbl));
+    Assert(0 < dbl);
+
+    uint64 luBits = Js::NumberUtilities::ToSpecial(dbl);
+    int wExp2 = (int)(luBits >> 52);
+    uint64 luSig = luBits & 0x000FFFFFFFFFFFFFull;
+    BOOL fLowerCloser = FALSE;
+    if (wExp2 != 0)
+    {
+        // Normalized. A power of 2, except for the smallest normal, has its
+        // next smaller neighbor closer than its next larger one.
+        fLowerCloser = 0 == luSig && wExp2 > 1;
+        luSig |= 0x0010000000000000ull;
+        wExp2 -= 1075;
+    }
+    else
+    {
+        // Denormal
+        wExp2 = -1074;
+    }
+
+    // The value and the midpoints between it and its neighbors, with the
+    // same exponent.
+    DIYFP numW(luSig, wExp2);
+    numW.Normalize();
+    DIYFP numHigh((luSig << 1) + 1, wExp2 - 1);
+    numHigh.Normalize();
+    DIYFP numLow = fLowerCloser ? DIYFP((luSig << 2) - 1, wExp2 - 2) : DIYFP((luSig << 1) - 1, wExp2 - 1);
+    numLow.m_f <<= numLow.m_wExp - numHigh.m_wExp;
+    numLow.m_wExp = numHigh.m_wExp;
+    Assert(numW.m_wExp == numHigh.m_wExp);
+
+    // Scale by 10^-k so that the exponent is in the range the digit
+    // generation needs.
+    const CACHEDPOWER *ppow = PowCachedForExp2(numW.m_wExp);
+    DIYFP numScale(ppow->m_f, ppow->m_wExp2);
+    Assert(kwGrisuMinExp2 <= numW.m_wExp + numScale.m_wExp + 64 &&
+        numW.m_wExp + numScale.m_wExp + 64 <= kwGrisuMaxExp2);
+
+    int cb;
+    int wKappa;
+    if (!FGrisuDigitGen(DIYFP::Mul(numLow, numScale), DIYFP::Mul(numW, numScale), DIYFP::Mul(numHigh, numScale),
+        prgb, &cb, &wKappa))
+    {
+        return FALSE;
+    }
+
+    Assert(cb > 0 && prgb[0] != 0);
+    *pwExp10 = cb + wKappa - ppow->m_wExp10;
+    *ppbLim = &prgb[cb];
+    return TRUE;
+}
+
 
 static BOOL FormatDigits(_In_reads_(pbLim - pbSrc) byte *pbSrc, byte *pbLim, int wExp10, _Out_writes_(cchDst) OLECHAR *pchDst, int cchDst)
 {
@@ -2413,11 +3137,14 @@ BOOL Js::NumberUtilities::FNonZeroFiniteDblToStr(double dbl, __out_ecount(cchDst
 #if DBG
     double dblT;
     const char16 *pch;
+    int wExp10Precise;
+    byte rgbPrecise[kcbMaxRgb];
+    byte *pbLimPrecise;
 
     // In Debug, always call FDblToRgbPrecise and verify that it converts back.
-    if (FDblToRgbPrecise(dbl, rgb, &wExp10, &pbLim))
+    if (FDblToRgbPrecise(dbl, rgbPrecise, &wExp10Precise, &pbLimPrecise))
     {
-        if (FormatDigits(rgb, pbLim, wExp10, pchDst, cchDst))
+        if (FormatDigits(rgbPrecise, pbLimPrecise, wExp10Precise, pchDst, cchDst))
         {
             bool likelyInt = true;
             dblT = StrToDbl<char16>(pchDst, &pch,likelyInt);
@@ -2431,13 +3158,21 @@ BOOL Js::NumberUtilities::FNonZeroFiniteDblToStr(double dbl, __out_ecount(cchDst
         AssertMsg(FALSE, "Failure in FDblToRgbPrecise");
 #endif //DBG
 
-    if (!FDblToRgbFast(dbl, rgb, &wExp10, &pbLim) &&
+    // FDblToRgbFast is not used here: its last digit is not always the one closest to dbl.
+    if (!FDblToRgbShortest(dbl, rgb, &wExp10, &pbLim) &&
         !FDblToRgbPrecise(dbl, rgb, &wExp10, &pbLim))
     {
         AssertMsg(FALSE, "Failure in FDblToRgbPrecise");
         return FALSE;
     }
 
+#if DBG
+    // The digits must be exactly those of FDblToRgbPrecise.
+    Assert(wExp10 == wExp10Precise);
+    Assert(pbLim - rgb == pbLimPrecise - rgbPrecise);
+    Assert(0 == memcmp(rgb, rgbPrecise, pbLim - rgb));
+#endif //DBG
+
     if (!FormatDigits(rgb, pbLim, wExp10, pchDst, cchDst))
     {
         AssertMsg(FALSE, "Failure in FormatDigits");
@@ -150,10 +150,29 @@
 #define ENABLE_RECYCLER_TYPE_TRACKING 0
 #endif
 
+// Stop-the-world parallel mark only needs worker threads, not write-watch,
+// so it is available even where concurrent GC is not. Builds that can't afford
+// the extra threads can define it to 0, unless they also use concurrent GC.
+#ifndef ENABLE_PARALLEL_MARK
+#define ENABLE_PARALLEL_MARK 1
+#endif
+
+// Without background sweep, small heap blocks with garbage are left pending and
+// swept on demand by allocation (or before the next mark) instead of in the pause.
+#define ENABLE_LAZY_SWEEP (!ENABLE_CONCURRENT_GC)
+
 #if ENABLE_BACKGROUND_PAGE_ZEROING && !ENABLE_BACKGROUND_PAGE_FREEING
 #error "Background page zeroing can't be turned on if freeing pages in the background is disabled"
 #endif
 
+#if ENABLE_CONCURRENT_GC && !ENABLE_PARALLEL_MARK
+#error "Concurrent GC can't be turned on if parallel mark is disabled"
+#endif
+
+#if ENABLE_LAZY_SWEEP && ENABLE_PARTIAL_GC
+#error "Lazy sweep can't be turned on with partial GC"
+#endif
+
 #define BUCKETIZE_MEDIUM_ALLOCATIONS 1              // *** TODO: Won't build if disabled currently
 #define SMALLBLOCK_MEDIUM_ALLOC 1                   // *** TODO: Won't build if disabled currently
 #define LARGEHEAPBLOCK_ENCODING 1                   // Large heap block metadata encoding
@@ -45,4 +45,5 @@ class FinalizableObject;
 #include "Memory/RecyclerHeuristic.h"
 #include "Memory/MarkContext.h"
 #include "Memory/RecyclerWatsonTelemetry.h"
+#include "Memory/RecyclerTelemetry.h"
 #include "Memory/Recycler.h"
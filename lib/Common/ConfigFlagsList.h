@@ -14,8 +14,10 @@ PHASE(All)
         PHASE(FunctionSourceInfoParse)
         PHASE(StringTemplateParse)
         PHASE(SkipNestedDeferred)
+        PHASE(FunctionBoundaryIndex)
         PHASE(CacheScopeInfoNames)
         PHASE(ScanAhead)
+        PHASE(Utf8BlockScan)
         PHASE(ParallelParse)
         PHASE(EarlyReferenceErrors)
     PHASE(ByteCode)
@@ -260,6 +262,7 @@ PHASE(All)
                     PHASE(FindImplicitRoot)
                     PHASE(FindRootExt)
                 PHASE(ScanStack)
+                    PHASE(PreciseStackScan)
                 PHASE(ConcurrentMark)
                 PHASE(ConcurrentWait)
                 PHASE(Rescan)
@@ -269,6 +272,9 @@ PHASE(All)
                     PHASE(SweepSmall)
                     PHASE(SweepLarge)
                     PHASE(SweepPartialReuse)
+                    PHASE(LazySweep)
+                    PHASE(DrainSparseBlocks)
+                    PHASE(ParallelSweep)
                 PHASE(ConcurrentSweep)
                 PHASE(Finalize)
                 PHASE(Dispose)
@@ -278,9 +284,11 @@ PHASE(All)
         PHASE(RegexQc)
         PHASE(InlineCache)
         PHASE(PolymorphicInlineCache)
+        PHASE(MegamorphicInlineCache)
         PHASE(MissingPropertyCache)
         PHASE(CloneCacheInCollision)
         PHASE(ConstructorCache)
+        PHASE(ConstructorSlackTracking)
         PHASE(InlineCandidate)
         PHASE(InlineHostCandidate)
         PHASE(ScriptFunctionWithInlineCache)
@@ -403,6 +411,7 @@ PHASE(All)
 #define DEFAULT_CONFIG_InlineThresholdAdjustCountInSmallFunction  (10)
 #define DEFAULT_CONFIG_ConstructorInlineThreshold (21)      //Monomorphic constructor threshold
 #define DEFAULT_CONFIG_ConstructorCallsRequiredToFinalizeCachedType (2)
+#define DEFAULT_CONFIG_MaxConstructorInlineSlotCapacity (64)
 #define DEFAULT_CONFIG_OutsideLoopInlineThreshold (16)      //Threshold to inline outside loops
 #define DEFAULT_CONFIG_LeafInlineThreshold  (60)            //Inlinee threshold for function which is leaf (irrespective of it has loops or not)
 #define DEFAULT_CONFIG_LoopInlineThreshold  (25)            //Inlinee threshold for function with loops
@@ -445,6 +454,7 @@ PHASE(All)
 
 #define DEFAULT_CONFIG_LowMemoryCap         (0xB900000) // 185 MB - based on memory cap for process on low-capacity device
 #define DEFAULT_CONFIG_NewPagesCapDuringBGSweeping    (15000)
+#define DEFAULT_CONFIG_SparseLeafBlockPercent         (10)
 
 #define DEFAULT_CONFIG_MaxCodeFill          (500)
 #define DEFAULT_CONFIG_MaxLoopsPerFunction  (10)
@@ -469,6 +479,7 @@ PHASE(All)
 #define DEFAULT_CONFIG_ProfileBasedDeferParseThreshold (100)      // Unit is number of characters
 
 #define DEFAULT_CONFIG_ProfileBasedSpeculativeJit (true)
+#define DEFAULT_CONFIG_ParallelParseStartupFunctions (false)
 #define DEFAULT_CONFIG_WininetProfileCache        (true)
 #define DEFAULT_CONFIG_MinProfileCacheSize        (5)   // Minimum number of functions before profile is saved.
 #define DEFAULT_CONFIG_ProfileDifferencePercent   (15)  // If 15% of the functions have different profile we will trigger a save.
@@ -711,6 +722,7 @@ PHASE(All)
 
 #define INMEMORY_CACHE_MAX_URL                    (5)             // This is the max number of URLs that the in-memory profile cache can hold.
 #define INMEMORY_CACHE_MAX_PROFILE_MANAGER        (50)            // This is the max number of dynamic scripts that the in-memory profile cache can have
+#define INMEMORY_CACHE_MAX_FUNCTION_BOUNDARY_INDEX (16)           // This is the max number of sources whose deferred function extents are kept in memory
 
 #ifdef SUPPORT_INTRUSIVE_TESTTRACES
 #define INTRUSIVE_TESTTRACE_PolymorphicInlineCache (1)
@@ -857,6 +869,7 @@ FLAGNR(Boolean, ConsoleExitPause      , "Pause on exit when a console window is
 #endif
 FLAGNR(Number,  ConstructorInlineThreshold      , "Maximum size in bytecodes of a constructor inline candidate with monomorphic field access", DEFAULT_CONFIG_ConstructorInlineThreshold)
 FLAGNR(Number,  ConstructorCallsRequiredToFinalizeCachedType, "Number of calls to a constructor required before the type cached in the constructor cache is finalized", DEFAULT_CONFIG_ConstructorCallsRequiredToFinalizeCachedType)
+FLAGNR(Number,  MaxConstructorInlineSlotCapacity, "Largest inline slot capacity constructor slack tracking may grow a constructor's instances to", DEFAULT_CONFIG_MaxConstructorInlineSlotCapacity)
 #ifdef SECURITY_TESTING
 FLAGNR(Boolean, CrashOnException      , "Removes the top-level exception handler, allowing jc.exe to crash on an unhandled exception.  No effect on IE. (default: false)", false)
 #endif
@@ -872,6 +885,7 @@ FLAGNR(Boolean, DisableRentalThreading, "Disable rental threading when creating
 FLAGNR(Boolean, DisableVTuneSourceLineInfo, "Disable VTune Source line info for Dynamic JITted code", false)
 FLAGNR(Boolean, DisplayMemStats, "Display memory usage statistics", false)
 FLAGNR(Phases,  Dump                  , "What All to dump", )
+FLAGNR(Boolean, DumpAllocationHistogram, "Dump the number of heap blocks and slow path allocations per size class after every GC", false)
 #ifdef DUMP_FRAGMENTATION_STATS
 FLAGR (Boolean, DumpFragmentationStats, "Dump bucket state after every GC", false)
 #endif
@@ -894,6 +908,7 @@ FLAGNR(Boolean, EditTest              , "Enable edit and continue test tools", f
 FLAGNR(Boolean, WininetProfileCache, "Use the WININET cache to save the profile information", DEFAULT_CONFIG_WininetProfileCache)
 FLAGNR(Boolean, NoDynamicProfileInMemoryCache, "Enable in-memory cache for dynamic sources", false)
 FLAGNR(Boolean, ProfileBasedSpeculativeJit, "Enable dynamic profile based speculative JIT", DEFAULT_CONFIG_ProfileBasedSpeculativeJit)
+FLAGR (Boolean, ParallelParseStartupFunctions, "Parse functions that the dynamic profile recorded as executed at startup on background threads", DEFAULT_CONFIG_ParallelParseStartupFunctions)
 FLAGNR(Number,  ProfileBasedSpeculationCap, "In the presence of dynamic profile speculative JIT is capped to this many bytecode instructions", DEFAULT_CONFIG_ProfileBasedSpeculationCap)
 #ifdef DYNAMIC_PROFILE_MUTATOR
 FLAGNR(String,  DynamicProfileMutatorDll , "Path of the mutator DLL", _u("DynamicProfileMutatorImpl.dll"))
@@ -1293,6 +1308,7 @@ FLAGNR(Boolean, RecyclerVerifyMark    , "verify concurrent gc", false)
 #endif
 FLAGR (Number,  LowMemoryCap          , "Memory cap indicating a low-memory process", DEFAULT_CONFIG_LowMemoryCap)
 FLAGNR(Number,  NewPagesCapDuringBGSweeping, "New pages count allowed to be allocated during background sweeping", DEFAULT_CONFIG_NewPagesCapDuringBGSweeping)
+FLAGNR(Number,  SparseLeafBlockPercent, "Occupancy (percent of objects live) below which a leaf heap block is allocated from last so it can drain", DEFAULT_CONFIG_SparseLeafBlockPercent)
 #ifdef RUNTIME_DATA_COLLECTION
 FLAGNR(String,  RuntimeDataOutputFile, "Filename to write the dynamic profile info", nullptr)
 #endif
@@ -1418,6 +1434,7 @@ FLAGNR(NumberSet, RejitTraceFilter, "Filter the rejit trace messages to specific
 FLAGNR(Number,  MaxBackgroundFinishMarkCount, "Maximum number of background finish mark", 1)
 FLAGNR(Number,  BackgroundFinishMarkWaitTime, "Millisecond to wait for background finish mark", 15)
 FLAGNR(Number,  MinBackgroundRepeatMarkRescanBytes, "Minimum number of bytes rescan to trigger background finish mark",  -1)
+FLAGNR(Number,  ParallelMarkThreadCount, "Number of threads to split a parallel mark between (default: one per physical processor)", 0)
 
 // recycler memory restrict test flags
 FLAGNR(Number,  MaxMarkStackPageCount , "Restrict recycler mark stack size (in pages)", -1)
@@ -26,6 +26,30 @@ public:
 
     uint Split(uint targetCount, __in_ecount(targetCount) PageStack<T> ** targetStacks);
 
+    // Work stealing support.
+    // The part of the stack other threads steal from lives apart from the stack, so the owner can keep
+    // the stack itself (and its push/pop pointers) on its own thread stack while it works.
+    // While a steal state is set, the owner moves between chunks under its lock and publishes its
+    // current chunk there, so another thread can take the full chunks below it with Steal.
+    struct StealState
+    {
+        CriticalSection lock;
+        Chunk * currentChunk;
+        // Threads blocked waiting for a chunk to steal, shared by all the stacks taking part.
+        // When there are any, the owner signals the event each time it leaves a full chunk behind.
+        LONG volatile * waiterCount;
+        HANDLE workAvailableEvent;
+#ifdef ENABLE_DEBUG_CONFIG_OPTIONS
+        // Chunks taken by Steal that the owner hasn't taken out of its counts yet.
+        // Stealing doesn't touch the counts directly, as the owner updates them without the lock.
+        size_t stolenChunkCount;
+#endif
+    };
+
+    void SetStealState(StealState * state);
+    bool HasStealState() const { return this->stealState != nullptr; }
+    bool Steal(StealState * victimState);
+
     void Abort();
     void Release();
 
@@ -44,7 +68,7 @@ public:
     }
 #endif
 
-    static const uint MaxSplitTargets = 3;     // Not counting original stack, so this supports 4-way parallel
+    static const uint MaxSplitTargets = 63;    // Not counting original stack, so this supports 64-way parallel
 
 private:
     Chunk * CreateChunk();
@@ -56,6 +80,7 @@ private:
     T * chunkEnd;
     Chunk * currentChunk;
     PagePool * pagePool;
+    StealState * stealState;
     bool usesReservedPages;
 
 #if DBG
@@ -64,6 +89,8 @@ private:
 #ifdef ENABLE_DEBUG_CONFIG_OPTIONS
     size_t pageCount;
     size_t maxPageCount;
+
+    void UpdateStolenChunkCount();
 #endif
 };
 
@@ -77,9 +104,14 @@ bool PageStack<T>::Pop(T * item)
     if (nextEntry == chunkStart)
     {
         // We're at the beginning of the chunk.  Move to the previous chunk, if any
+        AutoOptionalCriticalSection autoLock(stealState != nullptr ? &stealState->lock : nullptr);
+
         if (currentChunk->nextChunk == nullptr)
         {
             // All done
+#ifdef ENABLE_DEBUG_CONFIG_OPTIONS
+            UpdateStolenChunkCount();
+#endif
             Assert(count == 0);
             return false;
         }
@@ -88,6 +120,11 @@ bool PageStack<T>::Pop(T * item)
         currentChunk = currentChunk->nextChunk;
         FreeChunk(temp);
 
+        if (stealState != nullptr)
+        {
+            stealState->currentChunk = currentChunk;
+        }
+
         chunkStart = currentChunk->entries;
         chunkEnd = &currentChunk->entries[EntriesPerChunk];
         nextEntry = chunkEnd;
@@ -118,9 +155,23 @@ bool PageStack<T>::Push(T item)
             return false;
         }
 
+        AutoOptionalCriticalSection autoLock(stealState != nullptr ? &stealState->lock : nullptr);
+
         newChunk->nextChunk = currentChunk;
         currentChunk = newChunk;
 
+        if (stealState != nullptr)
+        {
+            stealState->currentChunk = currentChunk;
+
+            // The chunk we just filled can be stolen now. The waiter count is read under the lock,
+            // so a thief that registered before looking at our chunks either saw this one or gets woken.
+            if (currentChunk->nextChunk != nullptr && stealState->waiterCount != nullptr && *stealState->waiterCount != 0)
+            {
+                SetEvent(stealState->workAvailableEvent);
+            }
+        }
+
         chunkStart = currentChunk->entries;
         chunkEnd = &currentChunk->entries[EntriesPerChunk];
         nextEntry = chunkStart;
@@ -147,6 +198,7 @@ PageStack<T>::PageStack(PagePool * pagePool) :
     nextEntry(nullptr),
     chunkStart(nullptr),
     chunkEnd(nullptr),
+    stealState(nullptr),
     usesReservedPages(false)
 {
 #ifdef ENABLE_DEBUG_CONFIG_OPTIONS
@@ -353,6 +405,93 @@ uint PageStack<T>::Split(uint targetCount, __in_ecount(targetCount) PageStack<T>
 }
 
 
+template <typename T>
+void PageStack<T>::SetStealState(StealState * state)
+{
+    // Only changed while no other thread is using the stack
+#ifdef ENABLE_DEBUG_CONFIG_OPTIONS
+    UpdateStolenChunkCount();
+#endif
+    this->stealState = state;
+    if (state != nullptr)
+    {
+        state->currentChunk = this->currentChunk;
+#ifdef ENABLE_DEBUG_CONFIG_OPTIONS
+        state->stolenChunkCount = 0;
+#endif
+    }
+}
+
+
+template <typename T>
+bool PageStack<T>::Steal(StealState * victimState)
+{
+    // Take one full chunk from the stack that owns [victimState], which may be in use by another thread.
+    // The victim's current chunk is never taken, so we only race with it moving between chunks,
+    // which it does under the state's lock.
+
+    Assert(victimState != this->stealState);
+    Assert(this->currentChunk != nullptr);
+
+    Chunk * chunk;
+    {
+        AutoCriticalSection autoLock(&victimState->lock);
+
+        Chunk * victimCurrent = victimState->currentChunk;
+        if (victimCurrent == nullptr || victimCurrent->nextChunk == nullptr)
+        {
+            return false;
+        }
+
+        chunk = victimCurrent->nextChunk;
+        victimCurrent->nextChunk = chunk->nextChunk;
+
+#ifdef ENABLE_DEBUG_CONFIG_OPTIONS
+        victimState->stolenChunkCount++;
+#endif
+    }
+
+    // Put the chunk below our current one; it is full, as all chunks below the current one are.
+    // Other threads may be stealing from us too, so this has to be done under our own lock.
+    {
+        AutoOptionalCriticalSection autoLock(this->stealState != nullptr ? &this->stealState->lock : nullptr);
+
+        chunk->nextChunk = this->currentChunk->nextChunk;
+        this->currentChunk->nextChunk = chunk;
+    }
+
+#ifdef ENABLE_DEBUG_CONFIG_OPTIONS
+    this->pageCount++;
+#endif
+#if DBG
+    this->count += EntriesPerChunk;
+#endif
+
+    return true;
+}
+
+
+#ifdef ENABLE_DEBUG_CONFIG_OPTIONS
+template <typename T>
+void PageStack<T>::UpdateStolenChunkCount()
+{
+    // Called by the owner, either under the steal lock or while nobody else can steal
+    if (this->stealState == nullptr)
+    {
+        return;
+    }
+
+    size_t stolenChunkCount = this->stealState->stolenChunkCount;
+    Assert(this->pageCount >= stolenChunkCount);
+    this->pageCount -= stolenChunkCount;
+#if DBG
+    this->count -= stolenChunkCount * EntriesPerChunk;
+#endif
+    this->stealState->stolenChunkCount = 0;
+}
+#endif
+
+
 template <typename T>
 void PageStack<T>::Abort()
 {
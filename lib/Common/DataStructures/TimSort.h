@@ -0,0 +1,643 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+#pragma once
+
+namespace JsUtil
+{
+    // Stable merge sort that takes advantage of runs that are already in order (Timsort). Ascending and strictly
+    // descending runs are found as they are, short runs are extended with a binary insertion sort, and runs are merged
+    // with galloping so that presorted, reversed and partially ordered input needs far fewer than n log n comparisons.
+    //
+    // TComparer is an object with an int Compare(const T&, const T&) method. The comparer may throw; the elements are
+    // then still a permutation of the input, since the elements of a merge that were moved out to the buffer are
+    // always copied back to the hole they left in the array.
+    //
+    // The caller provides a buffer of at least GetBufferLength(length) elements. If T holds recycler pointers the
+    // buffer has to be scanned by the recycler, because an element can live only in the buffer while the comparer runs.
+    template <class T, class TComparer> class TimSort
+    {
+    public:
+        static uint32 GetBufferLength(uint32 length)
+        {
+            return length < MinMerge ? 0 : length / 2;
+        }
+
+        static void Sort(T* elements, uint32 length, TComparer& comparer, T* buffer)
+        {
+            TimSort sort(elements, comparer, buffer);
+            sort.Sort(length);
+        }
+
+    private:
+        // Arrays shorter than this are sorted with a single binary insertion sort and never merged
+        static const uint32 MinMerge = 32;
+        static const uint32 MinGallop = 7;
+
+        // The lengths of pending runs grow at least as fast as the Fibonacci numbers, so this covers any uint32 length
+        static const uint32 MaxPendingRuns = 50;
+
+        // Copies the elements that are still in the buffer back to the array when a merge completes or throws
+        class MergeHole
+        {
+        public:
+            MergeHole(T*& dest, T* const& source, uint32& count) : dest(dest), source(source), count(count) {}
+            ~MergeHole()
+            {
+                if (count != 0)
+                {
+                    js_memcpy_s(dest, count * sizeof(T), source, count * sizeof(T));
+                }
+            }
+
+        private:
+            T*& dest;
+            T* const& source;
+            uint32& count;
+        };
+
+        TimSort(T* elements, TComparer& comparer, T* buffer) :
+            elements(elements), comparer(comparer), buffer(buffer), minGallop(MinGallop), pendingRunCount(0)
+        {
+        }
+
+        bool IsLess(const T& left, const T& right)
+        {
+            return comparer.Compare(left, right) < 0;
+        }
+
+        void Sort(uint32 length)
+        {
+            if (length < 2)
+            {
+                return;
+            }
+
+            if (length < MinMerge)
+            {
+                uint32 runLength = CountRunAndMakeAscending(elements, length);
+                BinaryInsertionSort(elements, length, runLength);
+                return;
+            }
+
+            const uint32 minRun = GetMinRunLength(length);
+            uint32 low = 0;
+            uint32 remaining = length;
+            do
+            {
+                uint32 runLength = CountRunAndMakeAscending(elements + low, remaining);
+                if (runLength < minRun)
+                {
+                    uint32 forcedLength = remaining <= minRun ? remaining : minRun;
+                    BinaryInsertionSort(elements + low, forcedLength, runLength);
+                    runLength = forcedLength;
+                }
+
+                PushRun(low, runLength);
+                MergeCollapse();
+
+                low += runLength;
+                remaining -= runLength;
+            }
+            while (remaining != 0);
+
+            MergeForceCollapse();
+            Assert(pendingRunCount == 1 && runLengths[0] == length);
+        }
+
+        // Picks a run length in [MinMerge / 2, MinMerge] such that length / minRun is a power of two or a little less
+        // than one, which keeps the final merges balanced.
+        static uint32 GetMinRunLength(uint32 length)
+        {
+            uint32 lowBits = 0;
+            while (length >= MinMerge)
+            {
+                lowBits |= length & 1;
+                length >>= 1;
+            }
+            return length + lowBits;
+        }
+
+        // Returns the length of the run at the start of the range, reversing it if it is strictly descending. Strict
+        // descent is required so that reversing the run keeps the sort stable.
+        uint32 CountRunAndMakeAscending(T* run, uint32 length)
+        {
+            Assert(length > 0);
+            uint32 runHigh = 1;
+            if (runHigh == length)
+            {
+                return 1;
+            }
+
+            if (IsLess(run[runHigh], run[0]))
+            {
+                runHigh++;
+                while (runHigh < length && IsLess(run[runHigh], run[runHigh - 1]))
+                {
+                    runHigh++;
+                }
+                Reverse(run, runHigh);
+            }
+            else
+            {
+                runHigh++;
+                while (runHigh < length && !IsLess(run[runHigh], run[runHigh - 1]))
+                {
+                    runHigh++;
+                }
+            }
+            return runHigh;
+        }
+
+        static void Reverse(T* run, uint32 length)
+        {
+            for (uint32 low = 0, high = length - 1; low < high; low++, high--)
+            {
+                T temp = run[low];
+                run[low] = run[high];
+                run[high] = temp;
+            }
+        }
+
+        // Sorts the range given that its first sortedLength elements are already sorted. All the comparisons for an
+        // element are done before anything is moved.
+        void BinaryInsertionSort(T* range, uint32 length, uint32 sortedLength)
+        {
+            Assert(sortedLength > 0 && sortedLength <= length);
+            for (uint32 i = sortedLength; i < length; i++)
+            {
+                T pivot = range[i];
+
+                // Find the first element greater than the pivot; equal elements stay in front of it
+                uint32 left = 0;
+                uint32 right = i;
+                while (left < right)
+                {
+                    uint32 middle = left + (right - left) / 2;
+                    if (IsLess(pivot, range[middle]))
+                    {
+                        right = middle;
+                    }
+                    else
+                    {
+                        left = middle + 1;
+                    }
+                }
+
+                memmove(range + left + 1, range + left, (i - left) * sizeof(T));
+                range[left] = pivot;
+            }
+        }
+
+        void PushRun(uint32 runBase, uint32 runLength)
+        {
+            AnalysisAssert(pendingRunCount < MaxPendingRuns);
+            runBases[pendingRunCount] = runBase;
+            runLengths[pendingRunCount] = runLength;
+            pendingRunCount++;
+        }
+
+        // Merges pending runs until, for the lengths A, B, C, D of the top four runs, B > C + D, A > B + C and C > D.
+        void MergeCollapse()
+        {
+            while (pendingRunCount > 1)
+            {
+                uint32 n = pendingRunCount - 2;
+                if ((n > 0 && runLengths[n - 1] <= runLengths[n] + runLengths[n + 1]) ||
+                    (n > 1 && runLengths[n - 2] <= runLengths[n - 1] + runLengths[n]))
+                {
+                    if (runLengths[n - 1] < runLengths[n + 1])
+                    {
+                        n--;
+                    }
+                }
+                else if (runLengths[n] > runLengths[n + 1])
+                {
+                    break;
+                }
+                MergeAt(n);
+            }
+        }
+
+        void MergeForceCollapse()
+        {
+            while (pendingRunCount > 1)
+            {
+                uint32 n = pendingRunCount - 2;
+                if (n > 0 && runLengths[n - 1] < runLengths[n + 1])
+                {
+                    n--;
+                }
+                MergeAt(n);
+            }
+        }
+
+        // Merges the pending runs i and i + 1
+        void MergeAt(uint32 i)
+        {
+            Assert(pendingRunCount >= 2 && (i == pendingRunCount - 2 || i == pendingRunCount - 3));
+
+            uint32 base1 = runBases[i];
+            uint32 length1 = runLengths[i];
+            uint32 base2 = runBases[i + 1];
+            uint32 length2 = runLengths[i + 1];
+            Assert(base1 + length1 == base2);
+
+            runLengths[i] = length1 + length2;
+            if (i == pendingRunCount - 3)
+            {
+                runBases[i + 1] = runBases[i + 2];
+                runLengths[i + 1] = runLengths[i + 2];
+            }
+            pendingRunCount--;
+
+            // Elements of run 1 that are not greater than the first element of run 2 are already in place
+            uint32 skip = GallopRight(elements[base2], elements + base1, length1, 0);
+            base1 += skip;
+            length1 -= skip;
+            if (length1 == 0)
+            {
+                return;
+            }
+
+            // So are the elements of run 2 that are not less than the last element of run 1
+            length2 = GallopLeft(elements[base1 + length1 - 1], elements + base2, length2, length2 - 1);
+            if (length2 == 0)
+            {
+                return;
+            }
+
+            if (length1 <= length2)
+            {
+                MergeLow(elements + base1, length1, elements + base2, length2);
+            }
+            else
+            {
+                MergeHigh(elements + base1, length1, elements + base2, length2);
+            }
+        }
+
+        static uint32 NextGallopOffset(uint32 offset, uint32 maxOffset)
+        {
+            return offset < maxOffset / 2 ? (offset << 1) + 1 : maxOffset;
+        }
+
+        // Returns the index in the sorted range at which key would be inserted in front of any equal elements,
+        // searching outward from hint first.
+        uint32 GallopLeft(const T key, const T* range, uint32 length, uint32 hint)
+        {
+            Assert(length > 0 && hint < length);
+
+            uint32 low;
+            uint32 high;
+            uint32 lastOffset = 0;
+            uint32 offset = 1;
+            if (IsLess(range[hint], key))
+            {
+                // range[hint + lastOffset] < key <= range[hint + offset]
+                const uint32 maxOffset = length - hint;
+                while (offset < maxOffset && IsLess(range[hint + offset], key))
+                {
+                    lastOffset = offset;
+                    offset = NextGallopOffset(offset, maxOffset);
+                }
+                if (offset > maxOffset)
+                {
+                    offset = maxOffset;
+                }
+                low = hint + lastOffset + 1;
+                high = hint + offset;
+            }
+            else
+            {
+                // range[hint - offset] < key <= range[hint - lastOffset]
+                const uint32 maxOffset = hint + 1;
+                while (offset < maxOffset && !IsLess(range[hint - offset], key))
+                {
+                    lastOffset = offset;
+                    offset = NextGallopOffset(offset, maxOffset);
+                }
+                if (offset > maxOffset)
+                {
+                    offset = maxOffset;
+                }
+                low = hint - offset + 1;
+                high = hint - lastOffset;
+            }
+
+            while (low < high)
+            {
+                uint32 middle = low + (high - low) / 2;
+                if (IsLess(range[middle], key))
+                {
+                    low = middle + 1;
+                }
+                else
+                {
+                    high = middle;
+                }
+            }
+            return high;
+        }
+
+        // Like GallopLeft, but key goes after any equal elements
+        uint32 GallopRight(const T key, const T* range, uint32 length, uint32 hint)
+        {
+            Assert(length > 0 && hint < length);
+
+            uint32 low;
+            uint32 high;
+            uint32 lastOffset = 0;
+            uint32 offset = 1;
+            if (IsLess(key, range[hint]))
+            {
+                // range[hint - offset] <= key < range[hint - lastOffset]
+                const uint32 maxOffset = hint + 1;
+                while (offset < maxOffset && IsLess(key, range[hint - offset]))
+                {
+                    lastOffset = offset;
+                    offset = NextGallopOffset(offset, maxOffset);
+                }
+                if (offset > maxOffset)
+                {
+                    offset = maxOffset;
+                }
+                low = hint - offset + 1;
+                high = hint - lastOffset;
+            }
+            else
+            {
+                // range[hint + lastOffset] <= key < range[hint + offset]
+                const uint32 maxOffset = length - hint;
+                while (offset < maxOffset && !IsLess(key, range[hint + offset]))
+                {
+                    lastOffset = offset;
+                    offset = NextGallopOffset(offset, maxOffset);
+                }
+                if (offset > maxOffset)
+                {
+                    offset = maxOffset;
+                }
+                low = hint + lastOffset + 1;
+                high = hint + offset;
+            }
+
+            while (low < high)
+            {
+                uint32 middle = low + (high - low) / 2;
+                if (IsLess(key, range[middle]))
+                {
+                    high = middle;
+                }
+                else
+                {
+                    low = middle + 1;
+                }
+            }
+            return high;
+        }
+
+        // Merges two adjacent runs, run 1 being the shorter one, from the low end. The first element of run 2 is less
+        // than the first element of run 1, and the last element of run 1 is greater than every element of run 2.
+        // Run 1 is moved to the buffer; the hole [dest, dest + length1) it leaves in the array always has room for
+        // exactly the elements still in the buffer.
+        void MergeLow(T* run1, uint32 length1, T* run2, uint32 length2)
+        {
+            Assert(length1 > 0 && length2 > 0 && run1 + length1 == run2);
+            js_memcpy_s(buffer, length1 * sizeof(T), run1, length1 * sizeof(T));
+
+            T* cursor1 = buffer;
+            T* cursor2 = run2;
+            T* dest = run1;
+            MergeHole hole(dest, cursor1, length1);
+
+            *dest++ = *cursor2++;
+            if (--length2 == 0)
+            {
+                return;
+            }
+            if (length1 == 1)
+            {
+                memmove(dest, cursor2, length2 * sizeof(T));
+                dest += length2;
+                return;
+            }
+
+            uint32 gallop = minGallop;
+            for (;;)
+            {
+                // Merge one element at a time until one run keeps winning
+                uint32 count1 = 0;
+                uint32 count2 = 0;
+                do
+                {
+                    Assert(length1 > 1 && length2 > 0);
+                    if (IsLess(*cursor2, *cursor1))
+                    {
+                        *dest++ = *cursor2++;
+                        count2++;
+                        count1 = 0;
+                        if (--length2 == 0)
+                        {
+                            goto Done;
+                        }
+                    }
+                    else
+                    {
+                        *dest++ = *cursor1++;
+                        count1++;
+                        count2 = 0;
+                        if (--length1 == 1)
+                        {
+                            goto Done;
+                        }
+                    }
+                }
+                while ((count1 | count2) < gallop);
+
+                // Then gallop until neither run wins by enough to make it pay
+                do
+                {
+                    Assert(length1 > 1 && length2 > 0);
+                    count1 = GallopRight(*cursor2, cursor1, length1, 0);
+                    if (count1 != 0)
+                    {
+                        js_memcpy_s(dest, count1 * sizeof(T), cursor1, count1 * sizeof(T));
+                        dest += count1;
+                        cursor1 += count1;
+                        length1 -= count1;
+                        if (length1 <= 1)
+                        {
+                            goto Done;
+                        }
+                    }
+                    *dest++ = *cursor2++;
+                    if (--length2 == 0)
+                    {
+                        goto Done;
+                    }
+
+                    count2 = GallopLeft(*cursor1, cursor2, length2, 0);
+                    if (count2 != 0)
+                    {
+                        memmove(dest, cursor2, count2 * sizeof(T));
+                        dest += count2;
+                        cursor2 += count2;
+                        length2 -= count2;
+                        if (length2 == 0)
+                        {
+                            goto Done;
+                        }
+                    }
+                    *dest++ = *cursor1++;
+                    if (--length1 == 1)
+                    {
+                        goto Done;
+                    }
+
+                    if (gallop > 0)
+                    {
+                        gallop--;
+                    }
+                }
+                while (count1 >= MinGallop || count2 >= MinGallop);
+                gallop += 2;
+            }
+
+        Done:
+            minGallop = gallop < 1 ? 1 : gallop;
+            if (length1 == 1 && length2 != 0)
+            {
+                // The last element of run 1 is greater than the rest of run 2
+                memmove(dest, cursor2, length2 * sizeof(T));
+                dest += length2;
+            }
+            // The hole copies what is left of run 1 into place. If the comparer is inconsistent, length1 can reach 0
+            // and the rest of run 2 is simply left where it is.
+        }
+
+        // Merges two adjacent runs, run 2 being the shorter one, from the high end. Run 2 is moved to the buffer, the
+        // part of run 1 still to be merged is [run1, end1), and the hole [end1, end1 + length2) it leaves in the
+        // array always has room for exactly the elements still in the buffer.
+        void MergeHigh(T* run1, uint32 length1, T* run2, uint32 length2)
+        {
+            Assert(length1 > 0 && length2 > 0 && run1 + length1 == run2);
+            js_memcpy_s(buffer, length2 * sizeof(T), run2, length2 * sizeof(T));
+
+            T* end1 = run2;
+            MergeHole hole(end1, buffer, length2);
+
+            end1[length2 - 1] = end1[-1];
+            end1--;
+            if (--length1 == 0)
+            {
+                return;
+            }
+            if (length2 == 1)
+            {
+                // The only element of run 2 is less than all of run 1
+                memmove(run1 + 1, run1, length1 * sizeof(T));
+                end1 = run1;
+                return;
+            }
+
+            uint32 gallop = minGallop;
+            for (;;)
+            {
+                uint32 count1 = 0;
+                uint32 count2 = 0;
+                do
+                {
+                    Assert(length1 > 0 && length2 > 1);
+                    if (IsLess(buffer[length2 - 1], end1[-1]))
+                    {
+                        end1[length2 - 1] = end1[-1];
+                        end1--;
+                        count1++;
+                        count2 = 0;
+                        if (--length1 == 0)
+                        {
+                            goto Done;
+                        }
+                    }
+                    else
+                    {
+                        end1[length2 - 1] = buffer[length2 - 1];
+                        count2++;
+                        count1 = 0;
+                        if (--length2 == 1)
+                        {
+                            goto Done;
+                        }
+                    }
+                }
+                while ((count1 | count2) < gallop);
+
+                do
+                {
+                    Assert(length1 > 0 && length2 > 1);
+                    count1 = length1 - GallopRight(buffer[length2 - 1], run1, length1, length1 - 1);
+                    if (count1 != 0)
+                    {
+                        end1 -= count1;
+                        length1 -= count1;
+                        memmove(end1 + length2, end1, count1 * sizeof(T));
+                        if (length1 == 0)
+                        {
+                            goto Done;
+                        }
+                    }
+                    end1[length2 - 1] = buffer[length2 - 1];
+                    if (--length2 == 1)
+                    {
+                        goto Done;
+                    }
+
+                    count2 = length2 - GallopLeft(end1[-1], buffer, length2, length2 - 1);
+                    if (count2 != 0)
+                    {
+                        length2 -= count2;
+                        js_memcpy_s(end1 + length2, count2 * sizeof(T), buffer + length2, count2 * sizeof(T));
+                        if (length2 <= 1)
+                        {
+                            goto Done;
+                        }
+                    }
+                    end1[length2 - 1] = end1[-1];
+                    end1--;
+                    if (--length1 == 0)
+                    {
+                        goto Done;
+                    }
+
+                    if (gallop > 0)
+                    {
+                        gallop--;
+                    }
+                }
+                while (count1 >= MinGallop || count2 >= MinGallop);
+                gallop += 2;
+            }
+
+        Done:
+            minGallop = gallop < 1 ? 1 : gallop;
+            if (length2 == 1 && length1 != 0)
+            {
+                // The first element of run 2 is less than the rest of run 1
+                memmove(run1 + 1, run1, length1 * sizeof(T));
+                end1 = run1;
+            }
+            // The hole copies what is left of run 2 into place
+        }
+
+        T* const elements;
+        TComparer& comparer;
+        T* const buffer;
+        uint32 minGallop;
+
+        uint32 pendingRunCount;
+        uint32 runBases[MaxPendingRuns];
+        uint32 runLengths[MaxPendingRuns];
+    };
+}
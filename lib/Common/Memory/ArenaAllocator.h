@@ -549,6 +549,7 @@ public:
 #define InlineCacheAuxSlotTypeTag 4
 #define MinPolymorphicInlineCacheSize 4
 #define MaxPolymorphicInlineCacheSize 32
+#define MegamorphicInlineCacheSize 1024
 
 #ifdef PERSISTENT_INLINE_CACHES
 
@@ -65,6 +65,9 @@ enum CollectionState
     CollectionStateTransferSweptWait      = Collection_ConcurrentSweep | Collection_FinishConcurrent,         // transfer swept objects (after concurrent sweep)
 #endif
     CollectionStateParallelMark           = Collection_Mark | Collection_Parallel,
+#if ENABLE_LAZY_SWEEP
+    CollectionStateParallelSweep          = Collection_Sweep | Collection_Parallel,                           // finishing lazy sweep (in thread and parallel)
+#endif
 #if ENABLE_CONCURRENT_GC
     CollectionStateBackgroundParallelMark = Collection_ConcurrentMark | Collection_ExecutingConcurrent | Collection_Parallel,
     CollectionStateConcurrentWrapperCallback = Collection_Concurrent | Collection_ExecutingConcurrent | Collection_WrapperCallback,
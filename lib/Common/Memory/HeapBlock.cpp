@@ -216,7 +216,12 @@ template <class TBlockAttributes>
 ushort
 SmallHeapBlockT<TBlockAttributes>::GetExpectedFreeObjectCount() const
 {
+#if ENABLE_LAZY_SWEEP
+    // Blocks pending lazy sweep are swept on allocation, using the mark count of the collection that queued them
+    Assert(this->GetRecycler()->IsSweeping() || this->isPendingLazySweep);
+#else
     Assert(this->GetRecycler()->IsSweeping());
+#endif
     return objectCount - markCount;
 }
 template <class TBlockAttributes>
@@ -253,6 +258,12 @@ SmallHeapBlockT<TBlockAttributes>::Init(ushort objectSize, ushort objectCount)
 #if ENABLE_CONCURRENT_GC
     this->isPendingConcurrentSweep = false;
 #endif
+#if ENABLE_LAZY_SWEEP
+    this->isPendingLazySweep = false;
+#endif
+#ifdef RECYCLER_STATS
+    this->isSparseBlock = false;
+#endif
 
     Assert(!this->isInAllocator);
     Assert(!this->isClearedFromAllocator);
@@ -992,6 +1003,9 @@ SmallHeapBlockT<TBlockAttributes>::Sweep(RecyclerSweep& recyclerSweep, bool queu
     Assert(this->segment != nullptr);
 #if ENABLE_CONCURRENT_GC
     Assert(!this->isPendingConcurrentSweep);
+#endif
+#if ENABLE_LAZY_SWEEP
+    Assert(!this->isPendingLazySweep);
 #endif
     DebugOnly(VerifyMarkBitVector());
 
@@ -1093,6 +1107,19 @@ SmallHeapBlockT<TBlockAttributes>::Sweep(RecyclerSweep& recyclerSweep, bool queu
     }
 #else
     Assert(!recyclerSweep.IsBackground());
+#if ENABLE_LAZY_SWEEP
+    if (queuePendingSweep)
+    {
+        Assert(finalizeCount == 0);
+        Assert(!this->HasPendingDisposeObjects());
+
+        RECYCLER_STATS_INC(recycler, heapBlockConcurrentSweptCount[this->GetHeapBlockType()]);
+        // Leave the objects for the allocator (or the next collection) to sweep,
+        // so the pause doesn't have to walk every block that has garbage in it.
+        this->isPendingLazySweep = true;
+        return SweepStatePendingSweep;
+    }
+#endif
 #endif
 
     SweepObjects<SweepMode_InThread>(recycler);
@@ -1219,6 +1246,9 @@ SmallHeapBlockT<TBlockAttributes>::SweepObjects(Recycler * recycler)
 
         this->lastFreeObjectHead = this->freeObjectList;
     }
+#if ENABLE_LAZY_SWEEP
+    this->isPendingLazySweep = false;
+#endif
 
     RECYCLER_SLOW_CHECK(CheckFreeBitVector(true));
 
@@ -280,6 +280,9 @@ protected:
 #if ENABLE_CONCURRENT_GC
     bool isPendingConcurrentSweep;
 #endif
+#if ENABLE_LAZY_SWEEP
+    bool isPendingLazySweep;
+#endif
 
 public:
     template <typename Fn>
@@ -355,7 +358,7 @@ enum SweepState
     SweepStateSwept,                // the block is partially allocated, no object needs to be swept or finalized
     SweepStateFull,                 // the block is full, no object needs to be swept or finalized
     SweepStatePendingDispose,       // the block has object that needs to be finalized
-#if ENABLE_CONCURRENT_GC
+#if ENABLE_CONCURRENT_GC || ENABLE_LAZY_SWEEP
     SweepStatePendingSweep,         // the block has object that needs to be swept
 #endif
 };
@@ -419,6 +422,9 @@ public:
     ushort oldFreeCount;
 #endif
     bool   isInAllocator;
+#ifdef RECYCLER_STATS
+    bool   isSparseBlock;       // allocated from last at the previous sweep to let it drain
+#endif
 #if DBG
     bool   isClearedFromAllocator;
 
@@ -556,6 +562,9 @@ public:
     SweepState Sweep(RecyclerSweep& recyclerSweep, bool queuePendingSweep, bool allocable, ushort finalizeCount = 0, bool hasPendingDispose = false);
     template <SweepMode mode>
     void SweepObjects(Recycler * recycler);
+#if ENABLE_LAZY_SWEEP
+    void ClearPendingLazySweep() { Assert(this->isPendingLazySweep); this->isPendingLazySweep = false; }
+#endif
 
     uint GetAndClearLastFreeCount();
     void ClearAllAllocBytes();      // Reset all unaccounted alloc bytes and the new alloc count
@@ -167,7 +167,7 @@ HeapBlock::UpdateAttributesOfMarkedObjects(MarkContext * markContext, void * obj
         if (!markContext->GetRecycler()->inPartialCollectMode)
 #endif
         {
-#if ENABLE_CONCURRENT_GC
+#if ENABLE_PARALLEL_MARK
             if (markContext->GetRecycler()->DoQueueTrackedObject())
             {
                 if (!markContext->AddTrackedObject(trackedObject))
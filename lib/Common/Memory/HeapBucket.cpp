@@ -9,6 +9,10 @@ HeapBucket::HeapBucket() :
     heapInfo(nullptr),
     sizeCat(0)
 {
+    allocationStats.allocatedBlockCount = 0;
+    allocationStats.slowAllocCount = 0;
+    allocationStats.allocatedObjectCount = 0;
+
 #ifdef RECYCLER_SLOW_CHECK_ENABLED
     heapBlockCount = 0;
     newHeapBlockCount = 0;
@@ -41,6 +45,9 @@ HeapBucketT<TBlockType>::HeapBucketT() :
     emptyBlockList(nullptr),
     fullBlockList(nullptr),
     heapBlockList(nullptr),
+#if ENABLE_LAZY_SWEEP
+    lazySweepList(nullptr),
+#endif
     explicitFreeList(nullptr),
     lastExplicitFreeListAllocator(nullptr)
 {
@@ -59,6 +66,9 @@ HeapBucketT<TBlockType>::~HeapBucketT()
 {
     DeleteHeapBlockList(this->heapBlockList);
     DeleteHeapBlockList(this->fullBlockList);
+#if ENABLE_LAZY_SWEEP
+    DeleteHeapBlockList(this->lazySweepList);
+#endif
 
     Assert(this->heapBlockCount + this->newHeapBlockCount == 0);
     RECYCLER_SLOW_CHECK(Assert(this->emptyHeapBlockCount == HeapBlockList::Count(this->emptyBlockList)));
@@ -236,7 +246,9 @@ HeapBucketT<TBlockType>::IntegrateBlock(char * blockAddress, PageSegment * segme
     this->fullBlockList = heapBlock;
     RECYCLER_SLOW_CHECK(this->heapBlockCount++);
 
-    this->heapInfo->uncollectedAllocBytes += heapBlock->GetAndClearLastFreeCount() * heapBlock->GetObjectSize();
+    uint lastFreeCount = heapBlock->GetAndClearLastFreeCount();
+    this->heapInfo->uncollectedAllocBytes += lastFreeCount * heapBlock->GetObjectSize();
+    this->AddAllocatedObjectCount(lastFreeCount);
     RecyclerMemoryTracking::ReportAllocation(recycler, blockAddress, heapBlock->GetObjectSize() * heapBlock->GetObjectCount());
     RECYCLER_PERF_COUNTER_ADD(LiveObject,heapBlock->GetObjectCount());
     RECYCLER_PERF_COUNTER_ADD(LiveObjectSize, heapBlock->GetObjectSize() * heapBlock->GetObjectCount());
@@ -297,6 +309,9 @@ HeapBucketT<TBlockType>::GetNonEmptyHeapBlockCount(bool checkCount) const
 {
     size_t currentHeapBlockCount = HeapBlockList::Count(fullBlockList);
     currentHeapBlockCount += HeapBlockList::Count(heapBlockList);
+#if ENABLE_LAZY_SWEEP
+    currentHeapBlockCount += HeapBlockList::Count(lazySweepList);
+#endif
 #if ENABLE_CONCURRENT_GC
     // Recycler can be null if we have OOM in the ctor
     if (this->GetRecycler() && this->GetRecycler()->recyclerSweep != nullptr)
@@ -337,6 +352,18 @@ HeapBucketT<TBlockType>::TryAlloc(Recycler * recycler, TBlockAllocatorType * all
 
         allocator->Set(heapBlock);
     }
+#if ENABLE_LAZY_SWEEP
+    else if (this->lazySweepList != nullptr)
+    {
+        // Out of swept blocks; sweep one the last collection left behind now that we need it
+        {
+            AutoRecyclerTelemetryPhase telemetryPhase(recycler->GetTelemetry(), RecyclerTelemetryPhaseLazySweep);
+            heapBlock = this->SweepLazySweepBlock(recycler);
+        }
+        allocator->Set(heapBlock);
+        this->heapInfo->SweepLazySweepBlocksOnAllocation();
+    }
+#endif
     else if (this->explicitFreeList != nullptr)
     {
         allocator->SetExplicitFreeList(this->explicitFreeList);
@@ -368,6 +395,10 @@ HeapBucketT<TBlockType>::TryAllocFromNewHeapBlock(Recycler * recycler, TBlockAll
     }
 #endif
 
+#if ENABLE_LAZY_SWEEP
+    this->heapInfo->SweepLazySweepBlocksOnAllocation();
+#endif
+
     TBlockType * heapBlock = CreateHeapBlock(recycler);
     if (heapBlock == nullptr)
     {
@@ -401,6 +432,8 @@ HeapBucketT<TBlockType>::SnailAlloc(Recycler * recycler, TBlockAllocatorType * a
     Assert(sizeCat == this->sizeCat);
     Assert((attributes & InternalObjectInfoBitMask) == attributes);
 
+    this->allocationStats.slowAllocCount++;
+
     char * memBlock = this->TryAlloc(recycler, allocator, sizeCat, attributes);
     if (memBlock != nullptr)
     {
@@ -519,6 +552,8 @@ HeapBucketT<TBlockType>::CreateHeapBlock(Recycler * recycler)
         return nullptr;
     }
 
+    this->allocationStats.allocatedBlockCount++;
+
     // Add it to head of heap block list so we will keep track of the block
     recycler->autoHeap.AppendNewHeapBlock(heapBlock, this);
 #ifdef RECYCLER_SLOW_CHECK_ENABLED
@@ -550,7 +585,6 @@ HeapBucketT<TBlockType>::ResetMarks(ResetMarkFlags flags)
 #if !ENABLE_CONCURRENT_GC
     Assert((flags & ResetMarkFlags_Background) == 0);
 #endif
-
     if ((flags & ResetMarkFlags_Background) == 0)
     {
         // The is equivalent to the ClearAllocators in Rescan
@@ -571,6 +605,13 @@ HeapBucketT<TBlockType>::ResetMarks(ResetMarkFlags flags)
         {
             heapBlock->MarkImplicitRoots();
         });
+#if ENABLE_LAZY_SWEEP
+        // Blocks still pending lazy sweep are carried into this collection and swept again with its mark bits
+        HeapBlockList::ForEach(lazySweepList, [flags](TBlockType * heapBlock)
+        {
+            heapBlock->MarkImplicitRoots();
+        });
+#endif
     }
 
 #if DBG
@@ -607,6 +648,13 @@ HeapBucketT<TBlockType>::ScanNewImplicitRoots(Recycler * recycler)
     {
         heapBlock->ScanNewImplicitRoots(recycler);
     });
+
+#if ENABLE_LAZY_SWEEP
+    HeapBlockList::ForEach(lazySweepList, [recycler](TBlockType * heapBlock)
+    {
+        heapBlock->ScanNewImplicitRoots(recycler);
+    });
+#endif
 }
 
 #if DBG
@@ -722,6 +770,146 @@ HeapBucketT<TBlockType>::DoPartialReuseSweep(Recycler * recycler)
 }
 #endif
 
+template <typename TBlockType>
+bool
+HeapBucketT<TBlockType>::DoDrainSparseBlocks(Recycler * recycler)
+{
+    // Leaf objects are the ones most often left scattered over mostly empty blocks (strings, number arrays,
+    // buffers), and leaf blocks are never rescanned, so their allocation order is free to change.
+    return IsLeafBucket && !CUSTOM_PHASE_OFF1(recycler->GetRecyclerFlagsTable(), Js::DrainSparseBlocksPhase);
+}
+
+template <typename TBlockType>
+TBlockType *
+HeapBucketT<TBlockType>::MoveSparseBlocksToEnd(Recycler * recycler, TBlockType * list, uint sparsePercent)
+{
+    // Stable partition of the list, keeping the denser blocks in front
+    TBlockType * denseList = nullptr;
+    TBlockType * denseTail = nullptr;
+    TBlockType * sparseList = nullptr;
+    TBlockType * sparseTail = nullptr;
+
+    HeapBlockList::ForEachEditing(list, [&](TBlockType * heapBlock)
+    {
+        bool const isSparse = (uint)heapBlock->markCount * 100 < (uint)heapBlock->objectCount * sparsePercent;
+#ifdef RECYCLER_STATS
+        heapBlock->isSparseBlock = isSparse;
+        RECYCLER_STATS_INC_IF(isSparse, recycler, numSparseSmallBlocks);
+#endif
+        heapBlock->SetNextBlock(nullptr);
+        TBlockType *& head = isSparse ? sparseList : denseList;
+        TBlockType *& tail = isSparse ? sparseTail : denseTail;
+        if (tail == nullptr)
+        {
+            head = heapBlock;
+        }
+        else
+        {
+            tail->SetNextBlock(heapBlock);
+        }
+        tail = heapBlock;
+    });
+
+    if (denseTail == nullptr)
+    {
+        return sparseList;
+    }
+    denseTail->SetNextBlock(sparseList);
+    return denseList;
+}
+
+#if ENABLE_LAZY_SWEEP
+template <typename TBlockType>
+bool
+HeapBucketT<TBlockType>::DoQueueLazySweep(Recycler * recycler)
+{
+    // Finalizable blocks still need to be swept in thread, so that PrepareFinalize
+    // gets called before any other script can run.
+#ifdef RECYCLER_WRITE_BARRIER
+    return (IsNormalBucket || IsLeafBucket || IsWriteBarrierBucket) && recycler->enableLazySweep;
+#else
+    return (IsNormalBucket || IsLeafBucket) && recycler->enableLazySweep;
+#endif
+}
+
+template <typename TBlockType>
+TBlockType *
+HeapBucketT<TBlockType>::SweepLazySweepBlock(Recycler * recycler)
+{
+    Assert(!this->IsAllocationStopped());
+    Assert(this->nextAllocableBlockHead == nullptr);
+
+    TBlockType * heapBlock = this->lazySweepList;
+    Assert(heapBlock != nullptr);
+    this->lazySweepList = heapBlock->GetNextBlock();
+
+    heapBlock->template SweepObjects<SweepMode_InThread>(recycler);
+    Assert(heapBlock->HasFreeObject());
+
+    // We have allocated from every block in the heap block list already, so putting the
+    // block at the front keeps the blocks before nextAllocableBlockHead the used up ones.
+    heapBlock->SetNextBlock(this->heapBlockList);
+    this->heapBlockList = heapBlock;
+    return heapBlock;
+}
+
+template <typename TBlockType>
+uint
+HeapBucketT<TBlockType>::SweepLazySweepBlocks(Recycler * recycler, uint maxBlockCount)
+{
+    // Sweep up to [maxBlockCount] pending blocks for allocation to use, whether or not this bucket is allocating now
+    TBlockType * list = nullptr;
+    TBlockType * tail = nullptr;
+    uint count = 0;
+    while (count < maxBlockCount && this->lazySweepList != nullptr)
+    {
+        TBlockType * heapBlock = this->lazySweepList;
+        this->lazySweepList = heapBlock->GetNextBlock();
+
+        heapBlock->template SweepObjects<SweepMode_InThread>(recycler);
+        heapBlock->SetNextBlock(nullptr);
+        if (tail == nullptr)
+        {
+            list = heapBlock;
+        }
+        else
+        {
+            tail->SetNextBlock(heapBlock);
+        }
+        tail = heapBlock;
+        count++;
+    }
+
+    if (list != nullptr)
+    {
+        this->AppendAllocableHeapBlockList(list);
+    }
+    return count;
+}
+
+template <typename TBlockType>
+void
+HeapBucketT<TBlockType>::SweepLazySweepList(Recycler * recycler)
+{
+    TBlockType * list = this->lazySweepList;
+    if (list == nullptr)
+    {
+        return;
+    }
+
+    this->lazySweepList = nullptr;
+    HeapBlockList::ForEach(list, [recycler](TBlockType * heapBlock)
+    {
+#ifdef RECYCLER_SERIALIZE_PARALLEL_SWEEP
+        AutoOptionalCriticalSection autoLock(recycler->collectionState == CollectionStateParallelSweep ? &recycler->parallelSweepLock : nullptr);
+#endif
+        heapBlock->template SweepObjects<SweepMode_InThread>(recycler);
+    });
+
+    this->AppendAllocableHeapBlockList(list);
+}
+#endif
+
 template <typename TBlockType>
 void
 HeapBucketT<TBlockType>::SweepHeapBlockList(RecyclerSweep& recyclerSweep, TBlockType * heapBlockList, bool allocable)
@@ -752,6 +940,9 @@ HeapBucketT<TBlockType>::SweepHeapBlockList(RecyclerSweep& recyclerSweep, TBlock
 #if ENABLE_PARTIAL_GC
     // CONCURRENT-TODO: Add a mode where we can do in thread sweep, and concurrent partial sweep?
     bool const queuePendingSweep = this->DoQueuePendingSweep(recycler);
+#elif ENABLE_LAZY_SWEEP
+    // Without background sweep, queue up blocks to be swept on demand instead
+    bool const queuePendingSweep = this->DoQueueLazySweep(recycler);
 #else
     bool const queuePendingSweep = false;
 #endif
@@ -782,6 +973,16 @@ HeapBucketT<TBlockType>::SweepHeapBlockList(RecyclerSweep& recyclerSweep, TBlock
 #endif
             break;
         }
+#elif ENABLE_LAZY_SWEEP
+        case SweepStatePendingSweep:
+        {
+            // blocks that have swept object. Queue up the block to be swept when allocation needs it.
+            Assert(queuePendingSweep);
+            heapBlock->SetNextBlock(this->lazySweepList);
+            this->lazySweepList = heapBlock;
+            this->heapInfo->hasPendingLazySweepHeapBlocks = true;
+            break;
+        }
 #endif
         case SweepStatePendingDispose:
         {
@@ -821,6 +1022,9 @@ HeapBucketT<TBlockType>::SweepHeapBlockList(RecyclerSweep& recyclerSweep, TBlock
         case SweepStateFull:
         {
             Assert(!heapBlock->HasFreeObject());
+#ifdef RECYCLER_STATS
+            heapBlock->isSparseBlock = false;
+#endif
             heapBlock->SetNextBlock(this->fullBlockList);
             this->fullBlockList = heapBlock;
             break;
@@ -837,6 +1041,13 @@ HeapBucketT<TBlockType>::SweepHeapBlockList(RecyclerSweep& recyclerSweep, TBlock
 #endif
 
             RECYCLER_STATS_INC(recycler, numEmptySmallBlocks[heapBlock->GetHeapBlockType()]);
+#ifdef RECYCLER_STATS
+            if (heapBlock->isSparseBlock)
+            {
+                RECYCLER_STATS_INC(recycler, numDrainedSparseSmallBlocks);
+                RECYCLER_STATS_ADD(recycler, drainedSparseSmallBlockPageCount, heapBlock->GetPageCount());
+            }
+#endif
 
 #if ENABLE_CONCURRENT_GC
             // CONCURRENT-TODO: Finalizable block never have background == true and always be processed
@@ -935,6 +1146,47 @@ HeapBucketT<TBlockType>::SweepBucket(RecyclerSweep& recyclerSweep)
 
     this->SweepHeapBlockList(recyclerSweep, currentFullBlockList, false);
 
+#if ENABLE_LAZY_SWEEP
+    // Blocks the last collection left pending haven't been allocated from, so their free bits are still valid.
+    // Sweep them like full blocks with this collection's marks; their old garbage is unmarked and gets freed too.
+    TBlockType * currentLazySweepList = this->lazySweepList;
+    this->lazySweepList = nullptr;
+    if (currentLazySweepList != nullptr)
+    {
+        HeapBlockList::ForEach(currentLazySweepList, [](TBlockType * heapBlock)
+        {
+            heapBlock->ClearPendingLazySweep();
+        });
+#if DBG
+        if (TBlockType::HeapBlockAttributes::IsSmallBlock)
+        {
+            recyclerSweep.SetupVerifyListConsistencyDataForSmallBlock(nullptr, true, false);
+        }
+        else if (TBlockType::HeapBlockAttributes::IsMediumBlock)
+        {
+            recyclerSweep.SetupVerifyListConsistencyDataForMediumBlock(nullptr, true, false);
+        }
+        else
+        {
+            Assert(false);
+        }
+#endif
+        this->SweepHeapBlockList(recyclerSweep, currentLazySweepList, false);
+    }
+#endif
+
+    if (this->DoDrainSparseBlocks(recyclerSweep.GetRecycler()))
+    {
+        // We can't move objects out of a sparse block, since any pointer to them may be a conservative one.
+        // Allocating from these blocks last gives them a chance to empty out and be released instead.
+        Recycler * recycler = recyclerSweep.GetRecycler();
+        uint const sparsePercent = (uint)CONFIG_FLAG(SparseLeafBlockPercent);
+        this->heapBlockList = MoveSparseBlocksToEnd(recycler, this->heapBlockList, sparsePercent);
+#if ENABLE_LAZY_SWEEP
+        this->lazySweepList = MoveSparseBlocksToEnd(recycler, this->lazySweepList, sparsePercent);
+#endif
+    }
+
     // We shouldn't have allocate from any block yet
     Assert(this->nextAllocableBlockHead == nullptr);
 }
@@ -1057,6 +1309,9 @@ template <typename TBlockType>
 void
 HeapBucketT<TBlockType>::EnumerateObjects(ObjectInfoBits infoBits, void (*CallBackFunction)(void * address, size_t size))
 {
+#if ENABLE_LAZY_SWEEP
+    Assert(this->lazySweepList == nullptr);
+#endif
     UpdateAllocators();
     HeapBucket::EnumerateObjects(fullBlockList, infoBits, CallBackFunction);
     HeapBucket::EnumerateObjects(heapBlockList, infoBits, CallBackFunction);
@@ -1084,6 +1339,9 @@ HeapBucketT<TBlockType>::Check(bool checkCount)
     size_t smallHeapBlockCount = HeapInfo::Check(true, false, this->fullBlockList);
     smallHeapBlockCount += HeapInfo::Check(true, false, this->heapBlockList, this->nextAllocableBlockHead);
     smallHeapBlockCount += HeapInfo::Check(false, false, this->nextAllocableBlockHead);
+#if ENABLE_LAZY_SWEEP
+    smallHeapBlockCount += HeapBlockList::Count(this->lazySweepList);
+#endif
     Assert(!checkCount || this->heapBlockCount == smallHeapBlockCount);
     return smallHeapBlockCount;
 }
@@ -1114,6 +1372,9 @@ HeapBucketT<TBlockType>::AggregateBucketStats(HeapBucketStats& stats)
     HeapBlockList::ForEach(emptyBlockList, blockStatsAggregator);
     HeapBlockList::ForEach(fullBlockList, blockStatsAggregator);
     HeapBlockList::ForEach(heapBlockList, blockStatsAggregator);
+#if ENABLE_LAZY_SWEEP
+    HeapBlockList::ForEach(lazySweepList, blockStatsAggregator);
+#endif
 }
 #endif
 
@@ -1182,6 +1443,14 @@ HeapBucketT<TBlockType>::Verify()
             heapBlock->Verify(false);
         }
     });
+
+#if ENABLE_LAZY_SWEEP
+    // Blocks pending lazy sweep aren't allocated from; their unswept objects still look allocated
+    HeapBlockList::ForEach(lazySweepList, [](TBlockType * heapBlock)
+    {
+        heapBlock->Verify(false);
+    });
+#endif
 }
 #endif
 
@@ -1199,6 +1468,12 @@ HeapBucketT<TBlockType>::VerifyMark()
     {
         heapBlock->VerifyMark();
     });
+#if ENABLE_LAZY_SWEEP
+    HeapBlockList::ForEach(this->lazySweepList, [](TBlockType * heapBlock)
+    {
+        heapBlock->VerifyMark();
+    });
+#endif
 }
 #endif
 
@@ -1215,6 +1490,25 @@ HeapBucketGroup<TBlockAttributes>::Initialize(HeapInfo * heapInfo, uint sizeCat)
     finalizableHeapBucket.Initialize(heapInfo, sizeCat);
 }
 
+template <class TBlockAttributes>
+void
+HeapBucketGroup<TBlockAttributes>::AggregateAllocationStats(HeapBucketAllocationStats& stats) const
+{
+    auto add = [&stats](HeapBucket const& bucket)
+    {
+        stats.allocatedBlockCount += bucket.GetAllocationStats().allocatedBlockCount;
+        stats.slowAllocCount += bucket.GetAllocationStats().slowAllocCount;
+        stats.allocatedObjectCount += bucket.GetAllocationStats().allocatedObjectCount;
+    };
+    add(heapBucket);
+    add(leafHeapBucket);
+#ifdef RECYCLER_WRITE_BARRIER
+    add(smallNormalWithBarrierHeapBucket);
+    add(smallFinalizableWithBarrierHeapBucket);
+#endif
+    add(finalizableHeapBucket);
+}
+
 template <class TBlockAttributes>
 void
 HeapBucketGroup<TBlockAttributes>::ResetMarks(ResetMarkFlags flags)
@@ -1269,6 +1563,32 @@ HeapBucketGroup<TBlockAttributes>::Sweep(RecyclerSweep& recyclerSweep)
 #endif
 }
 
+#if ENABLE_LAZY_SWEEP
+template <class TBlockAttributes>
+void
+HeapBucketGroup<TBlockAttributes>::SweepLazySweepList(Recycler * recycler)
+{
+    // Finalizable buckets are always swept in thread, so they never have a lazy sweep list
+    heapBucket.SweepLazySweepList(recycler);
+    leafHeapBucket.SweepLazySweepList(recycler);
+#ifdef RECYCLER_WRITE_BARRIER
+    smallNormalWithBarrierHeapBucket.SweepLazySweepList(recycler);
+#endif
+}
+
+template <class TBlockAttributes>
+uint
+HeapBucketGroup<TBlockAttributes>::SweepLazySweepBlocks(Recycler * recycler, uint maxBlockCount)
+{
+    uint count = heapBucket.SweepLazySweepBlocks(recycler, maxBlockCount);
+    count += leafHeapBucket.SweepLazySweepBlocks(recycler, maxBlockCount - count);
+#ifdef RECYCLER_WRITE_BARRIER
+    count += smallNormalWithBarrierHeapBucket.SweepLazySweepBlocks(recycler, maxBlockCount - count);
+#endif
+    return count;
+}
+#endif
+
 // Sweep finalizable objects first to ensure that if they reference any other
 // objects in the finalizer - they are valid
 template <class TBlockAttributes>
@@ -59,6 +59,14 @@ public:
 
 #endif
 
+// Allocation activity of a bucket since the recycler was created
+struct HeapBucketAllocationStats
+{
+    size_t allocatedBlockCount;     // heap blocks that were given pages
+    size_t slowAllocCount;          // allocations that had to go through SnailAlloc
+    size_t allocatedObjectCount;    // objects allocated from blocks an allocator has finished with
+};
+
 // NOTE: HeapBucket can't have vtable, because we allocate them inline with recycler with custom initializer
 class HeapBucket
 {
@@ -67,6 +75,8 @@ public:
 
     uint GetBucketIndex() const;
     uint GetMediumBucketIndex() const;
+    HeapBucketAllocationStats const& GetAllocationStats() const { return allocationStats; }
+    void AddAllocatedObjectCount(uint count) { allocationStats.allocatedObjectCount += count; }
 
     template <typename TBlockType>
     static void EnumerateObjects(TBlockType * heapBlockList, ObjectInfoBits infoBits, void(*CallBackFunction)(void * address, size_t size));
@@ -74,6 +84,7 @@ public:
 protected:
     HeapInfo * heapInfo;
     uint sizeCat;
+    HeapBucketAllocationStats allocationStats;
 
 #ifdef RECYCLER_SLOW_CHECK_ENABLED
     size_t heapBlockCount;
@@ -199,6 +210,14 @@ protected:
     bool DoQueuePendingSweep(Recycler * recycler);
     bool DoPartialReuseSweep(Recycler * recycler);
 #endif
+    bool DoDrainSparseBlocks(Recycler * recycler);
+    static TBlockType * MoveSparseBlocksToEnd(Recycler * recycler, TBlockType * list, uint sparsePercent);
+#if ENABLE_LAZY_SWEEP
+    bool DoQueueLazySweep(Recycler * recycler);
+    TBlockType * SweepLazySweepBlock(Recycler * recycler);
+    uint SweepLazySweepBlocks(Recycler * recycler, uint maxBlockCount);
+    void SweepLazySweepList(Recycler * recycler);
+#endif
 
     // Partial/Concurrent GC
     void EnumerateObjects(ObjectInfoBits infoBits, void (*CallBackFunction)(void * address, size_t size));
@@ -231,6 +250,9 @@ protected:
 
     TBlockType * fullBlockList;      // list of blocks that are fully allocated
     TBlockType * heapBlockList;      // list of blocks that has free objects
+#if ENABLE_LAZY_SWEEP
+    TBlockType * lazySweepList;      // list of blocks that has objects left to be swept on demand
+#endif
 
     FreeObject* explicitFreeList; // List of objects that have been explicitly freed
     TBlockAllocatorType * lastExplicitFreeListAllocator;
@@ -405,6 +405,10 @@ HeapInfo::HeapInfo() :
     uncollectedAllocBytes(0),
     lastUncollectedAllocBytes(0),
     pendingZeroPageCount(0)
+#if ENABLE_LAZY_SWEEP
+    , hasPendingLazySweepHeapBlocks(false)
+    , lazySweepBucketCursor(0)
+#endif
 #ifdef RECYCLER_PAGE_HEAP
     , pageHeapMode(PageHeapMode::PageHeapModeOff)
     , isPageHeapEnabled(false)
@@ -948,6 +952,9 @@ HeapInfo::Sweep(RecyclerSweep& recyclerSweep, bool concurrent)
 #ifdef RECYCLER_STATS
     memset(&recycler->collectionStats.numEmptySmallBlocks, 0, sizeof(recycler->collectionStats.numEmptySmallBlocks));
     recycler->collectionStats.numZeroedOutSmallBlocks = 0;
+    recycler->collectionStats.numSparseSmallBlocks = 0;
+    recycler->collectionStats.numDrainedSparseSmallBlocks = 0;
+    recycler->collectionStats.drainedSparseSmallBlockPageCount = 0;
 #endif
 
     RECYCLER_SLOW_CHECK(VerifySmallHeapBlockCount());
@@ -1079,6 +1086,20 @@ void DumpBucket(uint bucketIndex, typename SmallHeapBlockType<TBucketType, TBloc
     Output::Print(_u("%d,%d,%d,%d,%d,%d,%d\n"), stats.totalBlockCount, stats.finalizeBlockCount, stats.emptyBlockCount, stats.objectCount, stats.finalizeCount, stats.objectByteCount, stats.totalByteCount);
 }
 
+void
+HeapInfo::DumpAllocationHistogram() const
+{
+    Output::Print(_u("[ALLOC %d] Allocation Histogram\n"), ::GetTickCount());
+    Output::Print(_u("SizeCat,Allocated Block Count,Slow Alloc Count,Allocated Object Count\n"));
+    this->MapAllocationStats([](uint sizeCat, HeapBucketAllocationStats const& stats)
+    {
+        if (stats.allocatedBlockCount != 0 || stats.slowAllocCount != 0)
+        {
+            Output::Print(_u("%d,%d,%d,%d\n"), sizeCat, stats.allocatedBlockCount, stats.slowAllocCount, stats.allocatedObjectCount);
+        }
+    });
+}
+
 #ifdef DUMP_FRAGMENTATION_STATS
 void
 HeapInfo::DumpFragmentationStats()
@@ -1171,6 +1192,81 @@ HeapInfo::PrepareSweep()
 }
 #endif
 
+#if ENABLE_LAZY_SWEEP
+void
+HeapInfo::SweepLazySweepBuckets(LONG volatile * nextBucketIndex)
+{
+    // Called on each thread taking part in finishing the lazy sweep; buckets are handed out one at a time.
+    uint const smallBucketCount = HeapConstants::BucketCount;
+#if defined(BUCKETIZE_MEDIUM_ALLOCATIONS) && SMALLBLOCK_MEDIUM_ALLOC
+    uint const bucketCount = smallBucketCount + HeapConstants::MediumBucketCount;
+#else
+    uint const bucketCount = smallBucketCount;
+#endif
+
+    uint i;
+    while ((i = (uint)::InterlockedIncrement(nextBucketIndex) - 1) < bucketCount)
+    {
+        if (i < smallBucketCount)
+        {
+            heapBuckets[i].SweepLazySweepList(this->recycler);
+        }
+#if defined(BUCKETIZE_MEDIUM_ALLOCATIONS) && SMALLBLOCK_MEDIUM_ALLOC
+        else
+        {
+            mediumHeapBuckets[i - smallBucketCount].SweepLazySweepList(this->recycler);
+        }
+#endif
+    }
+}
+
+void
+HeapInfo::SweepLazySweepBlocksOnAllocation()
+{
+    // Allocation is taking another block. Sweep a few of the pending blocks of any bucket along with it,
+    // so blocks that allocation never comes back for don't wait for the next collection to sweep them.
+    if (!this->hasPendingLazySweepHeapBlocks || this->recycler->CollectionInProgress())
+    {
+        return;
+    }
+
+    AutoRecyclerTelemetryPhase telemetryPhase(this->recycler->GetTelemetry(), RecyclerTelemetryPhaseLazySweep);
+
+    uint const smallBucketCount = HeapConstants::BucketCount;
+#if defined(BUCKETIZE_MEDIUM_ALLOCATIONS) && SMALLBLOCK_MEDIUM_ALLOC
+    uint const bucketCount = smallBucketCount + HeapConstants::MediumBucketCount;
+#else
+    uint const bucketCount = smallBucketCount;
+#endif
+
+    uint remaining = LazySweepBlocksPerAllocation;
+    for (uint visited = 0; visited < bucketCount; visited++)
+    {
+        uint i = this->lazySweepBucketCursor;
+        if (i < smallBucketCount)
+        {
+            remaining -= heapBuckets[i].SweepLazySweepBlocks(this->recycler, remaining);
+        }
+#if defined(BUCKETIZE_MEDIUM_ALLOCATIONS) && SMALLBLOCK_MEDIUM_ALLOC
+        else
+        {
+            remaining -= mediumHeapBuckets[i - smallBucketCount].SweepLazySweepBlocks(this->recycler, remaining);
+        }
+#endif
+
+        if (remaining == 0)
+        {
+            // This bucket may have more; continue from it next time
+            return;
+        }
+        this->lazySweepBucketCursor = (i + 1) % bucketCount;
+    }
+
+    // Went through every bucket without filling the quota, so nothing is pending any more
+    this->hasPendingLazySweepHeapBlocks = false;
+}
+#endif
+
 #if ENABLE_CONCURRENT_GC
 void
 HeapInfo::SweepPendingObjects(RecyclerSweep& recyclerSweep)
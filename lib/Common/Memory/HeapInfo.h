@@ -50,6 +50,11 @@ public:
     void DumpFragmentationStats();
 #endif
 
+    // Allocation histogram of the small (and medium) size classes
+    template <typename Fn>
+    void MapAllocationStats(Fn fn) const;
+    void DumpAllocationHistogram() const;
+
     template <ObjectInfoBits attributes, bool nothrow>
     char * MediumAlloc(Recycler * recycler, size_t sizeCat, size_t size);
 
@@ -72,6 +77,10 @@ public:
     size_t Rescan(RescanFlags flags);
 #if ENABLE_PARTIAL_GC || ENABLE_CONCURRENT_GC
     void SweepPendingObjects(RecyclerSweep& recyclerSweep);
+#endif
+#if ENABLE_LAZY_SWEEP
+    void SweepLazySweepBuckets(LONG volatile * nextBucketIndex);
+    void SweepLazySweepBlocksOnAllocation();
 #endif
     void Sweep(RecyclerSweep& recyclerSweep, bool concurrent);
 
@@ -357,6 +366,14 @@ private:
     size_t lastUncollectedAllocBytes;
     size_t uncollectedExternalBytes;
     uint pendingZeroPageCount;
+#if ENABLE_LAZY_SWEEP
+    bool hasPendingLazySweepHeapBlocks;
+    uint lazySweepBucketCursor;             // bucket SweepLazySweepBlocksOnAllocation continues from
+
+    // Pending blocks swept along with every block allocation takes. Allocation usually takes far more blocks
+    // between two collections than are left pending, so this finishes the sweep well before the next pause.
+    static const uint LazySweepBlocksPerAllocation = 2;
+#endif
 #if ENABLE_PARTIAL_GC
     size_t uncollectedNewPageCount;
     size_t unusedPartialCollectFreeBytes;
@@ -641,4 +658,25 @@ HeapInfo::GetBlockInfo<MediumAllocationBlockAttributes>(uint objectSize)
     return mediumAllocValidPointersMap.GetBlockInfo(GetMediumBucketIndex(objectSize));
 }
 
+template <typename Fn>
+inline void
+HeapInfo::MapAllocationStats(Fn fn) const
+{
+    for (uint i = 0; i < HeapConstants::BucketCount; i++)
+    {
+        HeapBucketAllocationStats stats = { 0 };
+        heapBuckets[i].AggregateAllocationStats(stats);
+        fn(GetObjectSizeForBucketIndex<SmallAllocationBlockAttributes>(i), stats);
+    }
+
+#if defined(BUCKETIZE_MEDIUM_ALLOCATIONS) && SMALLBLOCK_MEDIUM_ALLOC
+    for (uint i = 0; i < HeapConstants::MediumBucketCount; i++)
+    {
+        HeapBucketAllocationStats stats = { 0 };
+        mediumHeapBuckets[i].AggregateAllocationStats(stats);
+        fn(GetObjectSizeForBucketIndex<MediumAllocationBlockAttributes>(i), stats);
+    }
+#endif
+}
+
 }
@@ -19,6 +19,8 @@ private:
 
 public:
     static const int MarkCandidateSize = sizeof(MarkCandidate);
+    typedef PageStack<MarkCandidate>::StealState StealState;
+    static const uint MaxSplitTargets = PageStack<MarkCandidate>::MaxSplitTargets;
 
     MarkContext(Recycler * recycler, PagePool * pagePool);
     ~MarkContext();
@@ -29,7 +31,7 @@ public:
     Recycler * GetRecycler() { return this->recycler; }
 
     bool AddMarkedObject(void * obj, size_t byteCount);
-#if ENABLE_CONCURRENT_GC
+#if ENABLE_PARALLEL_MARK
     bool AddTrackedObject(FinalizableObject * obj);
 #endif
 
@@ -49,6 +51,11 @@ public:
 
     uint Split(uint targetCount, __in_ecount(targetCount) MarkContext ** targetContexts);
 
+    // Work stealing between parallel mark contexts (see PageStack::Steal)
+    void SetStealState(StealState * stealState) { markStack.SetStealState(stealState); }
+    bool HasStealState() const { return markStack.HasStealState(); }
+    bool StealMarkWork(StealState * victimState) { return markStack.Steal(victimState); }
+
     void Abort();
     void Release();
 
@@ -27,14 +27,12 @@ bool MarkContext::AddMarkedObject(void * objectAddress, size_t objectSize)
     return markStack.Push(markCandidate);
 }
 
-#if ENABLE_CONCURRENT_GC
+#if ENABLE_PARALLEL_MARK
 inline
 bool MarkContext::AddTrackedObject(FinalizableObject * obj)
 {
     Assert(obj != nullptr);
-#if ENABLE_CONCURRENT_GC
     Assert(recycler->DoQueueTrackedObject());
-#endif
 #if ENABLE_PARTIAL_GC
     Assert(!recycler->inPartialCollectMode);
 #endif
@@ -142,8 +140,10 @@ void MarkContext::Mark(void * candidate, void * parentReference)
 inline
 void MarkContext::MarkTrackedObject(FinalizableObject * trackedObject)
 {
-#if ENABLE_CONCURRENT_GC
+#if ENABLE_PARALLEL_MARK
     Assert(!recycler->queueTrackedObject);
+#endif
+#if ENABLE_CONCURRENT_GC
     Assert(!recycler->IsConcurrentExecutingState());
 #endif
 #if ENABLE_PARTIAL_GC
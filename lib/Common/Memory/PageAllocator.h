@@ -376,6 +376,10 @@ public:
 
     static size_t GetAndResetMaxUsedBytes();
 
+    size_t GetUsedBytes() const { return usedBytes; }
+    size_t GetReservedBytes() const { return reservedBytes; }
+    size_t GetCommittedBytes() const { return committedBytes; }
+
 #if ENABLE_BACKGROUND_PAGE_FREEING
     struct BackgroundPageQueue
     {
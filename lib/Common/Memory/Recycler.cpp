@@ -25,6 +25,10 @@
 
 DEFINE_RECYCLER_TRACKER_PERF_COUNTER(RecyclerWeakReferenceBase);
 
+#if ENABLE_PARALLEL_MARK
+const uint Recycler::MaxParallelism;
+#endif
+
 #ifdef PROFILE_RECYCLER_ALLOC
 struct UnallocatedPortionOfBumpAllocatedBlock
 {
@@ -159,20 +163,15 @@ Recycler::Recycler(AllocationPolicyManager * policyManager, IdleDecommitPageAllo
     backgroundFinishMarkCount(0),
     hasPendingUnpinnedObject(false),
     hasPendingConcurrentFindRoot(false),
-    queueTrackedObject(false),
     enableConcurrentMark(false),  // Default to non-concurrent
-    enableParallelMark(false),
     enableConcurrentSweep(false),
     concurrentThread(NULL),
     concurrentWorkReadyEvent(NULL),
     concurrentWorkDoneEvent(NULL),
-    parallelThread1(this, &Recycler::ParallelWorkFunc<0>),
-    parallelThread2(this, &Recycler::ParallelWorkFunc<1>),
     priorityBoost(false),
     isAborting(false),
 #if DBG
     concurrentThreadExited(true),
-    isProcessingTrackedObjects(false),
     hasIncompleteDoCollect(false),
     isConcurrentGCOnIdle(false),
     isFinishGCOnIdle(false),
@@ -181,6 +180,39 @@ Recycler::Recycler(AllocationPolicyManager * policyManager, IdleDecommitPageAllo
     concurrentIdleDecommitEvent(nullptr),
 #endif
 #endif
+#if ENABLE_PARALLEL_MARK
+    queueTrackedObject(false),
+    enableParallelMark(false),
+    maxParallelism(1),
+    extraParallelMarkerCount(0),
+    parallelMarkStealContextCount(0),
+    parallelMarkParticipantCount(0),
+    parallelMarkIdleCount(0),
+    parallelMarkWorkAvailableEvent(NULL),
+    parallelMarkWaiterCount(0),
+    parallelThread1(this, &Recycler::ParallelWorkFunc, 2),
+    parallelThread2(this, &Recycler::ParallelWorkFunc, 3),
+#if !ENABLE_CONCURRENT_GC
+    parallelThread3(this, &Recycler::ParallelWorkFunc, 0),
+#endif
+#if DBG
+    isProcessingTrackedObjects(false),
+#endif
+#endif
+#if ENABLE_LAZY_SWEEP
+    enableLazySweep(false),
+    enableParallelSweep(false),
+    lazySweepBucketIndex(0),
+#endif
+    enablePreciseStackScan(false),
+    enableLargeCollectionBudget(false),
+#ifdef LEAK_REPORT
+    leakReportStackScanCount(0),
+    leakReportStackConservativeBytes(0),
+    leakReportStackPreciseBytes(0),
+    leakReportStackSkippedBytes(0),
+    leakReportStackSkippedCandidateCount(0),
+#endif
 #if DBG
     isExternalStackSkippingGC(false),
     isProcessingRescan(false),
@@ -509,11 +541,30 @@ Recycler::~Recycler()
     recyclerWithBarrierPageAllocator.Close();
 #endif
 
+#if ENABLE_PARALLEL_MARK && !ENABLE_CONCURRENT_GC
+    this->ShutdownParallelThreads();
+#endif
+
     markContext.Release();
     parallelMarkContext1.Release();
     parallelMarkContext2.Release();
     parallelMarkContext3.Release();
 
+#if ENABLE_PARALLEL_MARK
+    for (uint i = 0; i < this->extraParallelMarkerCount; i++)
+    {
+        this->extraParallelMarkers[i]->markContext.Release();
+        HeapDelete(this->extraParallelMarkers[i]);
+    }
+    this->extraParallelMarkerCount = 0;
+
+    if (this->parallelMarkWorkAvailableEvent != NULL)
+    {
+        CloseHandle(this->parallelMarkWorkAvailableEvent);
+        this->parallelMarkWorkAvailableEvent = NULL;
+    }
+#endif
+
     // Clean up the weak reference map so that
     // objects being finalized can safely refer to weak references
     // (this could otherwise become a problem for weak references held
@@ -824,11 +875,56 @@ Recycler::Initialize(const bool forceInThread, JsUtil::ThreadService *threadServ
 
     bool needWriteWatch = false;
 
-#if ENABLE_CONCURRENT_GC
-    // Default to non-concurrent
+#if ENABLE_PARALLEL_MARK
+    // One marker per physical processor. Past the first four, each one needs a mark context and thread of its own,
+    // which are created by the first parallel mark that uses them (see EnsureExtraParallelMarkers).
     uint numProcs = (uint)AutoSystemInfo::Data.GetNumberOfPhysicalProcessors();
-    this->maxParallelism = (numProcs > 4) || CUSTOM_PHASE_FORCE1(GetRecyclerFlagsTable(), Js::ParallelMarkPhase) ? 4 : numProcs;
+#ifdef ENABLE_DEBUG_CONFIG_OPTIONS
+    if (GetRecyclerFlagsTable().IsEnabled(Js::ParallelMarkThreadCountFlag) && GetRecyclerFlagsTable().ParallelMarkThreadCount > 0)
+    {
+        numProcs = (uint)GetRecyclerFlagsTable().ParallelMarkThreadCount;
+    }
+#endif
+    this->maxParallelism = min(numProcs, Recycler::MaxParallelism);
+    if (CUSTOM_PHASE_FORCE1(GetRecyclerFlagsTable(), Js::ParallelMarkPhase))
+    {
+        this->maxParallelism = max(this->maxParallelism, 4u);
+    }
+#endif
 
+#if !ENABLE_CONCURRENT_GC && ENABLE_PARALLEL_MARK
+    // Without concurrent GC every collection marks in thread, but the mark itself can still be
+    // spread over parallel threads. They are created on demand by the first parallel mark.
+    if (!forceInThread && this->maxParallelism > 1)
+    {
+        this->threadService = threadService;
+#if ENABLE_DEBUG_CONFIG_OPTIONS
+        this->enableParallelMark = !CUSTOM_PHASE_OFF1(GetRecyclerFlagsTable(), Js::ParallelMarkPhase);
+#else
+        this->enableParallelMark = true;
+#endif
+    }
+#endif
+
+#if ENABLE_LAZY_SWEEP
+    // Sweeping left to the allocator finishes before the next mark; the parallel threads can help with that.
+#if ENABLE_DEBUG_CONFIG_OPTIONS
+    this->enableLazySweep = !CUSTOM_PHASE_OFF1(GetRecyclerFlagsTable(), Js::LazySweepPhase);
+    this->enableParallelSweep = this->enableLazySweep && this->enableParallelMark && !CUSTOM_PHASE_OFF1(GetRecyclerFlagsTable(), Js::ParallelSweepPhase);
+#else
+    this->enableLazySweep = true;
+    this->enableParallelSweep = this->enableParallelMark;
+#endif
+#endif
+
+#if ENABLE_DEBUG_CONFIG_OPTIONS
+    this->enablePreciseStackScan = !CUSTOM_PHASE_OFF1(GetRecyclerFlagsTable(), Js::PreciseStackScanPhase);
+#else
+    this->enablePreciseStackScan = true;
+#endif
+
+#if ENABLE_CONCURRENT_GC
+    // Default to non-concurrent
     if (forceInThread)
     {
         // Requested a non-concurrent recycler
@@ -1265,6 +1361,7 @@ Recycler::LargeAlloc(HeapInfo* heap, size_t size, ObjectInfoBits attributes)
         }
     }
     autoHeap.uncollectedAllocBytes += size;
+    this->telemetry.RecordLargeObjectAllocation(size);
     return addr;
 }
 
@@ -1519,7 +1616,38 @@ Recycler::ScanStack()
     END_DUMP_OBJECT(this);
 
     BEGIN_DUMP_OBJECT(this, _u("Stack"));
-    ScanMemoryInline((void**) stackTop, stackScanned);
+    if (this->enablePreciseStackScan)
+    {
+        // Let the runtime describe the parts of the stack it knows the layout of (interpreter frames),
+        // and only scan the native frames in between conservatively.
+        RecyclerScanStackCallback scanStack(this, (void **)stackTop, (void **)stackStart);
+        collectionWrapper->EnumerateStackRanges(scanStack);
+        scanStack.Finish();
+        stackScanned = scanStack.GetConservativeByteCount() + scanStack.GetPreciseByteCount();
+
+        RECYCLER_STATS_ADD(this, stackConservativeBytes, scanStack.GetConservativeByteCount());
+        RECYCLER_STATS_ADD(this, stackPreciseBytes, scanStack.GetPreciseByteCount());
+        RECYCLER_STATS_ADD(this, stackSkippedBytes, scanStack.GetSkippedByteCount());
+        RECYCLER_STATS_ADD(this, stackRangeCount, scanStack.GetRangeCount());
+        RECYCLER_STATS_ADD(this, stackOutOfOrderRangeCount, scanStack.GetOutOfOrderRangeCount());
+#ifdef LEAK_REPORT
+        this->leakReportStackPreciseBytes += scanStack.GetPreciseByteCount();
+        this->leakReportStackSkippedBytes += scanStack.GetSkippedByteCount();
+        this->leakReportStackSkippedCandidateCount += scanStack.GetSkippedCandidateCount();
+        this->leakReportStackConservativeBytes += scanStack.GetConservativeByteCount();
+#endif
+    }
+    else
+    {
+        ScanMemoryInline((void**) stackTop, stackScanned);
+        RECYCLER_STATS_ADD(this, stackConservativeBytes, stackScanned);
+#ifdef LEAK_REPORT
+        this->leakReportStackConservativeBytes += stackScanned;
+#endif
+    }
+#ifdef LEAK_REPORT
+    this->leakReportStackScanCount++;
+#endif
     END_DUMP_OBJECT(this);
 
 #if DBG_DUMP
@@ -1592,6 +1720,88 @@ RecyclerScanMemoryCallback::operator()(void** obj, size_t byteCount)
     this->recycler->ScanMemoryInline(obj, byteCount);
 }
 
+RecyclerScanStackCallback::RecyclerScanStackCallback(Recycler* recycler, void ** stackTop, void ** stackBase) :
+    recycler(recycler),
+    stackTop(stackTop),
+    current(stackTop),
+    stackBase(stackBase),
+    conservativeByteCount(0),
+    preciseByteCount(0),
+    skippedByteCount(0),
+    rangeCount(0),
+    outOfOrderRangeCount(0)
+#ifdef LEAK_REPORT
+    , skippedCandidateCount(0)
+#endif
+{
+    Assert(stackTop <= stackBase);
+}
+
+void
+RecyclerScanStackCallback::operator()(void ** liveSlots, size_t liveByteCount, size_t deadByteCount)
+{
+    Assert(liveByteCount % sizeof(void *) == 0);
+    Assert(deadByteCount % sizeof(void *) == 0);
+
+    void ** deadSlots = liveSlots + liveByteCount / sizeof(void *);
+    void ** end = deadSlots + deadByteCount / sizeof(void *);
+    if (end <= this->stackTop || liveSlots >= this->stackBase)
+    {
+        // Not on the stack (e.g. generator frames), these slots are scanned with the object holding them
+        return;
+    }
+
+    if (liveSlots < this->current || end > this->stackBase)
+    {
+        // Part of this range was already scanned, or skipped as the dead slots of an earlier range.
+        // Scan its live slots conservatively so none are missed; the bytes after this->current
+        // are still scanned conservatively too, as if the range had not been reported.
+        AssertMsg(false, "Stack ranges must be reported in increasing address order and end on the stack");
+        this->recycler->ScanMemoryInline(liveSlots, liveByteCount);
+        this->conservativeByteCount += liveByteCount;
+        this->outOfOrderRangeCount++;
+        return;
+    }
+
+    size_t nativeByteCount = (char *)liveSlots - (char *)this->current;
+    this->recycler->ScanMemoryInline(this->current, nativeByteCount);
+    this->conservativeByteCount += nativeByteCount;
+
+    // The slots only ever point to the start of an object, so interior pointers need not be considered
+    // even if the host asked for them.
+    if (liveByteCount != 0)
+    {
+        this->recycler->markContext.ScanMemory<false, false>(liveSlots, liveByteCount);
+        this->preciseByteCount += liveByteCount;
+    }
+
+#ifdef LEAK_REPORT
+    if (this->recycler->GetRecyclerFlagsTable().IsEnabled(Js::LeakReportFlag))
+    {
+        for (void ** slot = deadSlots; slot < end; slot++)
+        {
+            if (this->recycler->FindHeapBlock(*slot) != nullptr)
+            {
+                this->skippedCandidateCount++;
+            }
+        }
+    }
+#endif
+    this->skippedByteCount += deadByteCount;
+    this->rangeCount++;
+    this->current = end;
+}
+
+size_t
+RecyclerScanStackCallback::Finish()
+{
+    size_t nativeByteCount = (char *)this->stackBase - (char *)this->current;
+    this->recycler->ScanMemoryInline(this->current, nativeByteCount);
+    this->conservativeByteCount += nativeByteCount;
+    this->current = this->stackBase;
+    return this->conservativeByteCount;
+}
+
 size_t
 Recycler::FindRoots()
 {
@@ -1821,6 +2031,9 @@ void
 Recycler::ResetMarks(ResetMarkFlags flags)
 {
     Assert(!this->CollectionInProgress());
+
+    // Blocks still pending lazy sweep aren't swept here. They are marked with the rest of the heap
+    // and swept with this collection's mark bits, which frees the previous collection's garbage too.
     collectionState = CollectionStateResetMarks;
 
     RecyclerVerboseTrace(GetRecyclerFlagsTable(), _u("Reset marks\n"));
@@ -1843,6 +2056,75 @@ Recycler::ResetMarks(ResetMarkFlags flags)
 #endif
 }
 
+#if ENABLE_LAZY_SWEEP
+void
+Recycler::FinishLazySweep()
+{
+    if (!autoHeap.hasPendingLazySweepHeapBlocks)
+    {
+        return;
+    }
+
+    RECYCLER_PROFILE_EXEC_BEGIN(this, Js::LazySweepPhase);
+    AutoRecyclerTelemetryPhase telemetryPhase(this->telemetry, RecyclerTelemetryPhaseLazySweep);
+
+    bool parallel = this->enableParallelSweep;
+#ifdef ENABLE_JS_ETW
+    // NotifyFree appends every swept object to one ETW record, so stay in thread while that is traced
+    parallel = parallel && !EventEnabledJSCRIPT_RECYCLER_FREE_MEMORY();
+#endif
+
+    this->lazySweepBucketIndex = 0;
+    if (parallel)
+    {
+        this->DoParallelLazySweep();
+    }
+    else
+    {
+        autoHeap.SweepLazySweepBuckets(&this->lazySweepBucketIndex);
+    }
+    autoHeap.hasPendingLazySweepHeapBlocks = false;
+
+    RECYCLER_PROFILE_EXEC_END(this, Js::LazySweepPhase);
+}
+
+void
+Recycler::DoParallelLazySweep()
+{
+    Assert(this->enableParallelSweep);
+    Assert(this->enableParallelMark);
+    Assert(this->maxParallelism > 1 && this->maxParallelism <= Recycler::MaxParallelism);
+    Assert(!this->CollectionInProgress());
+
+    // Each bucket only touches its own blocks, so the threads just claim buckets until there are none left.
+    // Every mark thread but the main thread's (context 1) helps; the extra markers only exist once a mark has used them.
+    this->collectionState = CollectionStateParallelSweep;
+
+    // If a thread fails to start, the ones after it aren't tried either.
+    uint threadCount = min(this->maxParallelism, 4 + this->extraParallelMarkerCount);
+    for (uint i = 0; i < threadCount; i++)
+    {
+        if (i != 1 && !this->GetParallelMarkThread(i)->StartConcurrent())
+        {
+            threadCount = i;
+            break;
+        }
+    }
+
+    autoHeap.SweepLazySweepBuckets(&this->lazySweepBucketIndex);
+
+    for (uint i = 0; i < threadCount; i++)
+    {
+        if (i != 1)
+        {
+            this->GetParallelMarkThread(i)->WaitForConcurrent();
+        }
+    }
+
+    this->collectionState = CollectionStateNotCollecting;
+}
+#endif
+
 #ifdef RECYCLER_MARK_TRACK
 void Recycler::ClearMarkMap()
 {
@@ -1905,7 +2187,7 @@ template <bool parallel, bool interior>
 void
 Recycler::ProcessMarkContext(MarkContext * markContext)
 {
-#if ENABLE_CONCURRENT_GC
+#if ENABLE_PARALLEL_MARK
     // Copying the markContext onto the stack messes up tracked object handling, because
     // the tracked object will call TryMark[Non]Interior to report its references.
     // These functions implicitly use the main markContext on the Recycler, but this will
@@ -1915,6 +2197,8 @@ Recycler::ProcessMarkContext(MarkContext * markContext)
     // In this case we shouldn't be parallel anyway, so we don't need to worry about cache behavior.
     // We should revisit how we manage markContexts in general in the future, and clean this up
     // by passing the MarkContext through to the tracked object's Mark method.
+    // Contexts taking part in work stealing are copied too; other threads only steal through the context's
+    // steal state, which stays where it is.
 #if ENABLE_PARTIAL_GC
     if (this->inPartialCollectMode || DoQueueTrackedObject())
 #else
@@ -1943,7 +2227,14 @@ Recycler::ProcessMarkContext(MarkContext * markContext)
     else
 #endif
     {
+        // Parallel marking relies on tracked objects being queued rather than marked right away
+#if !ENABLE_PARALLEL_MARK
         Assert(!parallel);
+#elif ENABLE_PARTIAL_GC
+        Assert(!parallel || this->inPartialCollectMode || DoQueueTrackedObject());
+#else
+        Assert(!parallel || DoQueueTrackedObject());
+#endif
         markContext->ProcessMark<parallel, interior>();
     }
 }
@@ -2000,14 +2291,22 @@ Recycler::ProcessParallelMark(bool background, MarkContext * markContext)
 
     RECYCLER_PROFILE_EXEC_THREAD_BEGIN(background, this, Js::MarkPhase);
 
-    if (this->enableScanInteriorPointers)
-    {
-        this->ProcessMarkContext</* parallel */ true, /* interior */ true>(markContext);
-    }
-    else
+    do
     {
-        this->ProcessMarkContext</* parallel */ true, /* interior */ false>(markContext);
+        if (this->enableScanInteriorPointers)
+        {
+            this->ProcessMarkContext</* parallel */ true, /* interior */ true>(markContext);
+        }
+        else
+        {
+            this->ProcessMarkContext</* parallel */ true, /* interior */ false>(markContext);
+        }
     }
+#if ENABLE_PARALLEL_MARK
+    while (!background && this->StealParallelMarkWork(markContext));
+#else
+    while (false);
+#endif
 
     RECYCLER_PROFILE_EXEC_THREAD_END(background, this, Js::MarkPhase);
 
@@ -2025,12 +2324,15 @@ void
 Recycler::Mark()
 {
     // Marking in thread, we can just pre-mark them
-    ResetMarks(this->enableScanImplicitRoots ? ResetMarkFlags_InThreadImplicitRoots : ResetMarkFlags_InThread);
+    {
+        AutoRecyclerTelemetryPhase telemetryPhase(this->telemetry, RecyclerTelemetryPhaseMark);
+        ResetMarks(this->enableScanImplicitRoots ? ResetMarkFlags_InThreadImplicitRoots : ResetMarkFlags_InThread);
+    }
     collectionState = CollectionStateFindRoots;
     RootMark(CollectionStateMark);
 }
 
-#if ENABLE_CONCURRENT_GC
+#if ENABLE_PARALLEL_MARK
 void
 Recycler::StartQueueTrackedObject()
 {
@@ -2046,7 +2348,9 @@ Recycler::StartQueueTrackedObject()
 bool
 Recycler::DoQueueTrackedObject() const
 {
+#if ENABLE_CONCURRENT_GC
     Assert(this->queueTrackedObject || !this->IsConcurrentMarkState());
+#endif
     Assert(this->queueTrackedObject || this->isProcessingTrackedObjects || !this->HasPendingTrackObjects());
 #if ENABLE_PARTIAL_GC
     Assert(this->queueTrackedObject || this->inPartialCollectMode || !(this->collectionState == CollectionStateParallelMark));
@@ -2255,19 +2559,27 @@ Recycler::FinishMark(DWORD waitTime)
     return scannedRootBytes;
 }
 
-#if ENABLE_CONCURRENT_GC
+#if ENABLE_PARALLEL_MARK
 void
 Recycler::DoParallelMark()
 {
     Assert(this->enableParallelMark);
-    Assert(this->maxParallelism > 1 && this->maxParallelism <= 4);
+    Assert(this->maxParallelism > 1 && this->maxParallelism <= Recycler::MaxParallelism);
+
+    this->EnsureExtraParallelMarkers();
 
-    // Split the mark stack into [this->maxParallelism] equal pieces.
+    // Split the mark stack into up to [this->maxParallelism] equal pieces, in the order of GetParallelMarkContext.
     // The actual # of splits is returned, in case the stack was too small to split that many ways.
-    MarkContext * splitContexts[3] = { &parallelMarkContext1, &parallelMarkContext2, &parallelMarkContext3 };
-    uint actualSplitCount = markContext.Split(this->maxParallelism - 1, splitContexts);
+    // The split only seeds the contexts; they rebalance by stealing from each other while marking.
+    uint contextCount = min(this->maxParallelism, 4 + this->extraParallelMarkerCount);
+    MarkContext * splitContexts[Recycler::MaxParallelism - 1];
+    for (uint i = 1; i < contextCount; i++)
+    {
+        splitContexts[i - 1] = this->GetParallelMarkContext(i);
+    }
+    uint actualSplitCount = markContext.Split(contextCount - 1, splitContexts);
 
-    Assert(actualSplitCount <= 3);
+    Assert(actualSplitCount < contextCount);
 
     // If we failed to split at all, just mark in thread with no parallelism.
     if (actualSplitCount == 0)
@@ -2285,57 +2597,62 @@ Recycler::DoParallelMark()
         StartQueueTrackedObject();
     }
 
-    // Kick off marking on the background thread
-    bool concurrentSuccess = StartConcurrent(CollectionStateParallelMark);
+    contextCount = actualSplitCount + 1;
+    this->StartParallelMarkWorkStealing(contextCount);
 
-    // If there's enough work to split, then kick off marking on parallel threads too.
-    // If the threads haven't been created yet, this will create them (or fail).
-    bool parallelSuccess1 = false;
-    bool parallelSuccess2 = false;
-    if (concurrentSuccess && actualSplitCount >= 2)
+    // Context 1 is ours. Kick off marking of the others on their threads, in order, until one fails to start.
+    // The main markContext goes to the background thread if there is one; if the threads haven't been created
+    // yet, this will create them (or fail).
+    bool threadStarted[Recycler::MaxParallelism] = { false };
+#if ENABLE_CONCURRENT_GC
+    threadStarted[0] = StartConcurrent(CollectionStateParallelMark);
+#else
+    this->collectionState = CollectionStateParallelMark;
+    threadStarted[0] = parallelThread3.StartConcurrent();
+#endif
+
+    LONG startedCount = 1 + (threadStarted[0] ? 1 : 0);
+    bool startNext = threadStarted[0];
+    for (uint i = 2; i < contextCount && startNext; i++)
     {
-        parallelSuccess1 = parallelThread1.StartConcurrent();
-        if (parallelSuccess1 && actualSplitCount == 3)
-        {
-            parallelSuccess2 = parallelThread2.StartConcurrent();
-        }
+        threadStarted[i] = this->GetParallelMarkThread(i)->StartConcurrent();
+        startNext = threadStarted[i];
+        startedCount += (threadStarted[i] ? 1 : 0);
     }
 
+    // Contexts whose thread failed to start don't take part in the mark, but their work can still be stolen.
+    // Whatever is left of them is processed in-thread below.
+    ::InterlockedExchangeAdd(&this->parallelMarkParticipantCount, startedCount - (LONG)contextCount);
+
     // Process our portion of the split.
     this->ProcessParallelMark(false, &parallelMarkContext1);
 
     // If we successfully launched parallel work, wait for it to complete.
-    // If we failed, then process the work in-thread now.
-    if (concurrentSuccess)
+    if (threadStarted[0])
     {
+#if ENABLE_CONCURRENT_GC
         WaitForConcurrentThread(INFINITE);
-    }
-    else
-    {
-        this->ProcessParallelMark(false, &markContext);
+#else
+        parallelThread3.WaitForConcurrent();
+#endif
     }
 
-    if (actualSplitCount >= 2)
+    for (uint i = 2; i < contextCount; i++)
     {
-        if (parallelSuccess1)
-        {
-            parallelThread1.WaitForConcurrent();
-        }
-        else
+        if (threadStarted[i])
         {
-            this->ProcessParallelMark(false, &parallelMarkContext2);
+            this->GetParallelMarkThread(i)->WaitForConcurrent();
         }
+    }
+
+    // All the parallel work is done; process the work of any thread we failed to launch in-thread now.
+    this->EndParallelMarkWorkStealing();
 
-        if (actualSplitCount == 3)
+    for (uint i = 0; i < contextCount; i++)
+    {
+        if (i != 1 && !threadStarted[i])
         {
-            if (parallelSuccess2)
-            {
-                parallelThread2.WaitForConcurrent();
-            }
-            else
-            {
-                this->ProcessParallelMark(false, &parallelMarkContext3);
-            }
+            this->ProcessParallelMark(false, this->GetParallelMarkContext(i));
         }
     }
 
@@ -2358,21 +2675,215 @@ Recycler::DoParallelMark()
 #endif
 }
 
+void
+Recycler::EnsureExtraParallelMarkers()
+{
+    // Creating a marker can fail; the mark then just uses the ones we have, and the next one tries again.
+    uint neededCount = this->maxParallelism > 4 ? this->maxParallelism - 4 : 0;
+    while (this->extraParallelMarkerCount < neededCount)
+    {
+        RecyclerParallelMarker * marker = HeapNewNoThrow(RecyclerParallelMarker, this, 4 + this->extraParallelMarkerCount);
+        if (marker == nullptr)
+        {
+            break;
+        }
+
+        this->extraParallelMarkers[this->extraParallelMarkerCount++] = marker;
+    }
+}
+
+MarkContext *
+Recycler::GetParallelMarkContext(uint index)
+{
+    // The main markContext comes first, followed by the contexts it is split into (see DoParallelMark)
+    switch (index)
+    {
+    case 0:
+        return &this->markContext;
+    case 1:
+        return &this->parallelMarkContext1;
+    case 2:
+        return &this->parallelMarkContext2;
+    case 3:
+        return &this->parallelMarkContext3;
+    default:
+        Assert(index - 4 < this->extraParallelMarkerCount);
+        return &this->extraParallelMarkers[index - 4]->markContext;
+    }
+}
+
+MarkContext::StealState *
+Recycler::GetParallelMarkStealState(uint index)
+{
+    if (index < _countof(parallelMarkStealStates))
+    {
+        return &this->parallelMarkStealStates[index];
+    }
+
+    Assert(index - 4 < this->extraParallelMarkerCount);
+    return &this->extraParallelMarkers[index - 4]->stealState;
+}
+
+RecyclerParallelThread *
+Recycler::GetParallelMarkThread(uint index)
+{
+    // The thread that marks GetParallelMarkContext(index) during a parallel mark.
+    // Context 1 is marked by the thread doing the collection, and with concurrent GC, context 0 by the concurrent thread.
+    switch (index)
+    {
+    case 0:
+#if ENABLE_CONCURRENT_GC
+        Assert(false);
+        return nullptr;
+#else
+        return &this->parallelThread3;
+#endif
+    case 1:
+        Assert(false);
+        return nullptr;
+    case 2:
+        return &this->parallelThread1;
+    case 3:
+        return &this->parallelThread2;
+    default:
+        Assert(index - 4 < this->extraParallelMarkerCount);
+        return &this->extraParallelMarkers[index - 4]->parallelThread;
+    }
+}
+
+void
+Recycler::StartParallelMarkWorkStealing(uint contextCount)
+{
+    Assert(contextCount > 1 && contextCount <= 4 + this->extraParallelMarkerCount);
+    Assert(this->parallelMarkStealContextCount == 0);
+
+    // Without the event, idle markers just keep spinning until the mark is done.
+    if (this->parallelMarkWorkAvailableEvent == NULL)
+    {
+        this->parallelMarkWorkAvailableEvent = CreateEvent(NULL, FALSE, FALSE, NULL);
+    }
+    else
+    {
+        ResetEvent(this->parallelMarkWorkAvailableEvent);
+    }
+    this->parallelMarkWaiterCount = 0;
+
+    for (uint i = 0; i < contextCount; i++)
+    {
+        MarkContext::StealState * stealState = GetParallelMarkStealState(i);
+        stealState->waiterCount = (this->parallelMarkWorkAvailableEvent != NULL ? &this->parallelMarkWaiterCount : nullptr);
+        stealState->workAvailableEvent = this->parallelMarkWorkAvailableEvent;
+        GetParallelMarkContext(i)->SetStealState(stealState);
+    }
+
+    this->parallelMarkStealContextCount = contextCount;
+    this->parallelMarkParticipantCount = (LONG)contextCount;
+    this->parallelMarkIdleCount = 0;
+}
+
+void
+Recycler::EndParallelMarkWorkStealing()
+{
+    Assert(this->parallelMarkWaiterCount == 0);
+
+    for (uint i = 0; i < this->parallelMarkStealContextCount; i++)
+    {
+        GetParallelMarkContext(i)->SetStealState(nullptr);
+    }
+
+    this->parallelMarkStealContextCount = 0;
+    this->parallelMarkParticipantCount = 0;
+    this->parallelMarkIdleCount = 0;
+}
+
+bool
+Recycler::StealParallelMarkWork(MarkContext * markContext)
+{
+    if (this->parallelMarkStealContextCount == 0 || !markContext->HasStealState())
+    {
+        return false;
+    }
+
+    // Our context has run dry. Count it as idle and keep trying to take a full chunk of work from the others.
+    // Once every participant is idle, nobody can produce more work and the parallel mark is done.
+    // (Contexts whose thread failed to start never produce work, so they aren't counted as participants.)
+    ::InterlockedIncrement(&this->parallelMarkIdleCount);
+
+    uint victimIndex = 0;
+    uint spinCount = 0;
+    bool isWaiter = false;
+    while (true)
+    {
+        for (uint i = 0; i < this->parallelMarkStealContextCount; i++)
+        {
+            MarkContext * victimContext = GetParallelMarkContext(victimIndex);
+            MarkContext::StealState * victimState = GetParallelMarkStealState(victimIndex);
+            victimIndex = (victimIndex + 1) % this->parallelMarkStealContextCount;
+
+            if (victimContext != markContext && markContext->StealMarkWork(victimState))
+            {
+                if (isWaiter)
+                {
+                    ::InterlockedDecrement(&this->parallelMarkWaiterCount);
+                }
+                ::InterlockedDecrement(&this->parallelMarkIdleCount);
+                return true;
+            }
+        }
+
+        if (this->parallelMarkIdleCount >= this->parallelMarkParticipantCount)
+        {
+            // Everyone is out of work. Pass the wakeup on, so the markers still blocked see it too.
+            if (isWaiter)
+            {
+                ::InterlockedDecrement(&this->parallelMarkWaiterCount);
+            }
+            if (this->parallelMarkWaiterCount != 0)
+            {
+                SetEvent(this->parallelMarkWorkAvailableEvent);
+            }
+            return false;
+        }
+
+        if (spinCount < Recycler::ParallelMarkStealSpinCount || this->parallelMarkWorkAvailableEvent == NULL)
+        {
+            // Let the busy contexts make progress before we look again
+            spinCount++;
+            ::SwitchToThread();
+        }
+        else if (!isWaiter)
+        {
+            // Register before looking once more, so a chunk left behind after that look wakes us
+            // (see PageStack::Push). If the last participant just went idle, it will wake us too.
+            ::InterlockedIncrement(&this->parallelMarkWaiterCount);
+            isWaiter = true;
+        }
+        else
+        {
+            DWORD ret = WaitForSingleObject(this->parallelMarkWorkAvailableEvent, INFINITE);
+            Assert(ret == WAIT_OBJECT_0);
+        }
+    }
+}
+
+#endif
 
+#if ENABLE_CONCURRENT_GC
 void
 Recycler::DoBackgroundParallelMark()
 {
     // Split the mark stack into [this->maxParallelism - 1] equal pieces (thus, "- 2" below).
     // The actual # of splits is returned, in case the stack was too small to split that many ways.
     // The parallel threads are hardwired to use parallelMarkContext2/3, so we split using those.
+    // The background mark doesn't steal work, so it stays at 3 threads even with more processors.
     uint actualSplitCount = 0;
     MarkContext * splitContexts[2] = { &parallelMarkContext2, &parallelMarkContext3 };
     if (this->enableParallelMark)
     {
-        Assert(this->maxParallelism > 1 && this->maxParallelism <= 4);
+        Assert(this->maxParallelism > 1 && this->maxParallelism <= Recycler::MaxParallelism);
         if (this->maxParallelism > 2)
         {
-            actualSplitCount = markContext.Split(this->maxParallelism - 2, splitContexts);
+            actualSplitCount = markContext.Split(min(this->maxParallelism, 4u) - 2, splitContexts);
         }
     }
 
@@ -2447,6 +2958,8 @@ Recycler::RootMark(CollectionState markState)
 
     Assert(collectionState == (markState == CollectionStateMark? CollectionStateFindRoots : CollectionStateRescanFindRoots));
 
+    this->telemetry.BeginPhase(RecyclerTelemetryPhaseRootScan);
+
     BOOL stacksScannedByRuntime = FALSE;
     {
         // We are about to scan roots in thread, notify the runtime first so it can stop threads if necessary and also provide additional roots
@@ -2463,9 +2976,13 @@ Recycler::RootMark(CollectionState markState)
         scannedRootBytes += ScanStack();
     }
 
+    this->telemetry.EndPhase(RecyclerTelemetryPhaseRootScan);
+
     this->collectionState = markState;
 
-#if ENABLE_CONCURRENT_GC
+    this->telemetry.BeginPhase(RecyclerTelemetryPhaseMark);
+
+#if ENABLE_PARALLEL_MARK
     if (this->enableParallelMark)
     {
         this->DoParallelMark();
@@ -2476,7 +2993,11 @@ Recycler::RootMark(CollectionState markState)
         this->ProcessMark(false);
     }
 
-    if (this->EndMark())
+    bool endMarkOnLowMemory = this->EndMark();
+
+    this->telemetry.EndPhase(RecyclerTelemetryPhaseMark);
+
+    if (endMarkOnLowMemory)
     {
         // REVIEW: This heuristic doesn't apply when partial is off so there's no need
         // to modify scannedRootBytes here, correct?
@@ -2551,12 +3072,18 @@ Recycler::EndMark()
     parallelMarkContext1.Cleanup();
     parallelMarkContext2.Cleanup();
     parallelMarkContext3.Cleanup();
+#if ENABLE_PARALLEL_MARK
+    ForEachExtraParallelMarkContext([](MarkContext * markContext) { markContext->Cleanup(); });
+#endif
 
     // Decommit all pages
     markContext.DecommitPages();
     parallelMarkContext1.DecommitPages();
     parallelMarkContext2.DecommitPages();
     parallelMarkContext3.DecommitPages();
+#if ENABLE_PARALLEL_MARK
+    ForEachExtraParallelMarkContext([](MarkContext * markContext) { markContext->DecommitPages(); });
+#endif
 
     GCETW(GC_DECOMMIT_CONCURRENT_COLLECT_PAGE_ALLOCATOR_STOP, (this));
 
@@ -2646,6 +3173,12 @@ Recycler::EndMarkOnLowMemory()
     Assert(!parallelMarkContext1.GetPageAllocator()->DisableAllocationOutOfMemory());
     Assert(!parallelMarkContext2.GetPageAllocator()->DisableAllocationOutOfMemory());
     Assert(!parallelMarkContext3.GetPageAllocator()->DisableAllocationOutOfMemory());
+#if ENABLE_PARALLEL_MARK && DBG
+    ForEachExtraParallelMarkContext([](MarkContext * markContext)
+    {
+        Assert(!markContext->GetPageAllocator()->DisableAllocationOutOfMemory());
+    });
+#endif
     CUSTOM_PHASE_PRINT_TRACE1(GetRecyclerFlagsTable(), Js::RecyclerPhase, _u("EndMarkOnLowMemory iterations: %d\n"), iterations);
 
 #if ENABLE_PARTIAL_GC
@@ -2670,9 +3203,33 @@ Recycler::EndMarkOnLowMemory()
 bool
 Recycler::IsMarkStackEmpty()
 {
-    return (markContext.IsEmpty() && parallelMarkContext1.IsEmpty() && parallelMarkContext2.IsEmpty() && parallelMarkContext3.IsEmpty());
+    bool isEmpty = (markContext.IsEmpty() && parallelMarkContext1.IsEmpty() && parallelMarkContext2.IsEmpty() && parallelMarkContext3.IsEmpty());
+#if ENABLE_PARALLEL_MARK
+    ForEachExtraParallelMarkContext([&](MarkContext * markContext) { isEmpty = isEmpty && markContext->IsEmpty(); });
+#endif
+    return isEmpty;
+}
+#endif
+
+bool
+Recycler::HasPendingMarkObjects() const
+{
+    bool hasPending = markContext.HasPendingMarkObjects() || parallelMarkContext1.HasPendingMarkObjects() || parallelMarkContext2.HasPendingMarkObjects() || parallelMarkContext3.HasPendingMarkObjects();
+#if ENABLE_PARALLEL_MARK
+    ForEachExtraParallelMarkContext([&](MarkContext * markContext) { hasPending = hasPending || markContext->HasPendingMarkObjects(); });
+#endif
+    return hasPending;
 }
+
+bool
+Recycler::HasPendingTrackObjects() const
+{
+    bool hasPending = markContext.HasPendingTrackObjects() || parallelMarkContext1.HasPendingTrackObjects() || parallelMarkContext2.HasPendingTrackObjects() || parallelMarkContext3.HasPendingTrackObjects();
+#if ENABLE_PARALLEL_MARK
+    ForEachExtraParallelMarkContext([&](MarkContext * markContext) { hasPending = hasPending || markContext->HasPendingTrackObjects(); });
 #endif
+    return hasPending;
+}
 
 #ifdef HEAP_ENUMERATION_VALIDATION
 void
@@ -2770,6 +3327,7 @@ Recycler::Sweep(bool concurrent)
     }
 
     RECYCLER_PROFILE_EXEC_BEGIN(this, concurrent? Js::ConcurrentSweepPhase : Js::SweepPhase);
+    this->telemetry.BeginPhase(RecyclerTelemetryPhaseSweep);
 
 #if ENABLE_PARTIAL_GC
     recyclerSweepInstance.BeginSweep(this, rescanRootBytes, adjustPartialHeuristics);
@@ -2811,6 +3369,7 @@ Recycler::Sweep(bool concurrent)
         recyclerSweep->EndSweep();
     }
 
+    this->telemetry.EndPhase(RecyclerTelemetryPhaseSweep);
     RECYCLER_PROFILE_EXEC_END(this, concurrent? Js::ConcurrentSweepPhase : Js::SweepPhase);
 
 #if ENABLE_CONCURRENT_GC
@@ -3017,6 +3576,7 @@ Recycler::DisposeObjects()
     // Scope timestamp to just dispose
     {
         AUTO_TIMESTAMP(dispose);
+        AutoRecyclerTelemetryPhase telemetryPhase(this->telemetry, RecyclerTelemetryPhaseFinalize);
         autoHeap.DisposeObjects();
     }
 
@@ -3347,8 +3907,8 @@ Recycler::CollectWithHeuristic()
     }
 #endif
 
-    // allocation byte count heuristic, collect every 1 MB allocated
-    if (allocSize && (autoHeap.uncollectedAllocBytes < RecyclerHeuristic::UncollectedAllocBytesCollection()))
+    // allocation byte count heuristic, collect every 1 MB allocated (4 MB with the large collection budget)
+    if (allocSize && (autoHeap.uncollectedAllocBytes < RecyclerHeuristic::UncollectedAllocBytesCollection(this->enableLargeCollectionBudget)))
     {
         return FinishDisposeObjectsWrapped<flags>();
     }
@@ -3556,6 +4116,12 @@ Recycler::DoCollect(CollectionFlags flags)
         Assert(this->backgroundFinishMarkCount == 0);
 #endif
 
+#if ENABLE_PARTIAL_GC
+        this->telemetry.BeginCollection(RecyclerTelemetry::GetCollectionReason(flags), !!partial, concurrent, this->GetUsedBytes());
+#else
+        this->telemetry.BeginCollection(RecyclerTelemetry::GetCollectionReason(flags), false, concurrent, this->GetUsedBytes());
+#endif
+
 #if DBG
         collectionCount++;
 #endif
@@ -3866,6 +4432,10 @@ void Recycler::EnumerateObjects(ObjectInfoBits infoBits, void (*CallBackFunction
         FinishPartialCollect();
     }
 #endif
+#if ENABLE_LAZY_SWEEP
+    // Objects in blocks pending lazy sweep may be dead; sweep them so they aren't enumerated.
+    FinishLazySweep();
+#endif
 
     autoHeap.EnumerateObjects(infoBits, CallBackFunction);
     // GC-TODO: Explicit heap?
@@ -4029,7 +4599,7 @@ Recycler::FinishMarkRescan(bool background)
 }
 
 
-#if ENABLE_CONCURRENT_GC
+#if ENABLE_PARALLEL_MARK
 void
 Recycler::ProcessTrackedObjects()
 {
@@ -4051,6 +4621,7 @@ Recycler::ProcessTrackedObjects()
     parallelMarkContext1.ProcessTracked();
     parallelMarkContext2.ProcessTracked();
     parallelMarkContext3.ProcessTracked();
+    ForEachExtraParallelMarkContext([](MarkContext * markContext) { markContext->ProcessTracked(); });
 
     DebugOnly(this->isProcessingTrackedObjects = false);
 
@@ -4536,6 +5107,10 @@ Recycler::FinalizeConcurrent(bool restoreState)
     // close it.
     parallelThread1.Shutdown();
     parallelThread2.Shutdown();
+    for (uint i = 0; i < this->extraParallelMarkerCount; i++)
+    {
+        this->extraParallelMarkers[i]->parallelThread.Shutdown();
+    }
 
 #ifdef IDLE_DECOMMIT_ENABLED
     if (concurrentIdleDecommitEvent != nullptr)
@@ -5536,22 +6111,30 @@ Recycler::DoBackgroundWork(bool forceForeground)
         switch (this->collectionState)
         {
         case CollectionStateConcurrentResetMarks:
+            this->telemetry.BeginPhase(RecyclerTelemetryPhaseMark, RecyclerTelemetryThreadBackground);
             this->BackgroundResetMarks();
             this->BackgroundResetWriteWatchAll();
+            this->telemetry.EndPhase(RecyclerTelemetryPhaseMark, RecyclerTelemetryThreadBackground);
             this->collectionState = CollectionStateConcurrentFindRoots;
             // fall-through
         case CollectionStateConcurrentFindRoots:
+            this->telemetry.BeginPhase(RecyclerTelemetryPhaseRootScan, RecyclerTelemetryThreadBackground);
             this->BackgroundFindRoots();
             this->BackgroundScanStack();
+            this->telemetry.EndPhase(RecyclerTelemetryPhaseRootScan, RecyclerTelemetryThreadBackground);
             this->collectionState = CollectionStateConcurrentMark;
             // fall-through
         case CollectionStateConcurrentMark:
+            this->telemetry.BeginPhase(RecyclerTelemetryPhaseMark, RecyclerTelemetryThreadBackground);
             this->BackgroundMark();
+            this->telemetry.EndPhase(RecyclerTelemetryPhaseMark, RecyclerTelemetryThreadBackground);
             Assert(this->collectionState == CollectionStateConcurrentMark);
             RECORD_TIMESTAMP(concurrentMarkFinishTime);
             break;
         case CollectionStateConcurrentFinishMark:
+            this->telemetry.BeginPhase(RecyclerTelemetryPhaseMark, RecyclerTelemetryThreadBackground);
             this->backgroundRescanRootBytes = this->BackgroundFinishMark();
+            this->telemetry.EndPhase(RecyclerTelemetryPhaseMark, RecyclerTelemetryThreadBackground);
             Assert(!HasPendingMarkObjects());
             break;
         default:
@@ -5597,7 +6180,9 @@ Recycler::DoBackgroundWork(bool forceForeground)
         GCETW(GC_BACKGROUNDSWEEP_START, (this));
 
         Assert(this->recyclerSweep != nullptr);
+        this->telemetry.BeginPhase(RecyclerTelemetryPhaseSweep, RecyclerTelemetryThreadBackground);
         this->recyclerSweep->BackgroundSweep();
+        this->telemetry.EndPhase(RecyclerTelemetryPhaseSweep, RecyclerTelemetryThreadBackground);
         uint sweptBytes = 0;
 #ifdef RECYCLER_STATS
         sweptBytes = (uint)collectionStats.objectSweptBytes;
@@ -5850,6 +6435,13 @@ Recycler::FinishCollection()
     }
 #endif
 
+#ifdef ENABLE_DEBUG_CONFIG_OPTIONS
+    if (GetRecyclerFlagsTable().DumpAllocationHistogram)
+    {
+        autoHeap.DumpAllocationHistogram();
+    }
+#endif
+
 #ifdef DUMP_FRAGMENTATION_STATS
     if (GetRecyclerFlagsTable().DumpFragmentationStats)
     {
@@ -5857,6 +6449,8 @@ Recycler::FinishCollection()
     }
 #endif
 
+    this->telemetry.EndCollection(this->GetUsedBytes());
+
     RECORD_TIMESTAMP(currentCollectionEndTime);
 }
 
@@ -6002,7 +6596,7 @@ Recycler::ShouldIdleCollectOnExit()
     return (autoHeap.uncollectedAllocBytes >= RecyclerHeuristic::IdleUncollectedAllocBytesCollection);
 }
 
-#if ENABLE_CONCURRENT_GC
+#if ENABLE_PARALLEL_MARK
 bool
 RecyclerParallelThread::StartConcurrent()
 {
@@ -6069,7 +6663,12 @@ RecyclerParallelThread::EnableConcurrent(bool waitForThread)
         return false;
     }
 
+#ifdef _WIN32
     this->concurrentThread = (HANDLE)_beginthreadex(NULL, Recycler::ConcurrentThreadStackSize, &RecyclerParallelThread::StaticThreadProc, this, STACK_SIZE_PARAM_IS_A_RESERVATION, NULL);
+#else
+    // The PAL backs CreateThread with a pthread, and its handle can be waited on like the Windows one
+    this->concurrentThread = CreateThread(NULL, Recycler::ConcurrentThreadStackSize, (LPTHREAD_START_ROUTINE)&RecyclerParallelThread::StaticThreadProc, this, STACK_SIZE_PARAM_IS_A_RESERVATION, NULL);
+#endif
 
     if (this->concurrentThread != nullptr && waitForThread)
     {
@@ -6098,13 +6697,13 @@ RecyclerParallelThread::EnableConcurrent(bool waitForThread)
 }
 
 
-template <uint parallelId>
 void
-Recycler::ParallelWorkFunc()
+Recycler::ParallelWorkFunc(uint contextIndex)
 {
-    Assert(parallelId == 0 || parallelId == 1);
-
-    MarkContext * markContext = (parallelId == 0 ? &this->parallelMarkContext2 : &this->parallelMarkContext3);
+    // Context 1 is marked by the thread doing the collection, so it has no parallel thread.
+    // Context 0 only has one without concurrent GC, in place of the concurrent thread (see DoParallelMark)
+    Assert(contextIndex != 1);
+    MarkContext * markContext = this->GetParallelMarkContext(contextIndex);
 
     switch (this->collectionState)
     {
@@ -6112,9 +6711,18 @@ Recycler::ParallelWorkFunc()
             this->ProcessParallelMark(false, markContext);
             break;
 
+#if ENABLE_CONCURRENT_GC
         case CollectionStateBackgroundParallelMark:
+            Assert(contextIndex == 2 || contextIndex == 3);
             this->ProcessParallelMark(true, markContext);
             break;
+#endif
+
+#if ENABLE_LAZY_SWEEP
+        case CollectionStateParallelSweep:
+            autoHeap.SweepLazySweepBuckets(&this->lazySweepBucketIndex);
+            break;
+#endif
 
         default:
             Assert(false);
@@ -6173,20 +6781,65 @@ RecyclerParallelThread::Shutdown()
     Assert(this->concurrentWorkDoneEvent == NULL);
 }
 
+#if !ENABLE_CONCURRENT_GC
+void
+Recycler::ShutdownParallelThreads()
+{
+    // Without concurrent GC there is no ShutdownThread, so the parallel threads go away with the recycler.
+    // They are only created once parallel mark has been enabled, which also hooks up the thread service.
+    if (this->threadService == nullptr)
+    {
+        return;
+    }
+
+    this->collectionState = CollectionStateExit;
+
+    parallelThread1.Shutdown();
+    parallelThread2.Shutdown();
+    parallelThread3.Shutdown();
+
+    for (uint i = 0; i < this->extraParallelMarkerCount; i++)
+    {
+        this->extraParallelMarkers[i]->parallelThread.Shutdown();
+    }
+}
+#endif
+
+RecyclerParallelMarker::RecyclerParallelMarker(Recycler * recycler, uint contextIndex) :
+    pagePool(recycler->GetRecyclerFlagsTable()),
+    markContext(recycler, &this->pagePool),
+    parallelThread(recycler, &Recycler::ParallelWorkFunc, contextIndex)
+{
+    Assert(contextIndex >= 4);
+
+#ifdef RECYCLER_MARK_TRACK
+    markContext.SetMarkMap(recycler->markMap);
+#endif
+#ifdef ENABLE_DEBUG_CONFIG_OPTIONS
+    markContext.SetMaxPageCount(recycler->GetRecyclerFlagsTable().MaxMarkStackPageCount);
+#endif
+}
+
 // static
 unsigned int
 RecyclerParallelThread::StaticThreadProc(LPVOID lpParameter)
 {
     DWORD ret = (DWORD)-1;
+#ifndef DISABLE_SEH
     __try
+#endif
     {
         RecyclerParallelThread * parallelThread = (RecyclerParallelThread *)lpParameter;
         Recycler * recycler = parallelThread->recycler;
         RecyclerParallelThread::WorkFunc workFunc = parallelThread->workFunc;
 
+#if ENABLE_CONCURRENT_GC
         Assert(recycler->IsConcurrentEnabled());
+#else
+        Assert(recycler->enableParallelMark);
+#endif
 
-#if !defined(_UCRT)
+#if !defined(_UCRT) && defined(_WIN32)
         HMODULE dllHandle = NULL;
         if (!GetModuleHandleEx(GET_MODULE_HANDLE_EX_FLAG_FROM_ADDRESS, (LPCTSTR)&RecyclerParallelThread::StaticThreadProc, &dllHandle))
         {
@@ -6220,7 +6873,7 @@ RecyclerParallelThread::StaticThreadProc(LPVOID lpParameter)
             }
 
             // Invoke the workFunc to do real work
-            (recycler->*workFunc)();
+            (recycler->*workFunc)(parallelThread->contextIndex);
 
             // We always wait after the first time
             mustWait = true;
@@ -6232,7 +6885,7 @@ RecyclerParallelThread::StaticThreadProc(LPVOID lpParameter)
         // because the main thread may have torn it down already.
         SetEvent(parallelThread->concurrentWorkDoneEvent);
 
-#if !defined(_UCRT)
+#if !defined(_UCRT) && defined(_WIN32)
         if (dllHandle)
         {
             FreeLibraryAndExitThread(dllHandle, 0);
@@ -6240,10 +6893,12 @@ RecyclerParallelThread::StaticThreadProc(LPVOID lpParameter)
 #endif
         ret = 0;
     }
+#ifndef DISABLE_SEH
     __except(Recycler::ExceptFilter(GetExceptionInformation()))
     {
         Assert(false);
     }
+#endif
 
     return ret;
 }
@@ -6257,7 +6912,7 @@ RecyclerParallelThread::StaticBackgroundWorkCallback(void * callbackData)
     Recycler * recycler = parallelThread->recycler;
     RecyclerParallelThread::WorkFunc workFunc = parallelThread->workFunc;
 
-    (recycler->*workFunc)();
+    (recycler->*workFunc)(parallelThread->contextIndex);
 
     SetEvent(parallelThread->concurrentWorkDoneEvent);
 }
@@ -6588,6 +7243,12 @@ Recycler::PrintMarkCollectionStats()
     Output::Print(_u("                                        | Non GC Int: %9d %5.1f | Stack   :%9d | NewFalse:%9d\n"),
         collectionStats.tryMarkInteriorNonRecyclerMemoryCount, (double)collectionStats.tryMarkInteriorNonRecyclerMemoryCount / (double)nonMark * 100,
         collectionStats.stackCount, collectionStats.markThruFalseNewObjCount);
+    Output::Print(_u(" Stack Bytes: Conservative :%10d | Precise :%10d | Skipped :%10d\n"),
+        collectionStats.stackConservativeBytes, collectionStats.stackPreciseBytes, collectionStats.stackSkippedBytes);
+    Output::Print(_u(" Stack Ranges:%9d | Out of order: %5d | Avg precise: %7.1f | Avg skipped: %7.1f\n"),
+        collectionStats.stackRangeCount, collectionStats.stackOutOfOrderRangeCount,
+        collectionStats.stackRangeCount ? (double)collectionStats.stackPreciseBytes / collectionStats.stackRangeCount : 0.0,
+        collectionStats.stackRangeCount ? (double)collectionStats.stackSkippedBytes / collectionStats.stackRangeCount : 0.0);
 }
 
 void
@@ -6703,6 +7364,10 @@ Recycler::PrintMemoryStats()
         , collectionStats.numEmptySmallBlocks[HeapBlock::SmallLeafBlockType]
         + collectionStats.numEmptySmallBlocks[HeapBlock::MediumLeafBlockType],
         collectionStats.numZeroedOutSmallBlocks);
+
+    Output::Print(_u("\nSparse leaf block stats since last GC\n"));
+    Output::Print(_u("Number of sparse blocks allocated from last: %d\nNumber of sparse blocks drained and released: %d (%d pages reclaimed)\n"),
+        collectionStats.numSparseSmallBlocks, collectionStats.numDrainedSparseSmallBlocks, collectionStats.drainedSparseSmallBlockPageCount);
 }
 
 void
@@ -7757,6 +8422,15 @@ Recycler::ReportLeaks()
             }
 #endif
         }
+
+        if (this->leakReportStackScanCount != 0)
+        {
+            LeakReport::Print(_u("--------------------------------------------------------------------------------\n"));
+            LeakReport::Print(_u("Stack Scan: %d scans, %d bytes conservative, %d bytes precise\n"),
+                this->leakReportStackScanCount, this->leakReportStackConservativeBytes, this->leakReportStackPreciseBytes);
+            LeakReport::Print(_u("Stack Scan: %d bytes of dead interpreter slots skipped (%d pointed into the GC heap)\n"),
+                this->leakReportStackSkippedBytes, this->leakReportStackSkippedCandidateCount);
+        }
         LeakReport::EndSection();
     }
 }
@@ -110,6 +110,43 @@ private:
     Recycler* recycler;
 };
 
+// Scans the stack from its top (lowest address) to its base. Ranges reported by the runtime hold only
+// tagged values or pointers to the start of an object and are scanned without interior pointers; the
+// dead bytes that follow each range are skipped. Everything else is scanned conservatively. Ranges
+// have to be reported in increasing address order. Ranges entirely off the stack (frames kept in heap
+// objects) are left to the scan of those objects. A range that overlaps what was already scanned or
+// runs past the stack base asserts; in release builds its live slots are scanned conservatively and
+// nothing is skipped for it.
+class RecyclerScanStackCallback
+{
+public:
+    RecyclerScanStackCallback(Recycler* recycler, void ** stackTop, void ** stackBase);
+    void operator()(void ** liveSlots, size_t liveByteCount, size_t deadByteCount);
+    size_t Finish();
+
+    size_t GetConservativeByteCount() const { return conservativeByteCount; }
+    size_t GetPreciseByteCount() const { return preciseByteCount; }
+    size_t GetSkippedByteCount() const { return skippedByteCount; }
+    size_t GetRangeCount() const { return rangeCount; }
+    size_t GetOutOfOrderRangeCount() const { return outOfOrderRangeCount; }
+#ifdef LEAK_REPORT
+    size_t GetSkippedCandidateCount() const { return skippedCandidateCount; }
+#endif
+private:
+    Recycler* recycler;
+    void ** stackTop;
+    void ** current;
+    void ** stackBase;
+    size_t conservativeByteCount;
+    size_t preciseByteCount;
+    size_t skippedByteCount;
+    size_t rangeCount;                  // ranges scanned precisely
+    size_t outOfOrderRangeCount;        // ranges that overlapped the stack out of order, scanned conservatively
+#ifdef LEAK_REPORT
+    size_t skippedCandidateCount;       // skipped slots that still pointed into a heap block
+#endif
+};
+
 template<ObjectInfoBits infoBits>
 struct InfoBitsWrapper{};
 
@@ -318,6 +355,7 @@ public:
     virtual void PreSweepCallback() = 0;
     virtual void PreRescanMarkCallback() = 0;
     virtual size_t RootMarkCallback(RecyclerScanMemoryCallback& scanMemoryCallback, BOOL * stacksScannedByRuntime) = 0;
+    virtual void EnumerateStackRanges(RecyclerScanStackCallback& scanStackCallback) = 0;
     virtual void RescanMarkTimeoutCallback() = 0;
     virtual void EndMarkCallback() = 0;
     virtual void ConcurrentCallback() = 0;
@@ -348,6 +386,7 @@ public:
     virtual void RescanMarkTimeoutCallback() override {}
     virtual void EndMarkCallback() override {}
     virtual size_t RootMarkCallback(RecyclerScanMemoryCallback& scanMemoryCallback, BOOL * stacksScannedByRuntime) override { *stacksScannedByRuntime = FALSE; return 0; }
+    virtual void EnumerateStackRanges(RecyclerScanStackCallback& scanStackCallback) override {}
     virtual void ConcurrentCallback() override {}
     virtual void WaitCollectionCallBack() override {}
     virtual void PostCollectionCallBack() override {}
@@ -404,6 +443,11 @@ struct RecyclerCollectionStats
     size_t tryMarkInteriorNonRecyclerMemoryCount;
     size_t rootCount;
     size_t stackCount;
+    size_t stackConservativeBytes;
+    size_t stackPreciseBytes;
+    size_t stackSkippedBytes;
+    size_t stackRangeCount;
+    size_t stackOutOfOrderRangeCount;
     size_t remarkCount;
 
     size_t scanCount;           // non-leaf objects marked.
@@ -463,6 +507,11 @@ struct RecyclerCollectionStats
     // Empty/zero heap block stats
     uint numEmptySmallBlocks[HeapBlock::SmallBlockTypeCount];
     uint numZeroedOutSmallBlocks;
+
+    // Sparse leaf block draining stats
+    uint numSparseSmallBlocks;                  // sparse blocks moved to the end of the allocation order
+    uint numDrainedSparseSmallBlocks;           // blocks that were sparse at the previous sweep and are now released
+    size_t drainedSparseSmallBlockPageCount;    // pages reclaimed from those blocks
 };
 #define RECYCLER_STATS_INC_IF(cond, r, f) if (cond) { RECYCLER_STATS_INC(r, f); }
 #define RECYCLER_STATS_INC(r, f) ++r->collectionStats.f
@@ -540,15 +589,16 @@ struct CollectionParam
 #endif
 
 
-#if ENABLE_CONCURRENT_GC
+#if ENABLE_PARALLEL_MARK
 class RecyclerParallelThread
 {
 public:
-    typedef void (Recycler::* WorkFunc)();
+    typedef void (Recycler::* WorkFunc)(uint contextIndex);
 
-    RecyclerParallelThread(Recycler * recycler, WorkFunc workFunc) :
+    RecyclerParallelThread(Recycler * recycler, WorkFunc workFunc, uint contextIndex) :
         recycler(recycler),
         workFunc(workFunc),
+        contextIndex(contextIndex),
         concurrentWorkReadyEvent(NULL),
         concurrentWorkDoneEvent(NULL),
         concurrentThread(NULL)
@@ -577,11 +627,25 @@ private:
 private:
     WorkFunc workFunc;
     Recycler * recycler;
+    uint contextIndex;              // The parallel mark context this thread marks from (see Recycler::GetParallelMarkContext)
     HANDLE concurrentWorkReadyEvent;// main thread uses this event to tell concurrent threads that the work is ready
     HANDLE concurrentWorkDoneEvent;// concurrent threads use this event to tell main thread that the work allocated is done
     HANDLE concurrentThread;
     bool synchronizeOnStartup;
 };
+
+// A mark context beyond the four the recycler always has, with its own page pool and thread.
+// These are only created on machines with more processors, by the first parallel mark that can use them.
+class RecyclerParallelMarker
+{
+public:
+    RecyclerParallelMarker(Recycler * recycler, uint contextIndex);
+
+    PagePool pagePool;
+    MarkContext markContext;
+    MarkContext::StealState stealState;
+    RecyclerParallelThread parallelThread;
+};
 #endif
 
 #ifdef ENABLE_DEBUG_CONFIG_OPTIONS
@@ -598,16 +662,23 @@ private:
 };
 #endif
 
+#if ENABLE_LAZY_SWEEP && (defined(RECYCLER_STATS) || defined(RECYCLER_PERF_COUNTERS) || defined(PROFILE_RECYCLER_ALLOC) || defined(RECYCLER_MEMORY_VERIFY) || defined(RECYCLER_TEST_SUPPORT))
+// Sweeping an object updates recycler wide tracking state in these builds (see Recycler::NotifyFree),
+// so threads finishing the lazy sweep together take turns sweeping whole blocks.
+#define RECYCLER_SERIALIZE_PARALLEL_SWEEP 1
+#endif
 
 class Recycler
 {
     friend class RecyclerScanMemoryCallback;
+    friend class RecyclerScanStackCallback;
     friend class RecyclerSweep;
     friend class MarkContext;
     friend class HeapBlock;
     friend class HeapBlockMap32;
-#if ENABLE_CONCURRENT_GC
+#if ENABLE_PARALLEL_MARK
     friend class RecyclerParallelThread;
+    friend class RecyclerParallelMarker;
 #endif
 #ifdef ENABLE_DEBUG_CONFIG_OPTIONS
     friend class AutoProtectPages;
@@ -799,8 +870,8 @@ private:
     PagePool parallelMarkPagePool3;
 
     bool IsMarkStackEmpty();
-    bool HasPendingMarkObjects() const { return markContext.HasPendingMarkObjects() || parallelMarkContext1.HasPendingMarkObjects() || parallelMarkContext2.HasPendingMarkObjects() || parallelMarkContext3.HasPendingMarkObjects(); }
-    bool HasPendingTrackObjects() const { return markContext.HasPendingTrackObjects() || parallelMarkContext1.HasPendingTrackObjects() || parallelMarkContext2.HasPendingTrackObjects() || parallelMarkContext3.HasPendingTrackObjects(); }
+    bool HasPendingMarkObjects() const;
+    bool HasPendingTrackObjects() const;
 
     RecyclerCollectionWrapper * collectionWrapper;
     HANDLE mainThreadHandle;
@@ -906,16 +977,12 @@ private:
     bool isFinishGCOnIdle;
 #endif
 
-    bool queueTrackedObject;
     bool hasPendingConcurrentFindRoot;
     bool priorityBoost;
     bool disableConcurrent;
     bool enableConcurrentMark;
-    bool enableParallelMark;
     bool enableConcurrentSweep;
 
-    uint maxParallelism;        // Max # of total threads to run in parallel
-
     byte backgroundRescanCount;             // for ETW events and stats
     byte backgroundFinishMarkCount;
     size_t backgroundRescanRootBytes;
@@ -923,13 +990,6 @@ private:
     HANDLE concurrentWorkDoneEvent; // concurrent threads use this event to tell main thread that the work allocated is done
     HANDLE concurrentThread;
 
-
-    template <uint parallelId>
-    void ParallelWorkFunc();
-
-    RecyclerParallelThread parallelThread1;
-    RecyclerParallelThread parallelThread2;
-
 #if DBG
     // Variable indicating if the concurrent thread has exited or not
     // If the concurrent thread hasn't started yet, this is set to true
@@ -937,7 +997,6 @@ private:
     // and when the concurrent thread exits, it sets this to true.
     bool concurrentThreadExited;
     bool disableConcurrentThreadExitedCheck;
-    bool isProcessingTrackedObjects;
 #endif
 
     uint tickCountStartConcurrent;
@@ -945,6 +1004,69 @@ private:
     bool isAborting;
 #endif
 
+#if ENABLE_PARALLEL_MARK
+    bool queueTrackedObject;
+    bool enableParallelMark;
+
+    uint maxParallelism;        // Max # of total threads to run in parallel
+
+    // Upper bound on maxParallelism: the main context and every context it can be split into
+    static const uint MaxParallelism = MarkContext::MaxSplitTargets + 1;
+
+    // Mark contexts past the first four, one per extra processor (see RecyclerParallelMarker)
+    RecyclerParallelMarker * extraParallelMarkers[MaxParallelism - 4];
+    uint extraParallelMarkerCount;
+
+    // Work stealing between the mark contexts taking part in a parallel mark.
+    // Only these states are shared between the threads; each thread marks from its own copy of its context.
+    // They are written from different threads, so each gets its own cache line.
+    // The extra markers keep theirs in their own allocation.
+    struct DECLSPEC_ALIGN(64) ParallelMarkStealState : public MarkContext::StealState {};
+    ParallelMarkStealState parallelMarkStealStates[4];
+    uint parallelMarkStealContextCount;
+    LONG volatile parallelMarkParticipantCount;
+    LONG volatile parallelMarkIdleCount;
+
+    // Markers that ran out of work spin briefly, then block on this event until a chunk is left to steal
+    // or the mark is over. Auto-reset: each wakeup releases one waiter, which wakes the next if need be.
+    HANDLE parallelMarkWorkAvailableEvent;
+    LONG volatile parallelMarkWaiterCount;
+    static const uint ParallelMarkStealSpinCount = 32;
+
+    void ParallelWorkFunc(uint contextIndex);
+
+    RecyclerParallelThread parallelThread1;
+    RecyclerParallelThread parallelThread2;
+#if !ENABLE_CONCURRENT_GC
+    // There is no concurrent thread to mark the main context, so it gets a parallel thread of its own
+    RecyclerParallelThread parallelThread3;
+#endif
+
+#if DBG
+    bool isProcessingTrackedObjects;
+#endif
+#endif
+
+#if ENABLE_LAZY_SWEEP
+    bool enableLazySweep;
+    bool enableParallelSweep;
+    LONG volatile lazySweepBucketIndex;     // next bucket to claim while finishing the lazy sweep
+#ifdef RECYCLER_SERIALIZE_PARALLEL_SWEEP
+    CriticalSection parallelSweepLock;
+#endif
+#endif
+
+    bool enablePreciseStackScan;
+    bool enableLargeCollectionBudget;
+#ifdef LEAK_REPORT
+    // Totals over all stack scans, reported with the leaks
+    size_t leakReportStackScanCount;
+    size_t leakReportStackConservativeBytes;
+    size_t leakReportStackPreciseBytes;
+    size_t leakReportStackSkippedBytes;
+    size_t leakReportStackSkippedCandidateCount;
+#endif
+
 #if DBG
     bool hasIncompleteDoCollect;
     // This is set to true when we begin a Rescan, and set to false when either:
@@ -1013,6 +1135,7 @@ private:
 #endif
     RecyclerWatsonTelemetryBlock localTelemetryBlock;
     RecyclerWatsonTelemetryBlock * telemetryBlock;
+    RecyclerTelemetry telemetry;
 
 #ifdef RECYCLER_STATS
     RecyclerCollectionStats collectionStats;
@@ -1075,8 +1198,11 @@ public:
 
     char* Realloc(void* buffer, size_t existingBytes, size_t requestedBytes, bool truncate = true);
     void SetTelemetryBlock(RecyclerWatsonTelemetryBlock * telemetryBlock) { this->telemetryBlock = telemetryBlock; }
+    RecyclerTelemetry& GetTelemetry() { return this->telemetry; }
 
     void Prime();
+    void SetLargeCollectionBudget(bool enable) { enableLargeCollectionBudget = enable; }
+    bool IsLargeCollectionBudgetEnabled() const { return enableLargeCollectionBudget; }
 
     void* GetOwnerContext() { return (void*) this->collectionWrapper; }
     PageAllocator * GetPageAllocator() { return threadPageAllocator; }
@@ -1098,6 +1224,12 @@ public:
         parallelMarkContext1.GetPageAllocator()->ResetDisableAllocationOutOfMemory();
         parallelMarkContext2.GetPageAllocator()->ResetDisableAllocationOutOfMemory();
         parallelMarkContext3.GetPageAllocator()->ResetDisableAllocationOutOfMemory();
+#if ENABLE_PARALLEL_MARK
+        ForEachExtraParallelMarkContext([](MarkContext * markContext)
+        {
+            markContext->GetPageAllocator()->ResetDisableAllocationOutOfMemory();
+        });
+#endif
     }
 
     BOOL RequestConcurrentWrapperCallback();
@@ -1178,9 +1310,17 @@ public:
     bool EnableConcurrent(JsUtil::ThreadService *threadService, bool startAllThreads);
     void DisableConcurrent();
 
+    void PrepareSweep();
+#endif
+
+#if ENABLE_PARALLEL_MARK
     void StartQueueTrackedObject();
     bool DoQueueTrackedObject() const;
-    void PrepareSweep();
+#endif
+
+#if ENABLE_LAZY_SWEEP
+    // Sweep what the last collection left for allocation to sweep; called before the next mark and on idle
+    void FinishLazySweep();
 #endif
 
     template <CollectionFlags flags>
@@ -1591,8 +1731,25 @@ private:
     bool EndMark();
     bool EndMarkCheckOOMRescan();
     void EndMarkOnLowMemory();
-#if ENABLE_CONCURRENT_GC
+#if ENABLE_PARALLEL_MARK
     void DoParallelMark();
+    void EnsureExtraParallelMarkers();
+    MarkContext * GetParallelMarkContext(uint index);
+    MarkContext::StealState * GetParallelMarkStealState(uint index);
+    RecyclerParallelThread * GetParallelMarkThread(uint index);
+    template <typename Fn>
+    void ForEachExtraParallelMarkContext(Fn fn) const
+    {
+        for (uint i = 0; i < this->extraParallelMarkerCount; i++)
+        {
+            fn(&this->extraParallelMarkers[i]->markContext);
+        }
+    }
+    void StartParallelMarkWorkStealing(uint contextCount);
+    void EndParallelMarkWorkStealing();
+    bool StealParallelMarkWork(MarkContext * markContext);
+#endif
+#if ENABLE_CONCURRENT_GC
     void DoBackgroundParallelMark();
 #endif
 
@@ -1674,9 +1831,15 @@ private:
     size_t RescanMark(DWORD waitTime);
     size_t FinishMark(DWORD waitTime);
     size_t FinishMarkRescan(bool background);
-#if ENABLE_CONCURRENT_GC
+#if ENABLE_PARALLEL_MARK
     void ProcessTrackedObjects();
 #endif
+#if ENABLE_PARALLEL_MARK && !ENABLE_CONCURRENT_GC
+    void ShutdownParallelThreads();
+#endif
+#if ENABLE_LAZY_SWEEP
+    void DoParallelLazySweep();
+#endif
 
 #if ENABLE_CONCURRENT_GC
     // Concurrent GC
@@ -1912,6 +2075,18 @@ public:
     bool IsCollectionDisabled() const { return isCollectionDisabled; }
     bool IsHeapEnumInProgress() const { Assert(isHeapEnumInProgress ? isCollectionDisabled : true); return isHeapEnumInProgress; }
 
+    template <typename Fn>
+    void MapPinnedObjects(Fn fn)
+    {
+        pinnedObjectMap.Map([&](void * obj, PinRecord const& refCount)
+        {
+            if (refCount != 0)
+            {
+                fn(obj);
+            }
+        });
+    }
+
 #if DBG
     // There are limited cases that we have to allow allocation during heap enumeration. GC is explicitly
     // disabled during heap enumeration for these limited cases. (See DefaultRecyclerCollectionWrapper)
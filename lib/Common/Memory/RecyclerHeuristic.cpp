@@ -71,9 +71,9 @@ RecyclerHeuristic::ConfigureBaseFactor(uint baseFactor)
 }
 
 uint
-RecyclerHeuristic::UncollectedAllocBytesCollection()
+RecyclerHeuristic::UncollectedAllocBytesCollection(bool largeCollectionBudget)
 {
-    return DefaultUncollectedAllocBytesCollection;
+    return largeCollectionBudget ? LargeUncollectedAllocBytesCollection : DefaultUncollectedAllocBytesCollection;
 }
 
 #if ENABLE_CONCURRENT_GC
@@ -35,7 +35,7 @@ public:
     uint   DefaultMaxFreePageCount;
 
     // Constant heuristic that may be changed by switches
-    static uint UncollectedAllocBytesCollection();
+    static uint UncollectedAllocBytesCollection(bool largeCollectionBudget);
 #if ENABLE_CONCURRENT_GC
     static uint MaxBackgroundFinishMarkCount(Js::ConfigFlagsTable&);
     static DWORD BackgroundFinishMarkWaitTime(bool, Js::ConfigFlagsTable&);
@@ -68,6 +68,7 @@ private:
 #define RECYCLER_HEURISTIC_VERSION 11
 #endif
     static const uint DefaultUncollectedAllocBytesCollection = 1 MEGABYTES;
+    static const uint LargeUncollectedAllocBytesCollection = 4 MEGABYTES;     // When the host asks for fewer collections
 
 #if ENABLE_CONCURRENT_GC
     static const uint TickCountConcurrentPriorityBoost = 5000;                              // 5 second
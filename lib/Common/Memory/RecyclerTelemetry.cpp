@@ -0,0 +1,160 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+#include "CommonMemoryPch.h"
+
+RecyclerTelemetry::RecyclerTelemetry() :
+    ticksPerSecond(0),
+    callback(nullptr),
+    callbackContext(nullptr),
+    inCollection(false),
+    collectionStartTicks(0),
+    collectionCount(0),
+    totalElapsedTicks(0),
+    maxElapsedTicks(0),
+    largeObjectAllocCount(0),
+    largeObjectAllocBytes(0)
+{
+    LARGE_INTEGER frequency;
+    if (QueryPerformanceFrequency(&frequency))
+    {
+        this->ticksPerSecond = frequency.QuadPart;
+    }
+    memset(&this->current, 0, sizeof(this->current));
+    memset(this->phaseStartTicks, 0, sizeof(this->phaseStartTicks));
+    memset(this->phaseTicks, 0, sizeof(this->phaseTicks));
+    memset(this->totalPhaseTicks, 0, sizeof(this->totalPhaseTicks));
+}
+
+uint64
+RecyclerTelemetry::GetTicks()
+{
+    LARGE_INTEGER counter;
+    if (!QueryPerformanceCounter(&counter))
+    {
+        return 0;
+    }
+    return counter.QuadPart;
+}
+
+uint64
+RecyclerTelemetry::ToMicroseconds(uint64 ticks) const
+{
+    if (this->ticksPerSecond == 0)
+    {
+        return 0;
+    }
+    // Split to avoid overflowing ticks * 1000000 on long runs
+    return (ticks / this->ticksPerSecond) * 1000000 + (ticks % this->ticksPerSecond) * 1000000 / this->ticksPerSecond;
+}
+
+RecyclerCollectionReason
+RecyclerTelemetry::GetCollectionReason(uint collectionFlags)
+{
+    if (collectionFlags & CollectMode_DecommitNow)
+    {
+        return RecyclerCollectionReasonMemoryPressure;
+    }
+    if ((collectionFlags & CollectOverride_AllowReentrant) && (collectionFlags & (CollectHeuristic_AllocSize | CollectHeuristic_Time)))
+    {
+        return RecyclerCollectionReasonAllocation;
+    }
+    if (collectionFlags & CollectMode_CacheCleanup)
+    {
+        return RecyclerCollectionReasonIdle;
+    }
+    if (collectionFlags & (CollectOverride_Explicit | CollectMode_Exhaustive | CollectOverride_ForceInThread))
+    {
+        return RecyclerCollectionReasonExplicit;
+    }
+    return RecyclerCollectionReasonOther;
+}
+
+void
+RecyclerTelemetry::BeginCollection(RecyclerCollectionReason reason, bool partial, bool concurrent, size_t usedBytes)
+{
+    this->inCollection = true;
+    this->collectionStartTicks = GetTicks();
+    memset(this->phaseTicks, 0, sizeof(this->phaseTicks));
+
+    this->current.reason = reason;
+    this->current.partial = partial;
+    this->current.concurrent = concurrent;
+    this->current.usedBytesBefore = usedBytes;
+}
+
+void
+RecyclerTelemetry::EndCollection(size_t usedBytes)
+{
+    if (!this->inCollection)
+    {
+        return;
+    }
+    this->inCollection = false;
+
+    uint64 elapsedTicks = GetTicks() - this->collectionStartTicks;
+    this->collectionCount++;
+    this->totalElapsedTicks += elapsedTicks;
+    if (elapsedTicks > this->maxElapsedTicks)
+    {
+        this->maxElapsedTicks = elapsedTicks;
+    }
+
+    if (this->callback == nullptr)
+    {
+        return;
+    }
+
+    uint64 pauseTicks = 0;
+    for (uint i = 0; i < RecyclerTelemetryPhaseCount; i++)
+    {
+        uint64 ticks = 0;
+        for (uint thread = 0; thread < RecyclerTelemetryThreadCount; thread++)
+        {
+            ticks += this->phaseTicks[thread][i];
+        }
+        this->current.phaseTime[i] = ToMicroseconds(ticks);
+        pauseTicks += this->phaseTicks[RecyclerTelemetryThreadMain][i];
+    }
+    this->current.elapsedTime = ToMicroseconds(elapsedTicks);
+    this->current.pauseTime = ToMicroseconds(pauseTicks);
+    this->current.usedBytesAfter = usedBytes;
+
+    this->callback(this->callbackContext, this->current);
+}
+
+void
+RecyclerTelemetry::BeginPhase(RecyclerTelemetryPhase phase, RecyclerTelemetryThread thread)
+{
+    Assert(phase < RecyclerTelemetryPhaseCount);
+    Assert(thread < RecyclerTelemetryThreadCount);
+    this->phaseStartTicks[thread][phase] = GetTicks();
+}
+
+void
+RecyclerTelemetry::EndPhase(RecyclerTelemetryPhase phase, RecyclerTelemetryThread thread)
+{
+    Assert(phase < RecyclerTelemetryPhaseCount);
+    Assert(thread < RecyclerTelemetryThreadCount);
+    uint64 ticks = GetTicks() - this->phaseStartTicks[thread][phase];
+    this->totalPhaseTicks[thread][phase] += ticks;
+
+    // Dispose and lazy sweep that run outside of a collection only count toward the totals
+    if (this->inCollection)
+    {
+        this->phaseTicks[thread][phase] += ticks;
+    }
+}
+
+uint64
+RecyclerTelemetry::GetTotalPhaseTime(RecyclerTelemetryPhase phase) const
+{
+    Assert(phase < RecyclerTelemetryPhaseCount);
+    uint64 ticks = 0;
+    for (uint thread = 0; thread < RecyclerTelemetryThreadCount; thread++)
+    {
+        ticks += this->totalPhaseTicks[thread][phase];
+    }
+    return ToMicroseconds(ticks);
+}
@@ -0,0 +1,129 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+#pragma once
+
+namespace Memory
+{
+// Why a collection was started, derived from the collection flags
+enum RecyclerCollectionReason
+{
+    RecyclerCollectionReasonAllocation,         // allocation size or time heuristic
+    RecyclerCollectionReasonIdle,               // script idle or exit
+    RecyclerCollectionReasonExplicit,           // host or script asked for a collection
+    RecyclerCollectionReasonMemoryPressure,     // recovering from OOM, suspend or decommit request
+    RecyclerCollectionReasonOther,
+};
+
+enum RecyclerTelemetryPhase
+{
+    RecyclerTelemetryPhaseRootScan,
+    RecyclerTelemetryPhaseMark,
+    RecyclerTelemetryPhaseSweep,
+    RecyclerTelemetryPhaseFinalize,
+    RecyclerTelemetryPhaseLazySweep,        // sweeping blocks a collection left pending, outside of the collection
+    RecyclerTelemetryPhaseCount
+};
+
+// The thread timing a phase. Each keeps its own phase start times and tick counts, so the background
+// thread of a concurrent collection never writes to what the main thread is timing.
+enum RecyclerTelemetryThread
+{
+    RecyclerTelemetryThreadMain,
+    RecyclerTelemetryThreadBackground,
+    RecyclerTelemetryThreadCount
+};
+
+// Summary of one collection, all times in microseconds
+struct RecyclerCollectionTelemetry
+{
+    RecyclerCollectionReason reason;
+    bool partial;
+    bool concurrent;
+    uint64 phaseTime[RecyclerTelemetryPhaseCount];
+    uint64 elapsedTime;         // from the start of the collection until it finished, including any time spent in script
+    uint64 pauseTime;           // phases run on the main thread, during which script was stopped
+    size_t usedBytesBefore;
+    size_t usedBytesAfter;
+};
+
+typedef void (*RecyclerCollectionTelemetryCallback)(void * context, RecyclerCollectionTelemetry const& telemetry);
+
+// Always-on collection telemetry. Only a timestamp per phase boundary is taken during a collection and the
+// counters are plain increments, so this stays on in release builds. Background phases of a concurrent
+// collection are accounted to the same collection; their ticks are kept apart from the main thread's and
+// only added together once the collection is over.
+class RecyclerTelemetry
+{
+public:
+    RecyclerTelemetry();
+
+    void BeginCollection(RecyclerCollectionReason reason, bool partial, bool concurrent, size_t usedBytes);
+    void EndCollection(size_t usedBytes);
+    void BeginPhase(RecyclerTelemetryPhase phase, RecyclerTelemetryThread thread = RecyclerTelemetryThreadMain);
+    void EndPhase(RecyclerTelemetryPhase phase, RecyclerTelemetryThread thread = RecyclerTelemetryThreadMain);
+
+    void SetCollectionCallback(void * context, RecyclerCollectionTelemetryCallback callback)
+    {
+        this->callbackContext = context;
+        this->callback = callback;
+    }
+
+    void RecordLargeObjectAllocation(size_t size)
+    {
+        this->largeObjectAllocCount++;
+        this->largeObjectAllocBytes += size;
+    }
+
+    uint GetCollectionCount() const { return collectionCount; }
+    uint64 GetTotalPhaseTime(RecyclerTelemetryPhase phase) const;
+    uint64 GetTotalElapsedTime() const { return ToMicroseconds(totalElapsedTicks); }
+    uint64 GetMaxElapsedTime() const { return ToMicroseconds(maxElapsedTicks); }
+    size_t GetLargeObjectAllocCount() const { return largeObjectAllocCount; }
+    size_t GetLargeObjectAllocBytes() const { return largeObjectAllocBytes; }
+
+    static RecyclerCollectionReason GetCollectionReason(uint collectionFlags);
+
+private:
+    static uint64 GetTicks();
+    uint64 ToMicroseconds(uint64 ticks) const;
+
+    uint64 ticksPerSecond;
+    RecyclerCollectionTelemetryCallback callback;
+    void * callbackContext;
+
+    // The collection in progress
+    bool inCollection;
+    RecyclerCollectionTelemetry current;
+    uint64 collectionStartTicks;
+    uint64 phaseStartTicks[RecyclerTelemetryThreadCount][RecyclerTelemetryPhaseCount];
+    uint64 phaseTicks[RecyclerTelemetryThreadCount][RecyclerTelemetryPhaseCount];
+
+    // Running counters since the recycler was created
+    uint collectionCount;
+    uint64 totalPhaseTicks[RecyclerTelemetryThreadCount][RecyclerTelemetryPhaseCount];
+    uint64 totalElapsedTicks;
+    uint64 maxElapsedTicks;
+    size_t largeObjectAllocCount;
+    size_t largeObjectAllocBytes;
+};
+
+class AutoRecyclerTelemetryPhase
+{
+public:
+    AutoRecyclerTelemetryPhase(RecyclerTelemetry& telemetry, RecyclerTelemetryPhase phase, RecyclerTelemetryThread thread = RecyclerTelemetryThreadMain) :
+        telemetry(telemetry), phase(phase), thread(thread)
+    {
+        telemetry.BeginPhase(phase, thread);
+    }
+    ~AutoRecyclerTelemetryPhase()
+    {
+        telemetry.EndPhase(phase, thread);
+    }
+private:
+    RecyclerTelemetry& telemetry;
+    RecyclerTelemetryPhase phase;
+    RecyclerTelemetryThread thread;
+};
+}
@@ -230,6 +230,7 @@ public:
     }
 
     void Initialize(HeapInfo * heapInfo, uint sizeCat);
+    void AggregateAllocationStats(HeapBucketAllocationStats& stats) const;
     void ResetMarks(ResetMarkFlags flags);
     void ScanInitialImplicitRoots(Recycler * recycler);
     void ScanNewImplicitRoots(Recycler * recycler);
@@ -239,6 +240,10 @@ public:
 #if ENABLE_CONCURRENT_GC
     void SweepPendingObjects(RecyclerSweep& recyclerSweep);
 #endif
+#if ENABLE_LAZY_SWEEP
+    void SweepLazySweepList(Recycler * recycler);
+    uint SweepLazySweepBlocks(Recycler * recycler, uint maxBlockCount);
+#endif
 #if ENABLE_PARTIAL_GC
     void SweepPartialReusePages(RecyclerSweep& recyclerSweep);
     void FinishPartialCollect(RecyclerSweep * recyclerSweep);
@@ -104,6 +104,7 @@ SmallHeapBlockAllocator<TBlockType>::Clear()
         {
             uint lastFreeCount = heapBlock->GetAndClearLastFreeCount();
             heapBlock->heapBucket->heapInfo->uncollectedAllocBytes += lastFreeCount * heapBlock->GetObjectSize();
+            heapBlock->heapBucket->AddAllocatedObjectCount(lastFreeCount);
             Assert(heapBlock->lastUncollectedAllocBytes == 0);
             DebugOnly(heapBlock->lastUncollectedAllocBytes = lastFreeCount * heapBlock->GetObjectSize());
         }
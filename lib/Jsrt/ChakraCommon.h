@@ -406,7 +406,13 @@ typedef unsigned char* ChakraBytePtr;
         ///     Calling <c>JsSetException</c> will also dispatch the exception to the script debugger
         ///     (if any) giving the debugger a chance to break on the exception.
         /// </summary>
-        JsRuntimeAttributeDispatchSetExceptionsToDebugger = 0x00000040
+        JsRuntimeAttributeDispatchSetExceptionsToDebugger = 0x00000040,
+        /// <summary>
+        ///     The garbage collector will let 4 MB rather than 1 MB be allocated between collections,
+        ///     so allocation heavy hosts see fewer collections at the cost of a larger memory footprint.
+        ///     Size classes and heap block sizes are not affected.
+        /// </summary>
+        JsRuntimeAttributeEnableLargeCollectionBudget = 0x00000080
     } JsRuntimeAttributes;
 
     /// <summary>
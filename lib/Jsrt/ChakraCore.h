@@ -163,4 +163,404 @@ JsGetModuleHostInfo(
     _In_ JsModuleHostInfoKind moduleHostInfo,
     _Outptr_result_maybenull_ void** hostInfo);
 
+/// <summary>
+///     The reason a garbage collection was started.
+/// </summary>
+typedef enum _JsCollectionReason
+{
+    /// <summary>
+    ///     The amount allocated or the time since the last collection reached the collection heuristic.
+    /// </summary>
+    JsCollectionReasonAllocation = 0,
+    /// <summary>
+    ///     Script went idle or exited.
+    /// </summary>
+    JsCollectionReasonIdle = 1,
+    /// <summary>
+    ///     The host or script requested a collection, e.g. through <c>JsCollectGarbage</c>.
+    /// </summary>
+    JsCollectionReasonExplicit = 2,
+    /// <summary>
+    ///     The runtime is recovering from an out of memory condition or was asked to release memory.
+    /// </summary>
+    JsCollectionReasonMemoryPressure = 3,
+    /// <summary>
+    ///     Any other reason.
+    /// </summary>
+    JsCollectionReasonOther = 4,
+} JsCollectionReason;
+
+/// <summary>
+///     Summary of a completed garbage collection. All times are in microseconds.
+/// </summary>
+typedef struct _JsCollectionInfo
+{
+    JsCollectionReason reason;
+    bool isPartial;
+    bool isConcurrent;
+    unsigned long long rootScanTime;
+    unsigned long long markTime;
+    unsigned long long sweepTime;
+    unsigned long long finalizeTime;
+    /// <summary>
+    ///     Time from the start to the end of the collection. For a concurrent collection this includes
+    ///     script that ran while the collection was in progress.
+    /// </summary>
+    unsigned long long elapsedTime;
+    /// <summary>
+    ///     Time the phases of the collection ran on the thread that runs script, which is stopped
+    ///     meanwhile. Background marking and sweeping of a concurrent collection are not included.
+    /// </summary>
+    unsigned long long pauseTime;
+    size_t bytesBefore;
+    size_t bytesAfter;
+} JsCollectionInfo;
+
+/// <summary>
+///     A callback called after each garbage collection.
+/// </summary>
+/// <remarks>
+///     Use <c>JsSetRuntimeCollectionCallback</c> to register this callback.
+/// </remarks>
+/// <param name="callbackState">The state passed to <c>JsSetRuntimeCollectionCallback</c>.</param>
+/// <param name="collectionInfo">The summary of the collection, only valid during the callback.</param>
+typedef void (CHAKRA_CALLBACK *JsCollectionCallback)(_In_opt_ void *callbackState, _In_ const JsCollectionInfo *collectionInfo);
+
+/// <summary>
+///     Sets a callback function that is called by the runtime after each garbage collection.
+/// </summary>
+/// <remarks>
+///     <para>
+///     The callback is invoked on the runtime execution thread while the collection is finishing,
+///     so it must not call back into the runtime and should return quickly.
+///     </para>
+///     <para>
+///     Collection timings are always recorded, registering a callback only adds the call itself.
+///     </para>
+/// </remarks>
+/// <param name="runtime">The runtime for which to register the callback.</param>
+/// <param name="callbackState">
+///     User provided state that will be passed back to the callback.
+/// </param>
+/// <param name="collectionCallback">The callback function being set, or nullptr to remove it.</param>
+/// <returns>
+///     The code <c>JsNoError</c> if the operation succeeded, a failure code otherwise.
+/// </returns>
+CHAKRA_API
+JsSetRuntimeCollectionCallback(
+    _In_ JsRuntimeHandle runtime,
+    _In_opt_ void *callbackState,
+    _In_opt_ JsCollectionCallback collectionCallback);
+
+/// <summary>
+///     Running garbage collector and memory counters of a runtime. Times are in microseconds.
+/// </summary>
+typedef struct _JsRuntimeHeapStatistics
+{
+    unsigned int collectionCount;
+    unsigned long long totalRootScanTime;
+    unsigned long long totalMarkTime;
+    unsigned long long totalSweepTime;
+    unsigned long long totalFinalizeTime;
+    unsigned long long totalCollectionTime;
+    unsigned long long maxCollectionTime;
+    /// <summary>
+    ///     Time spent sweeping the heap blocks a collection left to be swept on demand, after the
+    ///     collection ended. Not part of <c>totalCollectionTime</c>.
+    /// </summary>
+    unsigned long long totalLazySweepTime;
+
+    /// <summary>
+    ///     Pages of the garbage collected heap, excluding leaf objects.
+    /// </summary>
+    size_t recyclerUsedBytes;
+    size_t recyclerCommittedBytes;
+    size_t recyclerReservedBytes;
+
+    /// <summary>
+    ///     Objects too large for the size class buckets.
+    /// </summary>
+    size_t largeObjectUsedBytes;
+    size_t largeObjectAllocationCount;
+    size_t largeObjectAllocatedBytes;
+
+    /// <summary>
+    ///     Pages shared by the arena allocators and the leaf objects of the garbage collected heap.
+    /// </summary>
+    size_t arenaUsedBytes;
+    size_t arenaCommittedBytes;
+    size_t arenaReservedBytes;
+} JsRuntimeHeapStatistics;
+
+/// <summary>
+///     Gets the running garbage collector and memory counters of a runtime.
+/// </summary>
+/// <remarks>
+///     Must be called on the thread the runtime is used on, and not while a collection is in
+///     progress. The collection callback runs after the collection ended, so the counters can be
+///     read from there.
+/// </remarks>
+/// <param name="runtime">The runtime to query.</param>
+/// <param name="statistics">The counters.</param>
+/// <returns>
+///     The code <c>JsNoError</c> if the operation succeeded, <c>JsErrorRuntimeInUse</c> if a
+///     collection or heap enumeration is in progress, a failure code otherwise.
+/// </returns>
+CHAKRA_API
+JsGetRuntimeHeapStatistics(
+    _In_ JsRuntimeHandle runtime,
+    _Out_ JsRuntimeHeapStatistics *statistics);
+
+/// <summary>
+///     Allocation counters of one size class of the garbage collected heap.
+/// </summary>
+typedef struct _JsHeapBucketStatistics
+{
+    unsigned int objectSize;
+    /// <summary>
+    ///     Objects allocated, counted when the allocator moves off a heap block.
+    /// </summary>
+    size_t allocatedObjectCount;
+    size_t allocatedBlockCount;
+    size_t slowAllocationCount;
+} JsHeapBucketStatistics;
+
+/// <summary>
+///     Gets the allocation counters of each size class of the garbage collected heap.
+/// </summary>
+/// <remarks>
+///     Must be called on the thread the runtime is used on, and not while a collection is in
+///     progress.
+/// </remarks>
+/// <param name="runtime">The runtime to query.</param>
+/// <param name="buckets">
+///     Buffer that receives the counters, ordered by object size. Can be nullptr to query the count.
+/// </param>
+/// <param name="bucketCount">The number of entries in <paramref name="buckets" />.</param>
+/// <param name="actualBucketCount">The number of size classes in the heap.</param>
+/// <returns>
+///     The code <c>JsNoError</c> if the operation succeeded, <c>JsErrorRuntimeInUse</c> if a
+///     collection or heap enumeration is in progress, a failure code otherwise.
+/// </returns>
+CHAKRA_API
+JsGetRuntimeHeapBucketStatistics(
+    _In_ JsRuntimeHandle runtime,
+    _Out_writes_to_opt_(bucketCount, *actualBucketCount) JsHeapBucketStatistics *buckets,
+    _In_ unsigned int bucketCount,
+    _Out_ unsigned int *actualBucketCount);
+
+/// <summary>
+///     The kind of a record in a heap snapshot.
+/// </summary>
+/// <remarks>
+///     <para>
+///     A snapshot starts with the four bytes <c>CHHS</c> and a 32-bit format version, followed by
+///     records that each start with a one byte <c>JsHeapSnapshotRecordKind</c>. Integers are in the
+///     byte order of the host and names are UTF-16 code units without a terminator.
+///     </para>
+///     <para>
+///     String:  uint32 id, uint8 isSymbol, uint32 length, char16 name[length]
+///     Root:    uint8 JsHeapSnapshotRootKind, uint64 node id
+///     Node:    uint8 JsHeapSnapshotNodeKind, uint64 node id, uint32 type id, uint64 self size,
+///              uint32 name length, char16 name[name length]
+///     Edge:    uint8 JsHeapSnapshotEdgeKind, uint32 name or index, uint64 target node id
+///     End:     uint64 node count, uint64 edge count
+///     </para>
+///     <para>
+///     Edge records belong to the node record that precedes them. The name of a property, getter,
+///     setter or closure variable edge is the id of a string record written earlier in the stream.
+///     Node ids are only unique within one snapshot. The type id of an object node is the engine's
+///     internal <c>TypeId</c>, which can change between engine versions.
+///     </para>
+/// </remarks>
+typedef enum _JsHeapSnapshotRecordKind
+{
+    JsHeapSnapshotRecordString = 1,
+    JsHeapSnapshotRecordRoot = 2,
+    JsHeapSnapshotRecordNode = 3,
+    JsHeapSnapshotRecordEdge = 4,
+    JsHeapSnapshotRecordEnd = 5,
+} JsHeapSnapshotRecordKind;
+
+/// <summary>
+///     Why a heap snapshot root is alive.
+/// </summary>
+typedef enum _JsHeapSnapshotRootKind
+{
+    /// <summary>
+    ///     The global object of a context.
+    /// </summary>
+    JsHeapSnapshotRootGlobalObject = 0,
+    /// <summary>
+    ///     An object the host holds a reference on through <c>JsAddRef</c>.
+    /// </summary>
+    JsHeapSnapshotRootPinned = 1,
+} JsHeapSnapshotRootKind;
+
+/// <summary>
+///     The kind of a heap snapshot node.
+/// </summary>
+typedef enum _JsHeapSnapshotNodeKind
+{
+    /// <summary>
+    ///     A script object, string or function. The name is the function name or the contents of a
+    ///     flat string.
+    /// </summary>
+    JsHeapSnapshotNodeObject = 0,
+    /// <summary>
+    ///     The captured variables of a function scope. The name is the function name.
+    /// </summary>
+    JsHeapSnapshotNodeScope = 1,
+} JsHeapSnapshotNodeKind;
+
+/// <summary>
+///     The kind of a heap snapshot edge.
+/// </summary>
+typedef enum _JsHeapSnapshotEdgeKind
+{
+    JsHeapSnapshotEdgeProperty = 0,
+    JsHeapSnapshotEdgeElement = 1,
+    JsHeapSnapshotEdgePrototype = 2,
+    JsHeapSnapshotEdgeGetter = 3,
+    JsHeapSnapshotEdgeSetter = 4,
+    /// <summary>
+    ///     From a function to a scope of its closure, indexed from the innermost scope.
+    /// </summary>
+    JsHeapSnapshotEdgeScope = 5,
+    /// <summary>
+    ///     From a scope to a captured variable, named by a string id or <c>JsHeapSnapshotNoName</c>.
+    /// </summary>
+    JsHeapSnapshotEdgeClosureVariable = 6,
+    /// <summary>
+    ///     From a Map to a key or a value, indexed by the entry in insertion order.
+    /// </summary>
+    JsHeapSnapshotEdgeCollectionKey = 7,
+    JsHeapSnapshotEdgeCollectionValue = 8,
+} JsHeapSnapshotEdgeKind;
+
+#define JsHeapSnapshotNoName 0xFFFFFFFF
+
+/// <summary>
+///     A callback that receives the next part of a heap snapshot.
+/// </summary>
+/// <param name="callbackState">The state passed to <c>JsTakeHeapSnapshot</c>.</param>
+/// <param name="bytes">The next bytes of the snapshot, only valid during the callback.</param>
+/// <param name="byteCount">The number of bytes.</param>
+/// <returns>true to continue, false to stop the snapshot.</returns>
+typedef bool (CHAKRA_CALLBACK *JsHeapSnapshotWriteCallback)(_In_opt_ void *callbackState, _In_reads_(byteCount) const unsigned char *bytes, _In_ size_t byteCount);
+
+/// <summary>
+///     Walks the objects reachable from the global objects of the contexts of a runtime and from the
+///     objects pinned with <c>JsAddRef</c>, and streams a snapshot of them to a callback.
+/// </summary>
+/// <remarks>
+///     <para>
+///     The walk runs synchronously on the calling thread without running script or collecting
+///     garbage, so it can be used on a runtime that is serving requests. Objects only referenced
+///     from the native stack are not included.
+///     </para>
+///     <para>
+///     Visited objects are tracked with the garbage collector's mark bits. Besides the objects
+///     waiting to be visited, at most 1M of them at a time, only a fixed size output buffer is
+///     allocated. The callback is called each time the buffer fills and must not call back into
+///     the runtime.
+///     </para>
+///     <para>
+///     See <c>JsHeapSnapshotRecordKind</c> for the format.
+///     </para>
+/// </remarks>
+/// <param name="runtime">The runtime to walk.</param>
+/// <param name="writeCallback">The callback that receives the snapshot.</param>
+/// <param name="callbackState">
+///     User provided state that will be passed back to the callback.
+/// </param>
+/// <returns>
+///     The code <c>JsNoError</c> if the operation succeeded or the callback stopped it,
+///     <c>JsErrorOutOfMemory</c> if more objects were waiting to be visited than allowed, in which
+///     case the snapshot ends without an End record, a failure code otherwise.
+/// </returns>
+CHAKRA_API
+JsTakeHeapSnapshot(
+    _In_ JsRuntimeHandle runtime,
+    _In_ JsHeapSnapshotWriteCallback writeCallback,
+    _In_opt_ void *callbackState);
+
+/// <summary>
+///     Parses UTF-8 encoded JSON text into a value, like <c>JSON.parse</c> without a reviver.
+/// </summary>
+/// <remarks>
+///     <para>
+///     The text is parsed directly, without first converting it to a string value, and strings
+///     are transcoded one at a time as they are found. The buffer need not be null terminated.
+///     Invalid UTF-8 sequences are decoded the same way as by <c>JsPointerToStringUtf8</c>.
+///     </para>
+///     <para>
+///     If the text is not valid JSON, a <c>SyntaxError</c> is thrown and the runtime is put in an
+///     exception state, as if <c>JSON.parse</c> had been called from script.
+///     </para>
+///     <para>
+///     Requires an active script context.
+///     </para>
+/// </remarks>
+/// <param name="buffer">The JSON text, encoded as UTF-8.</param>
+/// <param name="length">The length of the text in bytes.</param>
+/// <param name="result">The parsed value.</param>
+/// <returns>
+///     The code <c>JsNoError</c> if the operation succeeded, a failure code otherwise.
+/// </returns>
+CHAKRA_API
+JsParseJsonUtf8(
+    _In_reads_(length) const char *buffer,
+    _In_ size_t length,
+    _Out_ JsValueRef *result);
+
+/// <summary>
+///     A callback that receives the next part of the JSON text written by <c>JsStringifyJsonUtf8</c>.
+/// </summary>
+/// <param name="callbackState">The state passed to <c>JsStringifyJsonUtf8</c>.</param>
+/// <param name="chunk">The next UTF-8 encoded part of the text, only valid during the callback.</param>
+/// <param name="length">The length of the part in bytes.</param>
+/// <returns>true to continue, false to stop writing.</returns>
+typedef bool (CHAKRA_CALLBACK *JsJsonWriteCallback)(_In_opt_ void *callbackState, _In_reads_(length) const char *chunk, _In_ size_t length);
+
+/// <summary>
+///     Converts a value to UTF-8 encoded JSON text, like <c>JSON.stringify</c> without a replacer,
+///     and streams the text to a callback.
+/// </summary>
+/// <remarks>
+///     <para>
+///     The text is written through a fixed size buffer, in parts of at most 48KB, and is never
+///     built as a single string. Plain objects and arrays are written directly; only values that
+///     have a <c>toJSON</c> method, accessors or other special behavior are stringified on their
+///     own before being written. The callback must not call back into the runtime.
+///     </para>
+///     <para>
+///     If the value has no JSON text (undefined, a function or a symbol), the callback is not
+///     called. If script throws, for example because the value contains a cycle, the runtime is
+///     put in an exception state and the text written so far is incomplete.
+///     </para>
+///     <para>
+///     Requires an active script context.
+///     </para>
+/// </remarks>
+/// <param name="value">The value to convert.</param>
+/// <param name="space">
+///     The indentation, a number or a string as for <c>JSON.stringify</c>, or
+///     <c>JS_INVALID_REFERENCE</c> for none.
+/// </param>
+/// <param name="writeCallback">The callback that receives the text.</param>
+/// <param name="callbackState">
+///     User provided state that will be passed back to the callback.
+/// </param>
+/// <returns>
+///     The code <c>JsNoError</c> if the operation succeeded or the callback stopped it, a failure
+///     code otherwise.
+/// </returns>
+CHAKRA_API
+JsStringifyJsonUtf8(
+    _In_ JsValueRef value,
+    _In_opt_ JsValueRef space,
+    _In_ JsJsonWriteCallback writeCallback,
+    _In_opt_ void *callbackState);
+
 #endif // _CHAKRACORE_H_
@@ -893,6 +893,42 @@ typedef UINT32 DWORD;
     CHAKRA_API
         JsTTDEmitTimeTravelRecording();
 
+    /// <summary>
+    ///     TTD API -- may change in future versions:
+    ///     Emit a startup snapshot of the current context and stop Time-Travel Recording.
+    /// </summary>
+    /// <remarks>
+    ///     <para>
+    ///         The current context must have been created with <c>JsTTDCreateContext</c> in a runtime from
+    ///         <c>JsTTDCreateRecordRuntime</c> and be recording. The host runs its bootstrap scripts first, then this
+    ///         writes a snapshot of the context (with the property records and scripts it needs) to the runtime's uri.
+    ///     </para>
+    ///     <para>The context keeps running normally afterwards but is no longer recorded.</para>
+    /// </remarks>
+    /// <returns>The code <c>JsNoError</c> if the operation succeeded, a failure code otherwise.</returns>
+    CHAKRA_API
+        JsTTDEmitStartupSnapshot();
+
+    /// <summary>
+    ///     TTD API -- may change in future versions:
+    ///     Restore the current context from a startup snapshot written by <c>JsTTDEmitStartupSnapshot</c>.
+    /// </summary>
+    /// <remarks>
+    ///     <para>
+    ///         The current context must be a fresh context created with <c>JsTTDCreateContext</c> in a runtime from
+    ///         <c>JsTTDCreateDebugRuntime</c> whose uri holds the startup snapshot. The snapshot is read once when the
+    ///         first such context is created and can be inflated into each later context created in that runtime.
+    ///     </para>
+    ///     <para>
+    ///         The context is detached from Time-Travel after the inflate but keeps the debug bytecode (and, in builds
+    ///         with TTD debugging, the no-JIT setting) of a TTD runtime, so this is not yet a startup path for
+    ///         production hosts.
+    ///     </para>
+    /// </remarks>
+    /// <returns>The code <c>JsNoError</c> if the operation succeeded, a failure code otherwise.</returns>
+    CHAKRA_API
+        JsTTDInflateStartupSnapshot();
+
     /// <summary>
     ///     TTD API -- may change in future versions:
     ///     Start Time-Travel Debugging.
@@ -9,10 +9,13 @@
 #include "jsrtHelper.h"
 
 #include "JsrtSourceHolder.h"
+#include "JsrtHeapSnapshot.h"
 #include "ByteCode/ByteCodeSerializer.h"
 #include "Common/ByteSwap.h"
 #include "Library/DataView.h"
 #include "Library/JavascriptSymbol.h"
+#include "Library/JSON.h"
+#include "Library/JSONStringifier.h"
 #include "Base/ThreadContextTlsEntry.h"
 #include "Codex/Utf8Helper.h"
 
@@ -117,7 +120,8 @@ JsErrorCode CreateRuntimeCore(_In_ JsRuntimeAttributes attributes, _In_opt_ char
             JsRuntimeAttributeDisableEval |
             JsRuntimeAttributeDisableNativeCodeGeneration |
             JsRuntimeAttributeEnableExperimentalFeatures |
-            JsRuntimeAttributeDispatchSetExceptionsToDebugger
+            JsRuntimeAttributeDispatchSetExceptionsToDebugger |
+            JsRuntimeAttributeEnableLargeCollectionBudget
 #ifdef ENABLE_DEBUG_CONFIG_OPTIONS
             | JsRuntimeAttributeSerializeLibraryByteCode
 #endif
@@ -169,6 +173,11 @@ JsErrorCode CreateRuntimeCore(_In_ JsRuntimeAttributes attributes, _In_opt_ char
             threadContext->SetThreadContextFlag(ThreadContextFlagNoJIT);
         }
 
+        if (attributes & JsRuntimeAttributeEnableLargeCollectionBudget)
+        {
+            threadContext->SetLargeCollectionBudget(true);
+        }
+
 #ifdef ENABLE_DEBUG_CONFIG_OPTIONS
         if (Js::Configuration::Global.flags.PrimeRecycler)
         {
@@ -1178,6 +1187,56 @@ CHAKRA_API JsPointerToStringUtf8(_In_reads_(stringLength) const char *stringValu
     return JsPointerToString(wstr, wstr.Length(), string);
 }
 
+CHAKRA_API JsParseJsonUtf8(_In_reads_(length) const char *buffer, _In_ size_t length, _Out_ JsValueRef *result)
+{
+    return ContextAPIWrapper<true>([&](Js::ScriptContext *scriptContext) -> JsErrorCode {
+        PARAM_NOT_NULL(buffer);
+        PARAM_NOT_NULL(result);
+        *result = nullptr;
+
+        PERFORM_JSRT_TTD_RECORD_ACTION_NOT_IMPLEMENTED(scriptContext);
+
+        if (!Js::IsValidCharCount(length))
+        {
+            Js::JavascriptError::ThrowOutOfMemoryError(scriptContext);
+        }
+
+        *result = JSON::ParseUtf8(reinterpret_cast<const utf8char_t *>(buffer), static_cast<charcount_t>(length), scriptContext);
+        return JsNoError;
+    });
+}
+
+struct JsrtJsonWriteState
+{
+    JsJsonWriteCallback writeCallback;
+    void *callbackState;
+
+    static bool Write(void *state, const utf8char_t *bytes, size_t byteCount)
+    {
+        JsrtJsonWriteState *writeState = static_cast<JsrtJsonWriteState *>(state);
+        return writeState->writeCallback(writeState->callbackState, reinterpret_cast<const char *>(bytes), byteCount);
+    }
+};
+
+CHAKRA_API JsStringifyJsonUtf8(_In_ JsValueRef value, _In_opt_ JsValueRef space, _In_ JsJsonWriteCallback writeCallback, _In_opt_ void *callbackState)
+{
+    return ContextAPIWrapper<true>([&](Js::ScriptContext *scriptContext) -> JsErrorCode {
+        VALIDATE_INCOMING_REFERENCE(value, scriptContext);
+        if (space != JS_INVALID_REFERENCE)
+        {
+            VALIDATE_INCOMING_REFERENCE(space, scriptContext);
+        }
+        PARAM_NOT_NULL(writeCallback);
+
+        PERFORM_JSRT_TTD_RECORD_ACTION_NOT_IMPLEMENTED(scriptContext);
+
+        JsrtJsonWriteState writeState = { writeCallback, callbackState };
+        JSON::StringifyUtf8(value, space != JS_INVALID_REFERENCE ? space : scriptContext->GetLibrary()->GetNull(),
+            JsrtJsonWriteState::Write, &writeState, scriptContext);
+        return JsNoError;
+    });
+}
+
 // TODO: The annotation of stringPtr is wrong.  Need to fix definition in chakrart.h
 // The warning is '*stringPtr' could be '0' : this does not adhere to the specification for the function 'JsStringToPointer'.
 #pragma warning(suppress:6387)
@@ -2613,6 +2672,188 @@ CHAKRA_API JsSetRuntimeBeforeCollectCallback(_In_ JsRuntimeHandle runtime, _In_o
     });
 }
 
+C_ASSERT(JsCollectionReasonAllocation == (_JsCollectionReason) RecyclerCollectionReasonAllocation);
+C_ASSERT(JsCollectionReasonIdle == (_JsCollectionReason) RecyclerCollectionReasonIdle);
+C_ASSERT(JsCollectionReasonExplicit == (_JsCollectionReason) RecyclerCollectionReasonExplicit);
+C_ASSERT(JsCollectionReasonMemoryPressure == (_JsCollectionReason) RecyclerCollectionReasonMemoryPressure);
+C_ASSERT(JsCollectionReasonOther == (_JsCollectionReason) RecyclerCollectionReasonOther);
+
+CHAKRA_API JsSetRuntimeCollectionCallback(_In_ JsRuntimeHandle runtime, _In_opt_ void *callbackState, _In_opt_ JsCollectionCallback collectionCallback)
+{
+    return GlobalAPIWrapper([&]() -> JsErrorCode {
+        VALIDATE_INCOMING_RUNTIME_HANDLE(runtime);
+
+        // The recycler may not have been created yet, and its allocators can only be used on the runtime's thread
+        ThreadContextScope scope(JsrtRuntime::FromHandle(runtime)->GetThreadContext());
+
+        if (!scope.IsValid())
+        {
+            return JsErrorWrongThread;
+        }
+
+        JsrtRuntime::FromHandle(runtime)->SetCollectionCallback(collectionCallback, callbackState);
+        return JsNoError;
+    });
+}
+
+CHAKRA_API JsGetRuntimeHeapStatistics(_In_ JsRuntimeHandle runtimeHandle, _Out_ JsRuntimeHeapStatistics *statistics)
+{
+    return GlobalAPIWrapper([&]() -> JsErrorCode {
+        VALIDATE_INCOMING_RUNTIME_HANDLE(runtimeHandle);
+        PARAM_NOT_NULL(statistics);
+        memset(statistics, 0, sizeof(JsRuntimeHeapStatistics));
+
+        ThreadContext * threadContext = JsrtRuntime::FromHandle(runtimeHandle)->GetThreadContext();
+        ThreadContextScope scope(threadContext);
+
+        if (!scope.IsValid())
+        {
+            return JsErrorWrongThread;
+        }
+
+        Recycler * recycler = threadContext->GetRecycler();
+        if (recycler == nullptr)
+        {
+            return JsNoError;
+        }
+
+        // The counters are only consistent between collections
+        if (recycler->CollectionInProgress() || recycler->IsHeapEnumInProgress())
+        {
+            return JsErrorRuntimeInUse;
+        }
+
+        RecyclerTelemetry& telemetry = recycler->GetTelemetry();
+        statistics->collectionCount = telemetry.GetCollectionCount();
+        statistics->totalRootScanTime = telemetry.GetTotalPhaseTime(RecyclerTelemetryPhaseRootScan);
+        statistics->totalMarkTime = telemetry.GetTotalPhaseTime(RecyclerTelemetryPhaseMark);
+        statistics->totalSweepTime = telemetry.GetTotalPhaseTime(RecyclerTelemetryPhaseSweep);
+        statistics->totalFinalizeTime = telemetry.GetTotalPhaseTime(RecyclerTelemetryPhaseFinalize);
+        statistics->totalCollectionTime = telemetry.GetTotalElapsedTime();
+        statistics->maxCollectionTime = telemetry.GetMaxElapsedTime();
+        statistics->totalLazySweepTime = telemetry.GetTotalPhaseTime(RecyclerTelemetryPhaseLazySweep);
+
+        PageAllocator * recyclerPageAllocators[] = {
+            recycler->GetRecyclerPageAllocator(),
+            recycler->GetRecyclerLargeBlockPageAllocator(),
+#ifdef RECYCLER_WRITE_BARRIER_ALLOC_SEPARATE_PAGE
+            recycler->GetRecyclerWithBarrierPageAllocator(),
+#endif
+        };
+        for (uint i = 0; i < _countof(recyclerPageAllocators); i++)
+        {
+            statistics->recyclerUsedBytes += recyclerPageAllocators[i]->GetUsedBytes();
+            statistics->recyclerCommittedBytes += recyclerPageAllocators[i]->GetCommittedBytes();
+            statistics->recyclerReservedBytes += recyclerPageAllocators[i]->GetReservedBytes();
+        }
+
+        statistics->largeObjectUsedBytes = recycler->GetRecyclerLargeBlockPageAllocator()->GetUsedBytes();
+        statistics->largeObjectAllocationCount = telemetry.GetLargeObjectAllocCount();
+        statistics->largeObjectAllocatedBytes = telemetry.GetLargeObjectAllocBytes();
+
+        PageAllocator * threadPageAllocator = threadContext->GetPageAllocator();
+        statistics->arenaUsedBytes = threadPageAllocator->GetUsedBytes();
+        statistics->arenaCommittedBytes = threadPageAllocator->GetCommittedBytes();
+        statistics->arenaReservedBytes = threadPageAllocator->GetReservedBytes();
+
+        return JsNoError;
+    });
+}
+
+CHAKRA_API JsGetRuntimeHeapBucketStatistics(_In_ JsRuntimeHandle runtimeHandle, _Out_writes_to_opt_(bucketCount, *actualBucketCount) JsHeapBucketStatistics *buckets, _In_ unsigned int bucketCount, _Out_ unsigned int *actualBucketCount)
+{
+    return GlobalAPIWrapper([&]() -> JsErrorCode {
+        VALIDATE_INCOMING_RUNTIME_HANDLE(runtimeHandle);
+        PARAM_NOT_NULL(actualBucketCount);
+        *actualBucketCount = 0;
+
+        ThreadContext * threadContext = JsrtRuntime::FromHandle(runtimeHandle)->GetThreadContext();
+        ThreadContextScope scope(threadContext);
+
+        if (!scope.IsValid())
+        {
+            return JsErrorWrongThread;
+        }
+
+        Recycler * recycler = threadContext->GetRecycler();
+        if (recycler == nullptr)
+        {
+            return JsNoError;
+        }
+
+        // Sweep and the allocators moving off their blocks update the counters
+        if (recycler->CollectionInProgress() || recycler->IsHeapEnumInProgress())
+        {
+            return JsErrorRuntimeInUse;
+        }
+
+        unsigned int count = 0;
+        recycler->GetAutoHeap()->MapAllocationStats([&](uint sizeCat, HeapBucketAllocationStats const& stats)
+        {
+            if (buckets != nullptr && count < bucketCount)
+            {
+                buckets[count].objectSize = sizeCat;
+                buckets[count].allocatedObjectCount = stats.allocatedObjectCount;
+                buckets[count].allocatedBlockCount = stats.allocatedBlockCount;
+                buckets[count].slowAllocationCount = stats.slowAllocCount;
+            }
+            count++;
+        });
+
+        *actualBucketCount = count;
+        return JsNoError;
+    });
+}
+
+CHAKRA_API JsTakeHeapSnapshot(_In_ JsRuntimeHandle runtimeHandle, _In_ JsHeapSnapshotWriteCallback writeCallback, _In_opt_ void *callbackState)
+{
+    return GlobalAPIWrapper([&]() -> JsErrorCode {
+        VALIDATE_INCOMING_RUNTIME_HANDLE(runtimeHandle);
+        PARAM_NOT_NULL(writeCallback);
+
+        ThreadContext * threadContext = JsrtRuntime::FromHandle(runtimeHandle)->GetThreadContext();
+        Recycler * recycler = threadContext->GetRecycler();
+
+        if (recycler && recycler->IsHeapEnumInProgress())
+        {
+            return JsErrorHeapEnumInProgress;
+        }
+        else if (recycler && recycler->IsInObjectBeforeCollectCallback())
+        {
+            return JsErrorInObjectBeforeCollectCallback;
+        }
+        else if (threadContext->IsInThreadServiceCallback())
+        {
+            return JsErrorInThreadServiceCallback;
+        }
+
+        ThreadContextScope scope(threadContext);
+
+        if (!scope.IsValid())
+        {
+            return JsErrorWrongThread;
+        }
+
+        recycler = threadContext->EnsureRecycler();
+        ArenaAllocator arena(_u("JsrtHeapSnapshot"), threadContext->GetPageAllocator(), Js::Throw::OutOfMemory);
+
+        Recycler::AutoSetupRecyclerForNonCollectingMark autoSetupRecycler(*recycler, true);
+        autoSetupRecycler.SetupForHeapEnumeration();
+        {
+#if DBG
+            // String keyed type handlers create property records for their property ids
+            Recycler::AutoAllowAllocationDuringHeapEnum autoAllowAllocation(recycler);
+#endif
+            JsrtHeapSnapshot snapshot(threadContext, &arena, writeCallback, callbackState);
+            if (!snapshot.Write())
+            {
+                Js::Throw::OutOfMemory();
+            }
+        }
+        return JsNoError;
+    });
+}
+
 CHAKRA_API JsDisableRuntimeExecution(_In_ JsRuntimeHandle runtimeHandle)
 {
     VALIDATE_INCOMING_RUNTIME_HANDLE(runtimeHandle);
@@ -3632,6 +3873,87 @@ CHAKRA_API JsTTDEmitTimeTravelRecording()
 #endif
 }
 
+CHAKRA_API JsTTDEmitStartupSnapshot()
+{
+#if !ENABLE_TTD
+    return JsErrorCategoryUsage;
+#else
+    JsrtContext *currentContext = JsrtContext::GetCurrent();
+    Js::ScriptContext* scriptContext = currentContext->GetScriptContext();
+    ThreadContext* threadContext = scriptContext->GetThreadContext();
+    if (threadContext->TTDLog == nullptr || !threadContext->IsTTRecordRequested)
+    {
+        AssertMsg(false, "Need to create in TTD record mode.");
+        return JsErrorCategoryUsage;
+    }
+
+    if (scriptContext->IsTTDDetached())
+    {
+        AssertMsg(false, "Already stopped TTD.");
+        return JsErrorCategoryUsage;
+    }
+
+    if (!scriptContext->IsTTDActive())
+    {
+        AssertMsg(false, "TTD was never started.");
+        return JsErrorCategoryUsage;
+    }
+
+    TTD::TTDExcludedExecutionModePopper modePopper(threadContext->TTDLog);
+    BEGIN_JS_RUNTIME_CALLROOT_EX(scriptContext, false)
+    {
+        threadContext->TTDLog->EmitStartupSnapshot();
+        threadContext->EndCtxTimeTravel(scriptContext);
+    }
+    END_JS_RUNTIME_CALL(scriptContext);
+
+    return JsNoError;
+#endif
+}
+
+CHAKRA_API JsTTDInflateStartupSnapshot()
+{
+#if !ENABLE_TTD
+    return JsErrorCategoryUsage;
+#else
+    JsrtContext *currentContext = JsrtContext::GetCurrent();
+    Js::ScriptContext* scriptContext = currentContext->GetScriptContext();
+    ThreadContext* threadContext = scriptContext->GetThreadContext();
+    if (threadContext->TTDLog == nullptr || !threadContext->IsTTDebugRequested)
+    {
+        AssertMsg(false, "Need to create in TTD debug mode.");
+        return JsErrorCategoryUsage;
+    }
+
+    if (scriptContext->IsTTDDetached() || scriptContext->IsTTDActive())
+    {
+        AssertMsg(false, "Startup snapshots are only inflated into a fresh context.");
+        return JsErrorCategoryUsage;
+    }
+
+    JsErrorCode res = JsNoError;
+    try
+    {
+        TTD::TTDExcludedExecutionModePopper modePopper(threadContext->TTDLog);
+        BEGIN_JS_RUNTIME_CALLROOT_EX(scriptContext, false)
+        {
+            threadContext->TTDLog->InflateStartupSnapshot();
+
+            //leave the global mode pending so later contexts in this runtime can inflate the snapshot as well
+            threadContext->TTDLog->StopTimeTravelOnScript(scriptContext);
+        }
+        END_JS_RUNTIME_CALL(scriptContext);
+    }
+    catch(...) //the snapshot was extracted from a context that ran fine so any error here is very bad
+    {
+        res = JsErrorFatal;
+        AssertMsg(false, "Unexpected fatal Error");
+    }
+
+    return res;
+#endif
+}
+
 CHAKRA_API JsTTDStartTimeTravelDebugging()
 {
 #if !ENABLE_TTD
@@ -3838,7 +4160,7 @@ CHAKRA_API JsTTDMoveToTopLevelEvent(_In_ INT64 snapshotTime, _In_ INT64 eventTim
         elog->PushMode(TTD::TTDMode::ExcludedExecution);
         BEGIN_JS_RUNTIME_CALLROOT_EX(scriptContext, false)
         {
-            elog->DoSnapshotInflate(snapshotTime);
+            elog->DoSnapshotInflate(snapshotTime, false);
         }
         END_JS_RUNTIME_CALL(scriptContext);
         elog->PopMode(TTD::TTDMode::ExcludedExecution);
@@ -0,0 +1,458 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+#include "JsrtPch.h"
+#include "JsrtHeapSnapshot.h"
+#include "DataStructures/LargeStack.h"
+#include "Library/SameValueComparer.h"
+#include "Library/MapOrSetDataList.h"
+#include "Library/JavascriptMap.h"
+#include "Library/JavascriptSet.h"
+
+JsrtHeapSnapshot::JsrtHeapSnapshot(ThreadContext * threadContext, ArenaAllocator * arena, JsHeapSnapshotWriteCallback writeCallback, void * callbackState) :
+    threadContext(threadContext),
+    recycler(threadContext->GetRecycler()),
+    writeCallback(writeCallback),
+    callbackState(callbackState),
+    stopped(false),
+    overflowed(false),
+    pendingNodes(LargeStack<PendingNode>::New(arena)),
+    pendingNodeCount(0),
+    writtenPropertyNames(arena),
+    nodeCount(0),
+    edgeCount(0),
+    buffer(AnewArray(arena, byte, BufferSize)),
+    bufferLength(0)
+{
+    Assert(recycler->IsHeapEnumInProgress());
+}
+
+bool
+JsrtHeapSnapshot::Write()
+{
+    WriteBytes("CHHS", 4);
+    WriteUInt32(Version);
+
+    for (Js::ScriptContext * scriptContext = threadContext->GetScriptContextList();
+        scriptContext != nullptr;
+        scriptContext = scriptContext->next)
+    {
+        if (!scriptContext->IsClosed())
+        {
+            WriteRoot(JsHeapSnapshotRootGlobalObject, scriptContext->GetGlobalObject());
+        }
+    }
+
+    recycler->MapPinnedObjects([&](void * object)
+    {
+        if (IsScriptObject(object))
+        {
+            WriteRoot(JsHeapSnapshotRootPinned, object);
+        }
+    });
+
+    while (!stopped && !pendingNodes->Empty())
+    {
+        pendingNodeCount--;
+        WriteNode(pendingNodes->Pop());
+    }
+
+    WriteByte(JsHeapSnapshotRecordEnd);
+    WriteUInt64(nodeCount);
+    WriteUInt64(edgeCount);
+    Flush();
+
+    return !overflowed;
+}
+
+bool
+JsrtHeapSnapshot::IsScriptObject(void * address)
+{
+    // The pinned object map also holds contexts, property records and engine data that have no common
+    // header, so only take an address as a script object if it has a vtable and a type of a live context.
+    if (JsrtContext::Is(address) || !recycler->IsValidObject(address, sizeof(Js::RecyclableObject)))
+    {
+        return false;
+    }
+
+    INT_PTR vtable = VirtualTableInfoBase::GetVirtualTable(address);
+    if (vtable <= USHRT_MAX || (vtable & 1))
+    {
+        return false;
+    }
+
+    Js::Type * type = static_cast<Js::RecyclableObject *>(address)->GetType();
+    if (type == nullptr || !recycler->IsValidObject(type, sizeof(Js::Type)))
+    {
+        return false;
+    }
+
+    for (Js::ScriptContext * scriptContext = threadContext->GetScriptContextList();
+        scriptContext != nullptr;
+        scriptContext = scriptContext->next)
+    {
+        if (type->GetScriptContext() == scriptContext)
+        {
+            return !scriptContext->IsClosed();
+        }
+    }
+    return false;
+}
+
+void
+JsrtHeapSnapshot::WriteRoot(JsHeapSnapshotRootKind kind, Js::Var root)
+{
+    if (root == nullptr || Js::TaggedNumber::Is(root))
+    {
+        return;
+    }
+
+    // Pinned objects outside the recycler have no node to refer to
+    if (!TryPush(root, false))
+    {
+        return;
+    }
+
+    WriteByte(JsHeapSnapshotRecordRoot);
+    WriteByte((byte)kind);
+    WriteUInt64((uint64)root);
+}
+
+bool
+JsrtHeapSnapshot::TryPush(void * address, bool isScope)
+{
+    RecyclerHeapObjectInfo heapObject;
+    if (!recycler->FindHeapObject(address, FindHeapObjectFlags_NoFlags, heapObject))
+    {
+        return false;
+    }
+
+    if (!heapObject.IsObjectMarked())
+    {
+        // Only so many objects can wait to be visited. Past that, stop rather than grow without bound.
+        if (pendingNodeCount == MaxPendingNodeCount)
+        {
+            overflowed = true;
+            stopped = true;
+            return false;
+        }
+
+        heapObject.SetObjectMarked();
+
+        PendingNode node = { address, isScope };
+        pendingNodes->Push(node);
+        pendingNodeCount++;
+    }
+    return true;
+}
+
+void
+JsrtHeapSnapshot::WriteNode(PendingNode const& node)
+{
+    RecyclerHeapObjectInfo heapObject;
+    if (!recycler->FindHeapObject(node.address, FindHeapObjectFlags_NoFlags, heapObject))
+    {
+        Assert(false);
+        return;
+    }
+
+    uint64 selfSize = heapObject.GetSize();
+    Js::TypeId typeId = Js::TypeIds_Undefined;
+    const char16 * name = nullptr;
+    charcount_t nameLength = 0;
+
+    if (node.isScope)
+    {
+        Js::ScopeSlots slots((Js::Var *)node.address);
+        if (slots.IsFunctionScopeSlotArray())
+        {
+            Js::FunctionBody * functionBody = slots.GetFunctionBody();
+            name = functionBody->GetDisplayName();
+            nameLength = functionBody->GetDisplayNameLength();
+        }
+    }
+    else
+    {
+        Js::RecyclableObject * object = Js::RecyclableObject::FromVar(node.address);
+        typeId = object->GetTypeId();
+
+        if (Js::JavascriptString::Is(object))
+        {
+            // Don't flatten ropes, that would allocate
+            Js::JavascriptString * string = Js::JavascriptString::FromVar(object);
+            name = string->UnsafeGetBuffer();
+            nameLength = name != nullptr ? string->GetLength() : 0;
+        }
+        else if (Js::JavascriptFunction::Is(object))
+        {
+            Js::FunctionProxy * functionProxy = Js::JavascriptFunction::FromVar(object)->GetFunctionProxy();
+            if (functionProxy != nullptr)
+            {
+                name = functionProxy->GetDisplayName();
+                nameLength = functionProxy->GetDisplayNameLength();
+            }
+        }
+        else if (Js::ArrayBuffer::Is(object))
+        {
+            selfSize += Js::ArrayBuffer::FromVar(object)->GetByteLength();
+        }
+    }
+
+    WriteByte(JsHeapSnapshotRecordNode);
+    WriteByte((byte)(node.isScope ? JsHeapSnapshotNodeScope : JsHeapSnapshotNodeObject));
+    WriteUInt64((uint64)node.address);
+    WriteUInt32((uint32)typeId);
+    WriteUInt64(selfSize);
+    WriteName(name, nameLength);
+    nodeCount++;
+
+    if (node.isScope)
+    {
+        WriteScopeEdges((Js::Var *)node.address);
+    }
+    else
+    {
+        WriteObjectEdges(Js::RecyclableObject::FromVar(node.address));
+    }
+}
+
+void
+JsrtHeapSnapshot::WriteObjectEdges(Js::RecyclableObject * object)
+{
+    Js::TypeId typeId = object->GetTypeId();
+    if (!Js::DynamicType::Is(typeId))
+    {
+        return;
+    }
+
+    WriteVarEdge(JsHeapSnapshotEdgePrototype, JsHeapSnapshotNoName, object->GetType()->GetPrototype());
+    WritePropertyEdges(Js::DynamicObject::FromVar(object));
+
+    if (typeId == Js::TypeIds_Array || typeId == Js::TypeIds_ES5Array)
+    {
+        WriteArrayEdges(Js::JavascriptArray::FromAnyArray(object));
+    }
+    else if (Js::TypedArrayBase::Is(typeId))
+    {
+        WriteVarEdge(JsHeapSnapshotEdgeProperty, WritePropertyName(Js::PropertyIds::buffer), Js::TypedArrayBase::FromVar(object)->GetArrayBuffer());
+    }
+    else if (Js::JavascriptMap::Is(object))
+    {
+        uint32 index = 0;
+        auto iterator = Js::JavascriptMap::FromVar(object)->GetIterator();
+        while (iterator.Next())
+        {
+            WriteVarEdge(JsHeapSnapshotEdgeCollectionKey, index, iterator.Current().Key());
+            WriteVarEdge(JsHeapSnapshotEdgeCollectionValue, index, iterator.Current().Value());
+            index++;
+        }
+    }
+    else if (Js::JavascriptSet::Is(object))
+    {
+        uint32 index = 0;
+        auto iterator = Js::JavascriptSet::FromVar(object)->GetIterator();
+        while (iterator.Next())
+        {
+            WriteVarEdge(JsHeapSnapshotEdgeCollectionValue, index, iterator.Current());
+            index++;
+        }
+    }
+    else if (Js::ScriptFunction::Is(object))
+    {
+        Js::FrameDisplay * environment = Js::ScriptFunction::FromVar(object)->GetEnvironment();
+        for (uint16 i = 0; environment != nullptr && i < environment->GetLength(); i++)
+        {
+            void * scope = environment->GetItem(i);
+            if (Js::FrameDisplay::GetScopeType(scope) == Js::ScopeType_SlotArray)
+            {
+                WriteEdge(JsHeapSnapshotEdgeScope, i, scope, true);
+            }
+            else
+            {
+                WriteVarEdge(JsHeapSnapshotEdgeScope, i, scope);
+            }
+        }
+    }
+}
+
+void
+JsrtHeapSnapshot::WritePropertyEdges(Js::DynamicObject * object)
+{
+    Js::DynamicTypeHandler * typeHandler = object->GetDynamicType()->GetTypeHandler();
+
+    // Walking a deferred type handler would initialize it; such objects only have their built-in properties.
+    if (typeHandler->IsDeferredTypeHandler())
+    {
+        return;
+    }
+
+    Js::ScriptContext * scriptContext = object->GetScriptContext();
+    int propertyCount = typeHandler->GetPropertyCount();
+    for (Js::BigPropertyIndex index = 0; index < (Js::BigPropertyIndex)propertyCount; index++)
+    {
+        Js::PropertyId propertyId = typeHandler->GetPropertyId(scriptContext, index);
+
+        // Internal properties hold engine data (types, stack traces, weak map key data) rather than Vars
+        if (propertyId == Js::Constants::NoProperty || Js::IsInternalPropertyId(propertyId))
+        {
+            continue;
+        }
+
+        // Read accessors and data slots from the type handler directly, so no getter or proxy trap runs
+        Js::Var getter = nullptr;
+        Js::Var setter = nullptr;
+        if (typeHandler->GetAccessors(object, propertyId, &getter, &setter))
+        {
+            uint32 name = WritePropertyName(propertyId);
+            WriteVarEdge(JsHeapSnapshotEdgeGetter, name, getter);
+            WriteVarEdge(JsHeapSnapshotEdgeSetter, name, setter);
+            continue;
+        }
+
+        Js::Var value = nullptr;
+        if (typeHandler->GetProperty(object, object, propertyId, &value, nullptr, scriptContext))
+        {
+            WriteVarEdge(JsHeapSnapshotEdgeProperty, WritePropertyName(propertyId), value);
+        }
+    }
+
+    if (Js::RootObjectBase::Is(object))
+    {
+        Js::RootObjectBase::FromVar(object)->MapLetConstGlobals([&](Js::PropertyRecord const * propertyRecord, Js::Var value, bool isConst)
+        {
+            WriteVarEdge(JsHeapSnapshotEdgeProperty, WritePropertyName(propertyRecord->GetPropertyId()), value);
+        });
+    }
+}
+
+void
+JsrtHeapSnapshot::WriteArrayEdges(Js::JavascriptArray * array)
+{
+    for (Js::SparseArraySegmentBase * segment = array->GetHead(); segment != nullptr; segment = segment->next)
+    {
+        Js::SparseArraySegment<Js::Var> * varSegment = (Js::SparseArraySegment<Js::Var> *)segment;
+        for (uint32 i = 0; i < segment->length; i++)
+        {
+            Js::Var item = varSegment->elements[i];
+            if (!Js::SparseArraySegment<Js::Var>::IsMissingItem(&item))
+            {
+                WriteVarEdge(JsHeapSnapshotEdgeElement, segment->left + i, item);
+            }
+        }
+    }
+}
+
+void
+JsrtHeapSnapshot::WriteScopeEdges(Js::Var * slotArray)
+{
+    Js::ScopeSlots slots(slotArray);
+    uint count = slots.GetCount();
+
+    Js::PropertyId * propertyIds = nullptr;
+    uint propertyIdCount = 0;
+    if (slots.IsFunctionScopeSlotArray())
+    {
+        Js::FunctionBody * functionBody = slots.GetFunctionBody();
+        propertyIds = functionBody->GetPropertyIdsForScopeSlotArray();
+        propertyIdCount = functionBody->scopeSlotArraySize;
+    }
+
+    for (uint i = 0; i < count; i++)
+    {
+        uint32 name = JsHeapSnapshotNoName;
+        if (propertyIds != nullptr && i < propertyIdCount && propertyIds[i] != Js::Constants::NoProperty)
+        {
+            name = WritePropertyName(propertyIds[i]);
+        }
+        WriteVarEdge(JsHeapSnapshotEdgeClosureVariable, name, slots.Get(i));
+    }
+}
+
+void
+JsrtHeapSnapshot::WriteVarEdge(JsHeapSnapshotEdgeKind kind, uint32 nameOrIndex, Js::Var target)
+{
+    if (target == nullptr || Js::TaggedNumber::Is(target) || !IsScriptObject(target))
+    {
+        return;
+    }
+    WriteEdge(kind, nameOrIndex, target, false);
+}
+
+void
+JsrtHeapSnapshot::WriteEdge(JsHeapSnapshotEdgeKind kind, uint32 nameOrIndex, void * target, bool isScope)
+{
+    // Stack allocated scopes and objects outside the recycler are not nodes
+    if (!TryPush(target, isScope))
+    {
+        return;
+    }
+
+    WriteByte(JsHeapSnapshotRecordEdge);
+    WriteByte((byte)kind);
+    WriteUInt32(nameOrIndex);
+    WriteUInt64((uint64)target);
+    edgeCount++;
+}
+
+uint32
+JsrtHeapSnapshot::WritePropertyName(Js::PropertyId propertyId)
+{
+    Assert(propertyId >= 0);
+    if (!writtenPropertyNames.TestAndSet(propertyId))
+    {
+        Js::PropertyRecord const * propertyRecord = threadContext->GetPropertyName(propertyId);
+
+        WriteByte(JsHeapSnapshotRecordString);
+        WriteUInt32((uint32)propertyId);
+        WriteByte(propertyRecord->IsSymbol() ? 1 : 0);
+        WriteName(propertyRecord->GetBuffer(), propertyRecord->GetLength());
+    }
+    return (uint32)propertyId;
+}
+
+void
+JsrtHeapSnapshot::WriteName(const char16 * name, charcount_t length)
+{
+    if (name == nullptr)
+    {
+        length = 0;
+    }
+
+    WriteUInt32(length);
+    WriteBytes(name, length * sizeof(char16));
+}
+
+void
+JsrtHeapSnapshot::WriteBytes(const void * bytes, size_t count)
+{
+    const byte * current = (const byte *)bytes;
+    while (count != 0 && !stopped)
+    {
+        if (bufferLength == BufferSize)
+        {
+            Flush();
+            continue;
+        }
+
+        size_t copyCount = BufferSize - bufferLength;
+        if (copyCount > count)
+        {
+            copyCount = count;
+        }
+        js_memcpy_s(buffer + bufferLength, BufferSize - bufferLength, current, copyCount);
+        bufferLength += copyCount;
+        current += copyCount;
+        count -= copyCount;
+    }
+}
+
+void
+JsrtHeapSnapshot::Flush()
+{
+    if (bufferLength != 0 && !stopped)
+    {
+        stopped = !writeCallback(callbackState, buffer, bufferLength);
+    }
+    bufferLength = 0;
+}
@@ -0,0 +1,62 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+#pragma once
+
+// Writes the heap snapshot described with JsTakeHeapSnapshot in ChakraCore.h. The recycler must be set up
+// for heap enumeration: the mark bits are the visited set, so each object is pushed and written only once.
+class JsrtHeapSnapshot
+{
+public:
+    JsrtHeapSnapshot(ThreadContext * threadContext, ArenaAllocator * arena, JsHeapSnapshotWriteCallback writeCallback, void * callbackState);
+
+    // Returns false if too many objects were waiting to be visited at once; the snapshot stops there.
+    bool Write();
+
+private:
+    static const uint32 Version = 1;
+    static const size_t BufferSize = 64 * 1024;
+    static const size_t MaxPendingNodeCount = 1024 * 1024;
+
+    struct PendingNode
+    {
+        void * address;
+        bool isScope;
+    };
+
+    bool IsScriptObject(void * address);
+    void WriteRoot(JsHeapSnapshotRootKind kind, Js::Var root);
+    void WriteNode(PendingNode const& node);
+    void WriteObjectEdges(Js::RecyclableObject * object);
+    void WritePropertyEdges(Js::DynamicObject * object);
+    void WriteArrayEdges(Js::JavascriptArray * array);
+    void WriteScopeEdges(Js::Var * slotArray);
+    void WriteEdge(JsHeapSnapshotEdgeKind kind, uint32 nameOrIndex, void * target, bool isScope);
+    void WriteVarEdge(JsHeapSnapshotEdgeKind kind, uint32 nameOrIndex, Js::Var target);
+    uint32 WritePropertyName(Js::PropertyId propertyId);
+    bool TryPush(void * address, bool isScope);
+
+    void WriteByte(byte value) { WriteBytes(&value, sizeof(value)); }
+    void WriteUInt32(uint32 value) { WriteBytes(&value, sizeof(value)); }
+    void WriteUInt64(uint64 value) { WriteBytes(&value, sizeof(value)); }
+    void WriteName(const char16 * name, charcount_t length);
+    void WriteBytes(const void * bytes, size_t count);
+    void Flush();
+
+    ThreadContext * threadContext;
+    Recycler * recycler;
+    JsHeapSnapshotWriteCallback writeCallback;
+    void * callbackState;
+    bool stopped;
+    bool overflowed;
+
+    LargeStack<PendingNode> * pendingNodes;
+    size_t pendingNodeCount;
+    BVSparse<ArenaAllocator> writtenPropertyNames;
+    uint64 nodeCount;
+    uint64 edgeCount;
+
+    byte * buffer;
+    size_t bufferLength;
+};
@@ -15,6 +15,8 @@ JsrtRuntime::JsrtRuntime(ThreadContext * threadContext, bool useIdle, bool dispa
     this->collectCallback = NULL;
     this->beforeCollectCallback = NULL;
     this->callbackContext = NULL;
+    this->collectionCallback = NULL;
+    this->collectionCallbackContext = NULL;
     this->allocationPolicyManager = threadContext->GetAllocationPolicyManager();
     this->useIdle = useIdle;
     this->dispatchExceptions = dispatchExceptions;
@@ -114,6 +116,50 @@ void JsrtRuntime::RecyclerCollectCallbackStatic(void * context, RecyclerCollectC
     }
 }
 
+void JsrtRuntime::SetCollectionCallback(JsCollectionCallback collectionCallback, void * callbackContext)
+{
+    this->collectionCallback = collectionCallback;
+    this->collectionCallbackContext = callbackContext;
+
+    Recycler * recycler = this->threadContext->EnsureRecycler();
+    if (collectionCallback != NULL)
+    {
+        recycler->GetTelemetry().SetCollectionCallback(this, RecyclerTelemetryCallbackStatic);
+    }
+    else
+    {
+        recycler->GetTelemetry().SetCollectionCallback(nullptr, nullptr);
+    }
+}
+
+void JsrtRuntime::RecyclerTelemetryCallbackStatic(void * context, RecyclerCollectionTelemetry const& telemetry)
+{
+    JsrtRuntime * _this = reinterpret_cast<JsrtRuntime *>(context);
+
+    JsCollectionInfo info;
+    info.reason = (JsCollectionReason)telemetry.reason;
+    info.isPartial = telemetry.partial;
+    info.isConcurrent = telemetry.concurrent;
+    info.rootScanTime = telemetry.phaseTime[RecyclerTelemetryPhaseRootScan];
+    info.markTime = telemetry.phaseTime[RecyclerTelemetryPhaseMark];
+    info.sweepTime = telemetry.phaseTime[RecyclerTelemetryPhaseSweep];
+    info.finalizeTime = telemetry.phaseTime[RecyclerTelemetryPhaseFinalize];
+    info.elapsedTime = telemetry.elapsedTime;
+    info.pauseTime = telemetry.pauseTime;
+    info.bytesBefore = telemetry.usedBytesBefore;
+    info.bytesAfter = telemetry.usedBytesAfter;
+
+    try
+    {
+        JsrtCallbackState scope(_this->GetThreadContext());
+        _this->collectionCallback(_this->collectionCallbackContext, &info);
+    }
+    catch (...)
+    {
+        AssertMsg(false, "Unexpected non-engine exception.");
+    }
+}
+
 unsigned int JsrtRuntime::Idle()
 {
     return this->threadService.Idle();
@@ -36,6 +36,7 @@ public:
 
     void CloseContexts();
     void SetBeforeCollectCallback(JsBeforeCollectCallback beforeCollectCallback, void * callbackContext);
+    void SetCollectionCallback(JsCollectionCallback collectionCallback, void * callbackContext);
 
 #ifdef ENABLE_DEBUG_CONFIG_OPTIONS
     void SetSerializeByteCodeForLibrary(bool set) { serializeByteCodeForLibrary = set; }
@@ -48,6 +49,7 @@ public:
 
 private:
     static void __cdecl RecyclerCollectCallbackStatic(void * context, RecyclerCollectCallBackFlags flags);
+    static void RecyclerTelemetryCallbackStatic(void * context, RecyclerCollectionTelemetry const& telemetry);
 
 private:
     ThreadContext * threadContext;
@@ -57,6 +59,8 @@ private:
     JsBeforeCollectCallback beforeCollectCallback;
     JsrtThreadService threadService;
     void * callbackContext;
+    JsCollectionCallback collectionCallback;
+    void * collectionCallbackContext;
     bool useIdle;
     bool dispatchExceptions;
 #ifdef ENABLE_DEBUG_CONFIG_OPTIONS
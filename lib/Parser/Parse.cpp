@@ -112,6 +112,8 @@ Parser::Parser(Js::ScriptContext* scriptContext, BOOL strictMode, PageAllocator
     currBackgroundParseItem = nullptr;
     backgroundParseItems = nullptr;
     fastScannedRegExpNodes = nullptr;
+    m_functionBoundaryIndex = nullptr;
+    m_recordedDeferredFncs = nullptr;
 
     m_fUseStrictMode = strictMode;
     m_InAsmMode = false;
@@ -1711,6 +1713,11 @@ void Parser::BindPidRefsInScope(IdentPtr pid, Symbol *sym, int blockId, uint max
         {
             Assert(ref->GetFuncScopeId() > funcId);
             sym->SetHasNonLocalReference();
+
+            if (m_recordedDeferredFncs != nullptr)
+            {
+                this->RecordFunctionBoundaryCapture(pid, ref, funcId);
+            }
         }
 
         if (ref->GetScopeId() == blockId)
@@ -5318,16 +5325,25 @@ void Parser::ParseTopLevelDeferredFunc(ParseNodePtr pnodeFnc, ParseNodePtr pnode
 
     m_ppnodeVar = &pnodeFnc->sxFnc.pnodeVars;
 
-    if (pnodeFncParent != nullptr
-        && m_currDeferredStub != nullptr
-        // We don't create stubs for function bodies in parameter scope.
-        && pnodeFnc->sxFnc.pnodeScopes->sxBlock.blockType != PnodeBlockType::Parameter)
+    DeferredFunctionStub *stub = nullptr;
+    // We don't create stubs for function bodies in parameter scope.
+    if (pnodeFnc->sxFnc.pnodeScopes->sxBlock.blockType != PnodeBlockType::Parameter)
+    {
+        if (pnodeFncParent != nullptr && m_currDeferredStub != nullptr)
+        {
+            stub = m_currDeferredStub + (pnodeFncParent->sxFnc.nestedCount - 1);
+            Assert(pnodeFnc->ichMin == stub->ichMin);
+        }
+        else if (m_functionBoundaryIndex != nullptr)
+        {
+            stub = this->LookupFunctionBoundary(pnodeFnc->ichMin);
+        }
+    }
+
+    if (stub != nullptr)
     {
         // We've already parsed this function body for syntax errors on the initial parse of the script.
         // We have information that allows us to skip it, so do so.
-
-        DeferredFunctionStub *stub = m_currDeferredStub + (pnodeFncParent->sxFnc.nestedCount - 1);
-        Assert(pnodeFnc->ichMin == stub->ichMin);
         if (stub->fncFlags & kFunctionCallsEval)
         {
             this->MarkEvalCaller();
@@ -5346,6 +5362,11 @@ void Parser::ParseTopLevelDeferredFunc(ParseNodePtr pnodeFnc, ParseNodePtr pnode
             _u("Skipping nested deferred function %d. %s: %d...%d\n"),
             pnodeFnc->sxFnc.functionId, GetFunctionName(pnodeFnc, pNameHint), pnodeFnc->ichMin, stub->restorePoint.m_ichMinTok);
 
+        if (m_functionBoundaryIndex != nullptr && m_currDeferredStub == nullptr)
+        {
+            this->ReplayFunctionBoundaryCaptures(stub);
+        }
+
         m_pscan->SeekTo(stub->restorePoint, m_nextFunctionId);
         pnodeFnc->sxFnc.nestedCount = stub->nestedCount;
         pnodeFnc->sxFnc.deferredStub = stub->deferredStubs;
@@ -5356,7 +5377,11 @@ void Parser::ParseTopLevelDeferredFunc(ParseNodePtr pnodeFnc, ParseNodePtr pnode
     }
     else
     {
+        size_t lengthBeforeBody = this->GetSourceLength();
+
         ParseStmtList<false>(nullptr, nullptr, SM_DeferredParse, true /* isSourceElementList */);
+
+        this->RecordFunctionBoundary(pnodeFnc, lengthBeforeBody);
     }
 
     pnodeFnc->ichLim = m_pscan->IchLimTok();
@@ -5376,10 +5401,214 @@ void Parser::ParseTopLevelDeferredFunc(ParseNodePtr pnodeFnc, ParseNodePtr pnode
     this->m_deferringAST = FALSE;
 }
 
+void Parser::RecordFunctionBoundaries()
+{
+    Assert(m_recordedDeferredFncs == nullptr);
+    if (!PHASE_OFF1(Js::SkipNestedDeferredPhase))
+    {
+        m_recordedDeferredFncs = JsUtil::List<RecordedDeferredFnc *, ArenaAllocator>::New(&m_nodeAllocator);
+    }
+}
+
+void Parser::RecordFunctionBoundary(ParseNodePtr pnodeFnc, size_t lengthBeforeBody)
+{
+    if (m_recordedDeferredFncs == nullptr || this->IsBackgroundParser() || m_hasParallelJob)
+    {
+        return;
+    }
+
+    // Same information ParseNestedDeferredFunc records: the end of the body, and the function ID and
+    // source length adjustments needed to skip it.
+    RestorePoint *restorePoint = Anew(&m_nodeAllocator, RestorePoint);
+    m_pscan->Capture(restorePoint,
+                     *m_nextFunctionId - pnodeFnc->sxFnc.functionId - 1,
+                     lengthBeforeBody - this->GetSourceLength());
+    pnodeFnc->sxFnc.pRestorePoint = restorePoint;
+
+    // A function is recorded again if the parser rewinds (e.g. to reparse lambda formals). Drop the earlier
+    // records so the list stays sorted by position and function ID and refers to the nodes in the final tree.
+    while (m_recordedDeferredFncs->Count() > 0)
+    {
+        RecordedDeferredFnc *last = m_recordedDeferredFncs->Item(m_recordedDeferredFncs->Count() - 1);
+        if (last->pnodeFnc->ichMin < pnodeFnc->ichMin && last->pnodeFnc->sxFnc.functionId < pnodeFnc->sxFnc.functionId)
+        {
+            break;
+        }
+        m_recordedDeferredFncs->RemoveAtEnd();
+    }
+
+    RecordedDeferredFnc *record = Anew(&m_nodeAllocator, RecordedDeferredFnc);
+    record->pnodeFnc = pnodeFnc;
+    record->lastFunctionId = *m_nextFunctionId - 1;
+    record->capturedNames = nullptr;
+    m_recordedDeferredFncs->Add(record);
+}
+
+void Parser::RecordFunctionBoundaryCapture(IdentPtr pid, PidRefStack *ref, Js::LocalFunctionId bindingFuncId)
+{
+    // A reference made in a recorded body (or a function nested in it) is being bound to a declaration in an
+    // enclosing scope. Remember the name, so that skipping the body later still marks the declaration captured.
+    Js::LocalFunctionId refFuncId = ref->GetFuncScopeId();
+    int lo = 0;
+    int hi = m_recordedDeferredFncs->Count();
+    while (lo < hi)
+    {
+        int mid = lo + (hi - lo) / 2;
+        if (m_recordedDeferredFncs->Item(mid)->pnodeFnc->sxFnc.functionId <= refFuncId)
+        {
+            lo = mid + 1;
+        }
+        else
+        {
+            hi = mid;
+        }
+    }
+    if (lo == 0)
+    {
+        return;
+    }
+
+    RecordedDeferredFnc *record = m_recordedDeferredFncs->Item(lo - 1);
+    if (refFuncId > record->lastFunctionId || record->pnodeFnc->sxFnc.functionId <= bindingFuncId)
+    {
+        // Not a reference from a recorded body, or the declaration is inside the body itself
+        return;
+    }
+
+    if (record->capturedNames == nullptr)
+    {
+        record->capturedNames = Anew(&m_nodeAllocator, RecordedDeferredFnc::CapturedNameMap, &m_nodeAllocator);
+    }
+    bool isAssignment = false;
+    record->capturedNames->TryGetValue(pid, &isAssignment);
+    record->capturedNames->Item(pid, isAssignment || ref->IsAssignment());
+}
+
+void Parser::ReplayFunctionBoundaryCaptures(DeferredFunctionStub *stub)
+{
+    // Reference the names the skipped body captured, as if they appeared directly in this function's scope.
+    // They bind to the same enclosing declarations the body's own references bound to on the earlier parse.
+    FunctionBoundaryCaptures *captures = &m_functionBoundaryIndex->captures[stub - m_functionBoundaryIndex->stubs];
+    for (uint i = 0; i < captures->count; i++)
+    {
+        FunctionBoundaryCapture *capture = &captures->names[i];
+        PidRefStack *ref = this->PushPidRef(this->CreatePid(capture->name, capture->length));
+        if (capture->isAssignment)
+        {
+            ref->isAsg = true;
+        }
+    }
+}
+
+DeferredFunctionStub *Parser::LookupFunctionBoundary(charcount_t ichMin) const
+{
+    Assert(m_functionBoundaryIndex != nullptr);
+
+    uint lo = 0;
+    uint hi = m_functionBoundaryIndex->count;
+    while (lo < hi)
+    {
+        uint mid = lo + (hi - lo) / 2;
+        DeferredFunctionStub *stub = &m_functionBoundaryIndex->stubs[mid];
+        if (stub->ichMin == ichMin)
+        {
+            PHASE_PRINT_TRACE1(Js::FunctionBoundaryIndexPhase, _u("Function boundary index hit at %d\n"), ichMin);
+            return stub;
+        }
+        if (stub->ichMin < ichMin)
+        {
+            lo = mid + 1;
+        }
+        else
+        {
+            hi = mid;
+        }
+    }
+    return nullptr;
+}
+
+FunctionBoundaryIndex *Parser::BuildFunctionBoundaryIndex(Recycler *recycler, Js::ISourceHolder *sourceHolder, size_t cbLength, ULONG grfscr)
+{
+    if (m_recordedDeferredFncs == nullptr || m_recordedDeferredFncs->Count() == 0 || m_hasParallelJob || sourceHolder->IsEmpty())
+    {
+        return nullptr;
+    }
+
+    uint count = (uint)m_recordedDeferredFncs->Count();
+    DeferredFunctionStub *stubs = RecyclerNewArray(recycler, DeferredFunctionStub, count);
+    FunctionBoundaryCaptures *captures = RecyclerNewArrayZ(recycler, FunctionBoundaryCaptures, count);
+    m_recordedDeferredFncs->Map([&](int i, RecordedDeferredFnc *record)
+    {
+        ParseNodePtr pnodeFnc = record->pnodeFnc;
+        Assert(i == 0 || stubs[i - 1].ichMin < pnodeFnc->ichMin);
+        Assert(pnodeFnc->sxFnc.pRestorePoint != nullptr);
+        stubs[i].fncFlags = pnodeFnc->sxFnc.fncFlags;
+        stubs[i].nestedCount = pnodeFnc->sxFnc.nestedCount;
+        stubs[i].restorePoint = *pnodeFnc->sxFnc.pRestorePoint;
+        stubs[i].deferredStubs = BuildDeferredStubTree(pnodeFnc, recycler);
+        stubs[i].ichMin = pnodeFnc->ichMin;
+
+        // Let byte code gen reuse the nested stubs rather than building them again.
+        pnodeFnc->sxFnc.deferredStub = stubs[i].deferredStubs;
+
+        if (record->capturedNames != nullptr && record->capturedNames->Count() != 0)
+        {
+            FunctionBoundaryCapture *names = RecyclerNewArray(recycler, FunctionBoundaryCapture, record->capturedNames->Count());
+            uint n = 0;
+            record->capturedNames->Map([&](IdentPtr pid, bool isAssignment)
+            {
+                char16 *name = RecyclerNewArrayLeaf(recycler, char16, pid->Cch() + 1);
+                js_wmemcpy_s(name, pid->Cch() + 1, pid->Psz(), pid->Cch() + 1);
+                names[n].name = name;
+                names[n].length = pid->Cch();
+                names[n].isAssignment = isAssignment;
+                ++n;
+            });
+            captures[i].count = n;
+            captures[i].names = names;
+        }
+    });
+
+    FunctionBoundaryIndex *index = RecyclerNewStruct(recycler, FunctionBoundaryIndex);
+    index->sourceHolder = recycler->CreateWeakReferenceHandle(sourceHolder);
+    index->cbLength = cbLength;
+    index->grfscr = grfscr;
+    index->count = count;
+    index->stubs = stubs;
+    index->captures = captures;
+    index->lastUse = 0;
+    return index;
+}
+
+bool Parser::IsParallelParseEnabled()
+{
+#if ENABLE_BACKGROUND_PARSING
+    return PHASE_ON1(Js::ParallelParsePhase) || CONFIG_FLAG(ParallelParseStartupFunctions);
+#else
+    return false;
+#endif
+}
+
+bool Parser::IsProfiledStartupFunction(Js::LocalFunctionId functionId) const
+{
+#if ENABLE_PROFILE_INFO && !defined(DISABLE_DYNAMIC_PROFILE_DEFER_PARSE)
+    // Only trust the profile when it was loaded from a previous run of this source. Functions it
+    // records as executed at startup are not deferred, so they are worth parsing off the main thread.
+    Js::SourceDynamicProfileManager *profileManager = m_sourceContextInfo->sourceDynamicProfileManager;
+    return CONFIG_FLAG(ParallelParseStartupFunctions) &&
+        profileManager != nullptr &&
+        profileManager->IsProfileLoaded() &&
+        profileManager->IsFunctionExecuted(functionId) == Js::ExecutionFlags_Executed;
+#else
+    return false;
+#endif
+}
+
 bool Parser::DoParallelParse(ParseNodePtr pnodeFnc) const
 {
 #if ENABLE_BACKGROUND_PARSING
-    if (!PHASE_ON_RAW(Js::ParallelParsePhase, m_sourceContextInfo->sourceContextId, pnodeFnc->sxFnc.functionId))
+    if (!PHASE_ON_RAW(Js::ParallelParsePhase, m_sourceContextInfo->sourceContextId, pnodeFnc->sxFnc.functionId) &&
+        !IsProfiledStartupFunction(pnodeFnc->sxFnc.functionId))
     {
         return false;
     }
@@ -8561,7 +8790,7 @@ Js::PropertyId PnPid::PropertyIdFromNameNode() const
 
 PidRefStack* Parser::PushPidRef(IdentPtr pid)
 {
-    if (PHASE_ON1(Js::ParallelParsePhase))
+    if (IsParallelParseEnabled())
     {
         // NOTE: the phase check is here to protect perf. See OSG 1020424.
         // In some LS AST-rewrite cases we lose a lot of perf searching the PID ref stack rather
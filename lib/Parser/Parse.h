@@ -74,6 +74,39 @@ struct DeferredFunctionStub;
 
 DeferredFunctionStub * BuildDeferredStubTree(ParseNode *pnodeFnc, Recycler *recycler);
 
+namespace Js
+{
+    class ISourceHolder;
+};
+
+// A name that a deferred function body refers to and that an enclosing scope declares. Skipping the body drops
+// the references in it, so the names are referenced again in its place to mark the enclosing declarations captured.
+struct FunctionBoundaryCapture
+{
+    const char16 *name;
+    uint32 length;
+    bool isAssignment;
+};
+
+struct FunctionBoundaryCaptures
+{
+    uint count;
+    FunctionBoundaryCapture *names;
+};
+
+// Extents and attributes of the deferred function bodies seen by an earlier parse of the same source text,
+// sorted by ichMin. A later parse of the unchanged source uses them to skip those bodies without scanning them.
+struct FunctionBoundaryIndex
+{
+    RecyclerWeakReference<Js::ISourceHolder> *sourceHolder; // Source the index was recorded from, held weakly; hashes can collide so compare before use
+    size_t cbLength;
+    ULONG grfscr;                   // Parse flags the index was recorded with
+    uint count;
+    DeferredFunctionStub *stubs;
+    FunctionBoundaryCaptures *captures; // Parallel to stubs
+    uint lastUse;                   // For evicting the least recently used index
+};
+
 struct StmtNest;
 struct BlockInfoStack;
 struct ParseContext
@@ -144,6 +177,10 @@ public:
     BOOL IsDeferredFnc();
     void ReduceDeferredScriptLength(size_t chars);
 
+    void SetFunctionBoundaryIndex(FunctionBoundaryIndex *index) { m_functionBoundaryIndex = index; }
+    void RecordFunctionBoundaries();
+    FunctionBoundaryIndex *BuildFunctionBoundaryIndex(Recycler *recycler, Js::ISourceHolder *sourceHolder, size_t cbLength, ULONG grfscr);
+
     void RestorePidRefForSym(Symbol *sym);
 
     HRESULT ValidateSyntax(LPCUTF8 pszSrc, size_t encodedCharCount, bool isGenerator, bool isAsync, CompileScriptException *pse, void (Parser::*validateFunction)());
@@ -430,6 +467,19 @@ private:
     typedef DList<ParseNodePtr, ArenaAllocator> NodeDList;
     NodeDList* fastScannedRegExpNodes;
 
+    // A deferred function body recorded for a FunctionBoundaryIndex, with the names it captures from enclosing scopes
+    struct RecordedDeferredFnc
+    {
+        typedef JsUtil::BaseDictionary<IdentPtr, bool, ArenaAllocator, PrimeSizePolicy> CapturedNameMap; // Value is true if the name is assigned
+
+        ParseNodePtr pnodeFnc;
+        Js::LocalFunctionId lastFunctionId; // Functions nested in the body have IDs up to this one
+        CapturedNameMap *capturedNames;
+    };
+
+    FunctionBoundaryIndex *m_functionBoundaryIndex; // Deferred function extents from an earlier parse of this source
+    JsUtil::List<RecordedDeferredFnc *, ArenaAllocator> *m_recordedDeferredFncs; // Deferred functions to build a FunctionBoundaryIndex from
+
     BlockIdsStack *m_currentDynamicBlock;
     int GetCurrentDynamicBlockId() const;
 
@@ -544,6 +594,9 @@ protected:
     void MarkIdentifierReferenceIsModuleExport(IdentPtr localName);
 
 public:
+    // True when functions may be handed to the background parser; ScriptContext creates it on this condition
+    static bool IsParallelParseEnabled();
+
     WellKnownPropertyPids* names(){ return &wellKnownPropertyPids; }
 
     IdentPtr CreatePid(__in_ecount(len) LPCOLESTR name, charcount_t len)
@@ -692,6 +745,11 @@ private:
     bool ScanAheadToFunctionEnd(uint count);
 
     bool DoParallelParse(ParseNodePtr pnodeFnc) const;
+    DeferredFunctionStub *LookupFunctionBoundary(charcount_t ichMin) const;
+    void ReplayFunctionBoundaryCaptures(DeferredFunctionStub *stub);
+    void RecordFunctionBoundary(ParseNodePtr pnodeFnc, size_t lengthBeforeBody);
+    void RecordFunctionBoundaryCapture(IdentPtr pid, PidRefStack *ref, Js::LocalFunctionId bindingFuncId);
+    bool IsProfiledStartupFunction(Js::LocalFunctionId functionId) const;
 
     // TODO: We should really call this StartScope and separate out the notion of scopes and blocks;
     // blocks refer to actual curly braced syntax, whereas scopes contain symbols.  All blocks have
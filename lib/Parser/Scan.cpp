@@ -454,6 +454,9 @@ BOOL Scanner<EncodingPolicy>::FastIdentifierContinue(EncodedCharPtr&p, EncodedCh
 {
     if (EncodingPolicy::MultiUnitEncoding)
     {
+        // Skip the ASCII part of the identifier a block at a time
+        p = this->SkipIdContinue(p, last);
+
         while (p < last)
         {
             EncodedChar currentChar = *p;
@@ -1173,6 +1176,16 @@ tokens Scanner<EncodingPolicy>::ScanStringConstant(OLECHAR delim, EncodedCharPtr
 
     for (;;)
     {
+        // Copy runs of characters that don't need escape, delimiter or line break processing in bulk
+        EncodedCharPtr pchPlainEnd = this->SkipPlainStringChars(p, last);
+        if (pchPlainEnd != p)
+        {
+            uint32 cchPlain = (uint32)(pchPlainEnd - p);
+            m_tempChBuf.template AppendAsciiRun<true>(p, cchPlain);
+            m_tempChBufSecondary.template AppendAsciiRun<createRawString>(p, cchPlain);
+            p = pchPlainEnd;
+        }
+
         switch ((rawch = ch = this->ReadFirst(p, last)))
         {
         case kchRET:
@@ -1601,6 +1614,8 @@ tokens Scanner<EncodingPolicy>::SkipComment(EncodedCharPtr *pp, /* out */ bool*
 
     for (;;)
     {
+        p = this->SkipDelimitedCommentBody(p, last);
+
         switch((ch = this->ReadFirst(p, last)))
         {
         case '*':
@@ -1886,6 +1901,7 @@ LEof:
         case 0x000C:
         case 0x0020:
             Assert(chType == _C_WSP);
+            p = this->SkipWhiteSpace(p, last);
             continue;
 
         case '.':
@@ -2157,6 +2173,8 @@ LSkipLineComment:
                 pchT = NULL;
                 for (;;)
                 {
+                    p = this->SkipLineCommentBody(p, last);
+
                     switch ((ch = this->ReadFirst(p, last)))
                     {
                     case kchLS:         // 0x2028, classifies as new line
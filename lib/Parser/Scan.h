@@ -144,6 +144,139 @@ public:
 typedef BYTE UTF8Char;
 typedef UTF8Char* UTF8CharPtr;
 
+// Block scanning helpers for the UTF8 scanner. Each Skip* function returns a pointer to the first
+// byte in [p, last) that needs the scanner's full per-character handling (or last if there is none).
+// All of the characters skipped are ASCII, so the caller doesn't need to update m_cMultiUnits and
+// never has to consult the CharClassifier for them. On x64 the source is examined 16 bytes at a time;
+// -off:Utf8BlockScan leaves only the byte at a time loop, which the SSE2 loop also uses for the tail.
+class Utf8BlockScanner
+{
+public:
+    // [A-Za-z0-9_$]
+    static LPCUTF8 SkipIdContinue(LPCUTF8 p, LPCUTF8 last) { return SkipWhileNot<IdContinueStop>(p, last); }
+    // Space and horizontal tab
+    static LPCUTF8 SkipWhiteSpace(LPCUTF8 p, LPCUTF8 last) { return SkipWhileNot<WhiteSpaceStop>(p, last); }
+    // Anything but CR, LF, NUL and multi-unit characters (which may be LS/PS)
+    static LPCUTF8 SkipLineCommentBody(LPCUTF8 p, LPCUTF8 last) { return SkipWhileNot<LineCommentStop>(p, last); }
+    // As above, also stopping at '*' so the caller can look for the end of the comment
+    static LPCUTF8 SkipDelimitedCommentBody(LPCUTF8 p, LPCUTF8 last) { return SkipWhileNot<DelimitedCommentStop>(p, last); }
+    // Printable ASCII other than quotes, '\\', '`' and '$'; these never need escape or line break processing
+    static LPCUTF8 SkipPlainStringChars(LPCUTF8 p, LPCUTF8 last) { return SkipWhileNot<PlainStringStop>(p, last); }
+
+private:
+    template <typename TStop>
+    static LPCUTF8 SkipWhileNot(LPCUTF8 p, LPCUTF8 last)
+    {
+#if defined(_M_X64)
+#ifdef ENABLE_DEBUG_CONFIG_OPTIONS
+        if (!PHASE_OFF1(Js::Utf8BlockScanPhase))
+#endif
+        {
+            while (last - p >= 16)
+            {
+                __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i *>(p));
+                int stopMask = _mm_movemask_epi8(TStop::Match(block));
+                if (stopMask != 0)
+                {
+                    DWORD index;
+                    _BitScanForward(&index, (DWORD)stopMask);
+                    return p + index;
+                }
+                p += 16;
+            }
+        }
+#endif
+        while (p < last && !TStop::Match(*p))
+        {
+            p++;
+        }
+        return p;
+    }
+
+#if defined(_M_X64)
+    static __m128i Splat(char c) { return _mm_set1_epi8(c); }
+
+    // Signed byte compares; bytes >= 0x80 are negative so they never fall inside an ASCII range.
+    static __m128i InRange(__m128i block, char lo, char hi)
+    {
+        return _mm_and_si128(_mm_cmpgt_epi8(block, Splat(lo - 1)), _mm_cmplt_epi8(block, Splat(hi + 1)));
+    }
+
+    static __m128i Eq(__m128i block, char c) { return _mm_cmpeq_epi8(block, Splat(c)); }
+
+    static __m128i IsLineBreakOrNulOrMultiUnit(__m128i block)
+    {
+        // movemask only looks at the high bit, so a multi-unit lead/trail byte already reads as a match.
+        return _mm_or_si128(block, _mm_or_si128(Eq(block, '\n'), _mm_or_si128(Eq(block, '\r'), Eq(block, '\0'))));
+    }
+#endif
+
+    struct IdContinueStop
+    {
+        static bool Match(utf8char_t c)
+        {
+            utf8char_t lower = c | 0x20;
+            return !((lower >= 'a' && lower <= 'z') || (c >= '0' && c <= '9') || c == '_' || c == '$');
+        }
+#if defined(_M_X64)
+        static __m128i Match(__m128i block)
+        {
+            __m128i lower = _mm_or_si128(block, Splat(0x20));
+            __m128i idContinue = _mm_or_si128(
+                _mm_or_si128(InRange(lower, 'a', 'z'), InRange(block, '0', '9')),
+                _mm_or_si128(Eq(block, '_'), Eq(block, '$')));
+            return _mm_cmpeq_epi8(idContinue, _mm_setzero_si128());
+        }
+#endif
+    };
+
+    struct WhiteSpaceStop
+    {
+        static bool Match(utf8char_t c) { return c != ' ' && c != '\t'; }
+#if defined(_M_X64)
+        static __m128i Match(__m128i block)
+        {
+            return _mm_cmpeq_epi8(_mm_or_si128(Eq(block, ' '), Eq(block, '\t')), _mm_setzero_si128());
+        }
+#endif
+    };
+
+    struct LineCommentStop
+    {
+        static bool Match(utf8char_t c) { return c == '\n' || c == '\r' || c == '\0' || c > 0x7F; }
+#if defined(_M_X64)
+        static __m128i Match(__m128i block) { return IsLineBreakOrNulOrMultiUnit(block); }
+#endif
+    };
+
+    struct DelimitedCommentStop
+    {
+        static bool Match(utf8char_t c) { return c == '*' || LineCommentStop::Match(c); }
+#if defined(_M_X64)
+        static __m128i Match(__m128i block) { return _mm_or_si128(Eq(block, '*'), IsLineBreakOrNulOrMultiUnit(block)); }
+#endif
+    };
+
+    struct PlainStringStop
+    {
+        static bool Match(utf8char_t c)
+        {
+            return c < 0x20 || c > 0x7E || c == '"' || c == '\'' || c == '\\' || c == '`' || c == '$';
+        }
+#if defined(_M_X64)
+        static __m128i Match(__m128i block)
+        {
+            __m128i special = _mm_or_si128(
+                _mm_or_si128(Eq(block, '"'), Eq(block, '\'')),
+                _mm_or_si128(Eq(block, '\\'), _mm_or_si128(Eq(block, '`'), Eq(block, '$'))));
+            // Control characters, DEL and anything with the high bit set
+            __m128i nonPrintable = _mm_or_si128(_mm_cmplt_epi8(block, Splat(0x20)), Eq(block, 0x7F));
+            return _mm_or_si128(special, nonPrintable);
+        }
+#endif
+    };
+};
+
 class NullTerminatedUnicodeEncodingPolicy
 {
 public:
@@ -173,6 +306,13 @@ protected:
     static void RestoreMultiUnits(size_t multiUnits) { }
     static size_t CharacterOffsetToUnitOffset(EncodedCharPtr start, EncodedCharPtr current, EncodedCharPtr last, charcount_t offset) { return offset; }
 
+    // UTF16 Scanner are only for syntax coloring, they don't have the block scanning fast paths.
+    static EncodedCharPtr SkipIdContinue(EncodedCharPtr p, EncodedCharPtr last) { return p; }
+    static EncodedCharPtr SkipWhiteSpace(EncodedCharPtr p, EncodedCharPtr last) { return p; }
+    static EncodedCharPtr SkipLineCommentBody(EncodedCharPtr p, EncodedCharPtr last) { return p; }
+    static EncodedCharPtr SkipDelimitedCommentBody(EncodedCharPtr p, EncodedCharPtr last) { return p; }
+    static EncodedCharPtr SkipPlainStringChars(EncodedCharPtr p, EncodedCharPtr last) { return p; }
+
     static void ConvertToUnicode(__out_ecount_full(cch) LPOLESTR pch, charcount_t cch, EncodedCharPtr pu)
     {
         js_memcpy_s(pch, cch * sizeof(OLECHAR), pu, cch * sizeof(OLECHAR));
@@ -253,6 +393,12 @@ protected:
     }
     void RestoreMultiUnits(size_t multiUnits) { m_cMultiUnits = multiUnits; }
 
+    static EncodedCharPtr SkipIdContinue(EncodedCharPtr p, EncodedCharPtr last) { return Utf8BlockScanner::SkipIdContinue(p, last); }
+    static EncodedCharPtr SkipWhiteSpace(EncodedCharPtr p, EncodedCharPtr last) { return Utf8BlockScanner::SkipWhiteSpace(p, last); }
+    static EncodedCharPtr SkipLineCommentBody(EncodedCharPtr p, EncodedCharPtr last) { return Utf8BlockScanner::SkipLineCommentBody(p, last); }
+    static EncodedCharPtr SkipDelimitedCommentBody(EncodedCharPtr p, EncodedCharPtr last) { return Utf8BlockScanner::SkipDelimitedCommentBody(p, last); }
+    static EncodedCharPtr SkipPlainStringChars(EncodedCharPtr p, EncodedCharPtr last) { return Utf8BlockScanner::SkipPlainStringChars(p, last); }
+
     size_t CharacterOffsetToUnitOffset(EncodedCharPtr start, EncodedCharPtr current, EncodedCharPtr last, charcount_t offset)
     {
         // Note: current may be before or after last. If last is the null terminator, current should be within [start, last].
@@ -608,6 +754,25 @@ public:
             return AppendCh<true>(ch);
         }
 
+        // Append a run of ASCII characters from the source, widening them to OLECHAR
+        template<bool performAppend, typename EncodedChar> void AppendAsciiRun(const EncodedChar *pch, uint32 cch)
+        {
+            if (performAppend)
+            {
+                while (m_cchMax - m_ichCur < cch)
+                {
+                    Grow();
+                }
+
+                for (uint32 i = 0; i < cch; i++)
+                {
+                    Assert(pch[i] < 0x80);
+                    m_prgch[m_ichCur + i] = static_cast<OLECHAR>(pch[i]);
+                }
+                m_ichCur += cch;
+            }
+        }
+
         template<bool performAppend> void AppendCh(uint ch)
         {
             if (performAppend)
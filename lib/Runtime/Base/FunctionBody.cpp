@@ -446,6 +446,7 @@ namespace Js
         m_hasBailoutInstrInJittedCode(false),
         m_depth(0),
         inlineDepth(0),
+        constructorInlineSlotCapacity(0),
         m_pendingLoopHeaderRelease(false),
         hasCachedScopePropIds(false),
         m_argUsedForBranch(0),
@@ -3478,6 +3479,7 @@ namespace Js
         newFunctionBody->recentlyBailedOutOfJittedLoopBody = false;
         newFunctionBody->m_pendingLoopHeaderRelease = this->m_pendingLoopHeaderRelease;
         newFunctionBody->m_envDepth = this->m_envDepth;
+        newFunctionBody->constructorInlineSlotCapacity = this->constructorInlineSlotCapacity;
 
         if (this->GetConstTable() != nullptr)
         {
@@ -2022,6 +2022,10 @@ namespace Js
         NoWriteBarrierField<uint16> fullJitRequeueThreshold;
         NoWriteBarrierField<uint16> committedProfiledIterations;
 
+        // Inline slot capacity requested for objects created by this function as a constructor. Zero until slack tracking
+        // (see JavascriptOperators::UpdateNewScObjectCache) finds that earlier instances outgrew the default capacity.
+        NoWriteBarrierField<uint16> constructorInlineSlotCapacity;
+
         NoWriteBarrierField<uint> m_depth; // Indicates how many times the function has been entered (so increases by one on each recursive call, decreases by one when we're done)
 
         uint32 interpretedCount;
@@ -2697,6 +2701,8 @@ namespace Js
 
         bool GetHasOnlyThisStmts() const { return (flags & Flags_HasOnlyThisStatements) != 0; }
         void SetHasOnlyThisStmts(bool has) { SetFlags(has, Flags_HasOnlyThisStatements); }
+        uint16 GetConstructorInlineSlotCapacity() const { return constructorInlineSlotCapacity; }
+        void SetConstructorInlineSlotCapacity(uint16 capacity) { constructorInlineSlotCapacity = capacity; }
 
         bool GetIsFirstFunctionObject() const { return m_firstFunctionObject; }
         void SetIsNotFirstFunctionObject() { m_firstFunctionObject = false; }
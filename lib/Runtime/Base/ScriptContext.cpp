@@ -122,6 +122,7 @@ namespace Js
         hasUsedInlineCache(false),
         hasProtoOrStoreFieldInlineCache(false),
         hasIsInstInlineCache(false),
+        megamorphicInlineCache(nullptr),
         registeredPrototypeChainEnsuredToHaveOnlyWritableDataPropertiesScriptContext(nullptr),
         cache(nullptr),
         firstInterpreterFrameReturnAddress(nullptr),
@@ -1136,7 +1137,7 @@ namespace Js
 #endif
 
 #if ENABLE_BACKGROUND_PARSING
-        if (PHASE_ON1(Js::ParallelParsePhase))
+        if (Parser::IsParallelParseEnabled())
         {
             this->backgroundParser = BackgroundParser::New(this);
         }
@@ -1704,6 +1705,30 @@ if (!sourceList)
             grfscr |= fscrIsLibraryCode;
         }
 
+        // If this exact source was parsed before, skip the deferred function bodies found then instead of
+        // scanning them again. Otherwise record them for the next time.
+        size_t cbSource = ((loadScriptFlag & LoadScriptFlag_Utf8Source) == LoadScriptFlag_Utf8Source) ? cb : cbNeeded;
+        uint sourceHash = 0;
+        bool recordFunctionBoundaries = false;
+        if ((grfscr & fscrDeferFncParse) && !isLibraryCode && !PHASE_OFF1(Js::FunctionBoundaryIndexPhase))
+        {
+            sourceHash = (*ppSourceInfo)->GetSourceHash();
+            FunctionBoundaryIndex *boundaryIndex = this->threadContext->GetFunctionBoundaryIndex(sourceHash);
+            Js::ISourceHolder *indexedSourceHolder = boundaryIndex != nullptr ? boundaryIndex->sourceHolder->Get() : nullptr;
+            if (indexedSourceHolder != nullptr &&
+                boundaryIndex->cbLength == cbSource &&
+                boundaryIndex->grfscr == grfscr &&
+                indexedSourceHolder->Equals((*ppSourceInfo)->GetSourceHolder()))
+            {
+                parser->SetFunctionBoundaryIndex(boundaryIndex);
+            }
+            else
+            {
+                parser->RecordFunctionBoundaries();
+                recordFunctionBoundaries = true;
+            }
+        }
+
         ParseNodePtr parseTree;
         if((loadScriptFlag & LoadScriptFlag_Utf8Source) == LoadScriptFlag_Utf8Source)
         {
@@ -1719,6 +1744,15 @@ if (!sourceList)
             return nullptr;
         }
 
+        if (recordFunctionBoundaries)
+        {
+            FunctionBoundaryIndex *boundaryIndex = parser->BuildFunctionBoundaryIndex(this->GetRecycler(), (*ppSourceInfo)->GetSourceHolder(), cbSource, grfscr);
+            if (boundaryIndex != nullptr)
+            {
+                this->threadContext->AddFunctionBoundaryIndex(sourceHash, boundaryIndex);
+            }
+        }
+
         (*ppSourceInfo)->SetParseFlags(grfscr);
 
         //Make sure we have the body and text information available
@@ -4047,6 +4081,15 @@ if (!sourceList)
 #endif
     }
 
+    MegamorphicInlineCache * ScriptContext::EnsureMegamorphicInlineCache()
+    {
+        if (this->megamorphicInlineCache == nullptr)
+        {
+            this->megamorphicInlineCache = MegamorphicInlineCache::New(this);
+        }
+        return this->megamorphicInlineCache;
+    }
+
     void ScriptContext::RegisterProtoInlineCache(InlineCache *pCache, PropertyId propId)
     {
         hasProtoOrStoreFieldInlineCache = true;
@@ -4287,20 +4330,30 @@ void ScriptContext::RegisterPrototypeChainEnsuredToHaveOnlyWritableDataPropertie
         registeredPrototypeChainEnsuredToHaveOnlyWritableDataPropertiesScriptContext = nullptr;
     }
 
-    JavascriptString * ScriptContext::GetLastNumberToStringRadix10(double value)
+    uint NumberToStringCache::GetIndex(double value)
+    {
+        // Fibonacci hashing; the low bits of the value are often all zero
+        return (uint)((NumberUtilities::ToSpecial(value) * 0x9E3779B97F4A7C15ull) >> (64 - kCacheSizeBits));
+    }
+
+    JavascriptString * ScriptContext::GetCachedNumberToStringRadix10(double value)
     {
-        if (value == lastNumberToStringRadix10)
+        NumberToStringCache& numberToStringCache = cache->numberToStringRadix10Cache;
+        uint index = NumberToStringCache::GetIndex(value);
+        if (value == numberToStringCache.values[index])
         {
-            return cache->lastNumberToStringRadix10String;
+            return numberToStringCache.strings[index];
         }
         return nullptr;
     }
 
     void
-        ScriptContext::SetLastNumberToStringRadix10(double value, JavascriptString * str)
+        ScriptContext::SetCachedNumberToStringRadix10(double value, JavascriptString * str)
     {
-            lastNumberToStringRadix10 = value;
-            cache->lastNumberToStringRadix10String = str;
+        NumberToStringCache& numberToStringCache = cache->numberToStringRadix10Cache;
+        uint index = NumberToStringCache::GetIndex(value);
+        numberToStringCache.values[index] = value;
+        numberToStringCache.strings[index] = str;
     }
 
     bool ScriptContext::GetLastUtcTimeFromStr(JavascriptString * str, double& dbl)
@@ -356,6 +356,17 @@ namespace Js
         int validPropStrings;
     };
 
+    // Direct mapped cache of recent Number to string conversions in radix 10, indexed by a hash of the value.
+    // A slot is valid if its string != NULL.
+    struct NumberToStringCache {
+        static const int kCacheSizeBits = 4;
+        static const int kCacheSize = 1 << kCacheSizeBits;
+        double values[kCacheSize];
+        JavascriptString* strings[kCacheSize];
+
+        static uint GetIndex(double value);
+    };
+
     typedef JsUtil::BaseDictionary<JavascriptMethod, JavascriptFunction*, Recycler, PowerOf2SizePolicy> BuiltInLibraryFunctionMap;
 
     // this is allocated in GC directly to avoid force pinning the object, it is linked from JavascriptLibrary such that it has
@@ -368,7 +379,7 @@ namespace Js
         virtual void Dispose(bool isShutdown) override {}
         virtual void Mark(Recycler *recycler) override { AssertMsg(false, "Mark called on object that isn't TrackableObject"); }
 
-        JavascriptString * lastNumberToStringRadix10String;
+        NumberToStringCache numberToStringRadix10Cache;
         EnumeratedObjectCache enumObjCache;
         JavascriptString * lastUtcTimeFromStrString;
         EvalCacheDictionary* evalCacheDictionary;
@@ -498,6 +509,8 @@ namespace Js
 
         InlineCache * GetValueOfInlineCache() const { return valueOfInlineCache;}
         InlineCache * GetToStringInlineCache() const { return toStringInlineCache; }
+        MegamorphicInlineCache * GetMegamorphicInlineCache() const { return megamorphicInlineCache; }
+        MegamorphicInlineCache * EnsureMegamorphicInlineCache();
 
         FunctionBody * GetFakeGlobalFuncForUndefer() const { return fakeGlobalFuncForUndefer; }
         void SetFakeGlobalFuncForUndefer(FunctionBody * func) { fakeGlobalFuncForUndefer.Root(func, GetRecycler()); }
@@ -534,6 +547,7 @@ namespace Js
 
         InlineCache * valueOfInlineCache;
         InlineCache * toStringInlineCache;
+        MegamorphicInlineCache * megamorphicInlineCache;
 
         typedef JsUtil::BaseHashSet<Js::PropertyId, ArenaAllocator> PropIdSetForConstProp;
         PropIdSetForConstProp * intConstPropsOnGlobalObject;
@@ -789,7 +803,6 @@ private:
 
         JsUtil::BaseDictionary<uint, JavascriptString *, ArenaAllocator> integerStringMap;
 
-        double lastNumberToStringRadix10;
         double lastUtcTimeFromStr;
 
 #if ENABLE_PROFILE_INFO
@@ -1430,8 +1443,8 @@ private:
         void ClearPrototypeChainEnsuredToHaveOnlyWritableDataPropertiesCaches();
 
     public:
-        JavascriptString * GetLastNumberToStringRadix10(double value);
-        void SetLastNumberToStringRadix10(double value, JavascriptString * str);
+        JavascriptString * GetCachedNumberToStringRadix10(double value);
+        void SetCachedNumberToStringRadix10(double value, JavascriptString * str);
         bool GetLastUtcTimeFromStr(JavascriptString * str, double& dbl);
         void SetLastUtcTimeFromStr(JavascriptString * str, double value);
         bool IsNoContextSourceContextInfo(SourceContextInfo *sourceContextInfo) const
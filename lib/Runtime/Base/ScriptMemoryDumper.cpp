@@ -86,6 +86,9 @@ void ScriptMemoryDumper::DumpHeapBucket(uint index, HeapBucketT<TBlockType>* hea
 
     DumpSmallHeapBlockList(heapBucket->fullBlockList);
     DumpSmallHeapBlockList(heapBucket->heapBlockList);
+#if ENABLE_LAZY_SWEEP
+    DumpSmallHeapBlockList(heapBucket->lazySweepList);
+#endif
 }
 
 template <typename TBlockType, typename TBlockAttributes>
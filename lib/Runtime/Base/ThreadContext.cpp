@@ -89,7 +89,8 @@ ThreadContext::RecyclableData::RecyclableData(Recycler *const recycler) :
     propertyGuards(recycler, 128),
     oldEntryPointInfo(nullptr),
     returnedValueList(nullptr),
-    constructorCacheInvalidationCount(0)
+    constructorCacheInvalidationCount(0),
+    functionBoundaryIndexUseCount(0)
 {
 }
 
@@ -113,6 +114,7 @@ ThreadContext::ThreadContext(AllocationPolicyManager * allocationPolicyManager,
     threadService(threadServiceCallback),
     isOptimizedForManyInstances(Js::Configuration::Global.flags.OptimizeForManyInstances),
     bgJit(Js::Configuration::Global.flags.BgJit),
+    largeCollectionBudget(false),
     pageAllocator(allocationPolicyManager, PageAllocatorType_Thread, Js::Configuration::Global.flags, 0, PageAllocator::DefaultMaxFreePageCount,
         false
 #if ENABLE_BACKGROUND_PAGE_FREEING
@@ -407,6 +409,7 @@ ThreadContext::~ThreadContext()
             this->recyclableData->sourceProfileManagersByUrl->Count() == 0, "There seems to have been a refcounting imbalance.");
 
         this->recyclableData->sourceProfileManagersByUrl = nullptr;
+        this->recyclableData->functionBoundaryIndices = nullptr;
         this->recyclableData->oldEntryPointInfo = nullptr;
 
         if (this->recyclableData->symbolRegistrationMap != nullptr)
@@ -681,6 +684,7 @@ Recycler* ThreadContext::EnsureRecycler()
     {
         AutoRecyclerPtr newRecycler(HeapNew(Recycler, GetAllocationPolicyManager(), &pageAllocator, Js::Throw::OutOfMemory, Js::Configuration::Global.flags));
         newRecycler->Initialize(isOptimizedForManyInstances, &threadService); // use in-thread GC when optimizing for many instances
+        newRecycler->SetLargeCollectionBudget(largeCollectionBudget);
         newRecycler->SetCollectionWrapper(this);
 
 #if ENABLE_NATIVE_CODEGEN
@@ -2372,6 +2376,17 @@ ThreadContext::PreSweepCallback()
     this->dynamicObjectEnumeratorCacheMap.Clear();
 }
 
+void
+ThreadContext::EnumerateStackRanges(RecyclerScanStackCallback& scanStackCallback)
+{
+    // The leaf frame is the deepest on the stack, so walking towards the entry frame reports
+    // the frames in increasing address order, as the recycler expects.
+    for (Js::InterpreterStackFrame * frame = this->leafInterpreterFrame; frame != nullptr; frame = frame->GetPreviousFrame())
+    {
+        frame->EnumerateStackRanges(scanStackCallback);
+    }
+}
+
 void
 ThreadContext::CollectionCallBack(RecyclerCollectCallBackFlags flags)
 {
@@ -3738,6 +3753,67 @@ uint ThreadContext::ReleaseSourceDynamicProfileManagers(const WCHAR* url)
 }
 #endif
 
+FunctionBoundaryIndex* ThreadContext::GetFunctionBoundaryIndex(uint sourceHash)
+{
+    if (this->recyclableData->functionBoundaryIndices == nullptr)
+    {
+        return nullptr;
+    }
+
+    FunctionBoundaryIndex* index = this->recyclableData->functionBoundaryIndices->Lookup(sourceHash, nullptr);
+    if (index == nullptr)
+    {
+        return nullptr;
+    }
+
+    // The index holds its source weakly; once the source is collected the index can't be matched again.
+    if (index->sourceHolder->Get() == nullptr)
+    {
+        this->recyclableData->functionBoundaryIndices->Remove(sourceHash);
+        return nullptr;
+    }
+
+    index->lastUse = ++this->recyclableData->functionBoundaryIndexUseCount;
+    return index;
+}
+
+void ThreadContext::AddFunctionBoundaryIndex(uint sourceHash, FunctionBoundaryIndex* index)
+{
+    if (this->recyclableData->functionBoundaryIndices == nullptr)
+    {
+        this->EnsureRecycler();
+        this->recyclableData->functionBoundaryIndices = RecyclerNew(GetRecycler(), FunctionBoundaryIndexMap, GetRecycler());
+    }
+
+    FunctionBoundaryIndexMap* indices = this->recyclableData->functionBoundaryIndices;
+    if (indices->Count() >= INMEMORY_CACHE_MAX_FUNCTION_BOUNDARY_INDEX)
+    {
+        // Drop the indices whose source has been collected, then the least recently used one if still full
+        indices->MapAndRemoveIf([](FunctionBoundaryIndexMap::EntryType& entry)
+        {
+            return entry.Value()->sourceHolder->Get() == nullptr;
+        });
+
+        if (indices->Count() >= INMEMORY_CACHE_MAX_FUNCTION_BOUNDARY_INDEX)
+        {
+            uint lruHash = 0;
+            uint lruUse = UINT_MAX;
+            indices->Map([&](uint hash, FunctionBoundaryIndex* entry)
+            {
+                if (entry->lastUse < lruUse)
+                {
+                    lruHash = hash;
+                    lruUse = entry->lastUse;
+                }
+            });
+            indices->Remove(lruHash);
+        }
+    }
+
+    index->lastUse = ++this->recyclableData->functionBoundaryIndexUseCount;
+    indices->Item(sourceHash, index);
+}
+
 void ThreadContext::EnsureSymbolRegistrationMap()
 {
     if (this->recyclableData->symbolRegistrationMap == nullptr)
@@ -24,6 +24,7 @@ class ThreadServiceWrapper;
 struct IActiveScriptProfilerHeapEnum;
 class DynamicProfileMutator;
 class StackProber;
+struct FunctionBoundaryIndex;
 
 enum DisableImplicitFlags : BYTE
 {
@@ -544,6 +545,7 @@ private:
     };
 
     typedef JsUtil::BaseDictionary<const WCHAR*, SourceDynamicProfileManagerCache*, Recycler, PowerOf2SizePolicy> SourceProfileManagersByUrlMap;
+    typedef JsUtil::BaseDictionary<uint, FunctionBoundaryIndex*, Recycler, PowerOf2SizePolicy> FunctionBoundaryIndexMap;
 
     struct RecyclableData
     {
@@ -594,6 +596,10 @@ private:
 
         SourceProfileManagersByUrlMap* sourceProfileManagersByUrl;
 
+        // Deferred function extents recorded when a large source was first parsed, keyed by source hash
+        FunctionBoundaryIndexMap* functionBoundaryIndices;
+        uint functionBoundaryIndexUseCount;
+
         // Used to register recyclable data that needs to be kept alive while jitting
         JsUtil::DoublyLinkedList<Js::CodeGenRecyclableData> codeGenRecyclableDatas;
 
@@ -732,6 +738,7 @@ private:
     bool hasCollectionCallBack;
     bool isOptimizedForManyInstances;
     bool bgJit;
+    bool largeCollectionBudget;
 
     // We report library code to profiler only if called directly by user code. Not if called by library implementation.
     bool isProfilingUserCode;
@@ -1388,6 +1395,9 @@ public:
     uint ReleaseSourceDynamicProfileManagers(const WCHAR* url);
 #endif
 
+    FunctionBoundaryIndex* GetFunctionBoundaryIndex(uint sourceHash);
+    void AddFunctionBoundaryIndex(uint sourceHash, FunctionBoundaryIndex* index);
+
     void EnsureSymbolRegistrationMap();
     const Js::PropertyRecord* GetSymbolFromRegistrationMap(const char16* stringKey);
     const Js::PropertyRecord* AddSymbolToRegistrationMap(const char16* stringKey, charcount_t stringLength);
@@ -1537,6 +1547,7 @@ public:
     // DefaultCollectWrapper
     virtual void PreCollectionCallBack(CollectionFlags flags) override;
     virtual void PreSweepCallback() override;
+    virtual void EnumerateStackRanges(RecyclerScanStackCallback& scanStackCallback) override;
     virtual void WaitCollectionCallBack() override;
     virtual void PostCollectionCallBack() override;
     virtual BOOL ExecuteRecyclerCollectionFunction(Recycler * recycler, CollectionFunction function, CollectionFlags flags) override;
@@ -1612,6 +1623,14 @@ public:
 
     }
 
+    bool IsLargeCollectionBudgetEnabled() const { return largeCollectionBudget; }
+
+    void SetLargeCollectionBudget(const bool enable)
+    {
+        Assert(!recycler || enable == largeCollectionBudget); // budget cannot be changed after recycler is created
+        largeCollectionBudget = enable;
+    }
+
 #if ENABLE_NATIVE_CODEGEN
     bool IsBgJitEnabled() const { return bgJit; }
 
@@ -105,6 +105,13 @@ bool ThreadServiceWrapperBase::IdleCollect()
         JS_ETW(EventWriteJSCRIPT_GC_IDLE_CALLBACK_FINISH(this));
     }
 #endif
+#if ENABLE_LAZY_SWEEP
+    // Finish the sweeping the last collection left to allocation now, rather than in the next collection's pause
+    if (!recycler->CollectionInProgress())
+    {
+        recycler->FinishLazySweep();
+    }
+#endif
 
     while (true)
     {
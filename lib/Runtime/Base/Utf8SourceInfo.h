@@ -336,6 +336,12 @@ namespace Js
             return sourceHolder;
         }
 
+        // Hash of the source text, used to find data recorded for an identical source loaded earlier
+        uint GetSourceHash() const
+        {
+            return (uint)sourceHolder->GetHashCode();
+        }
+
         bool IsCesu8() const
         {
             return this->m_isCesu8;
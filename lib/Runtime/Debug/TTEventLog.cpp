@@ -121,6 +121,17 @@ namespace TTD
         this->m_callAction = nullptr;
     }
 
+    TTDExcludedExecutionModePopper::TTDExcludedExecutionModePopper(EventLog* log)
+        : m_log(log)
+    {
+        this->m_log->PushMode(TTDMode::ExcludedExecution);
+    }
+
+    TTDExcludedExecutionModePopper::~TTDExcludedExecutionModePopper()
+    {
+        this->m_log->PopMode(TTDMode::ExcludedExecution);
+    }
+
     /////////////
 
     void TTEventList::AddArrayLink()
@@ -1561,10 +1572,13 @@ namespace TTD
         }
     }
 
-    void EventLog::DoSnapshotInflate(int64 etime)
+    void EventLog::DoSnapshotInflate(int64 etime, bool isStartupSnapshot)
     {
-        //collect anything that is dead
-        this->m_threadContext->GetRecycler()->CollectNow<CollectNowForceInThread>();
+        //collect anything that is dead (nothing in a fresh context can be reused so a startup snapshot doesn't need this)
+        if(!isStartupSnapshot)
+        {
+            this->m_threadContext->GetRecycler()->CollectNow<CollectNowForceInThread>();
+        }
 
         const SnapShot* snap = nullptr;
         int64 restoreEventTime = -1;
@@ -1629,7 +1643,14 @@ namespace TTD
 
         if(this->m_lastInflateMap != nullptr)
         {
-            this->m_lastInflateMap->PrepForReInflate(snap->ContextCount(), snap->HandlerCount(), snap->TypeCount(), snap->PrimitiveCount() + snap->ObjectCount(), snap->BodyCount(), snap->EnvCount(), snap->SlotArrayCount());
+            if(isStartupSnapshot)
+            {
+                this->m_lastInflateMap->PrepForFreshInflate(snap->ContextCount(), snap->HandlerCount(), snap->TypeCount(), snap->PrimitiveCount() + snap->ObjectCount(), snap->BodyCount(), snap->EnvCount(), snap->SlotArrayCount());
+            }
+            else
+            {
+                this->m_lastInflateMap->PrepForReInflate(snap->ContextCount(), snap->HandlerCount(), snap->TypeCount(), snap->PrimitiveCount() + snap->ObjectCount(), snap->BodyCount(), snap->EnvCount(), snap->SlotArrayCount());
+            }
 
             NSSnapValues::InflateScriptContext(sCtx, this->m_ttdContext, this->m_lastInflateMap, topLevelLoadScriptMap, topLevelNewScriptMap, topLevelEvalScriptMap);
         }
@@ -1705,6 +1726,29 @@ namespace TTD
 #endif
     }
 
+    LPCWSTR EventLog::EmitStartupSnapshot()
+    {
+        AssertMsg(this->m_ttdContext != nullptr, "We aren't actually tracking anything!!!");
+        AssertMsg((this->m_currentMode & TTDMode::RecordEnabled) == TTDMode::RecordEnabled, "Startup snapshots are taken from a recording context.");
+
+        this->DoSnapshotExtract();
+        this->EmitLog_Helper(true);
+
+        return this->m_logInfoRootDir.Contents;
+    }
+
+    void EventLog::InflateStartupSnapshot()
+    {
+        AssertMsg(this->m_eventList.Count() == 1, "A startup snapshot log should hold exactly one event.");
+
+        NSLogEvents::EventLogEntry* evt = this->m_eventList.GetIteratorAtFirst().Current();
+        AssertMsg(evt->EventKind == NSLogEvents::EventKind::SnapshotTag, "A startup snapshot log should hold exactly one snapshot event.");
+
+        //every context created from the startup snapshot is a fresh one -- the inflate map (and its pin sets) from the previous context are kept and cleared instead of rebuilt
+        const NSLogEvents::SnapshotEventLogEntry* snapEvent = NSLogEvents::GetInlineEventDataAs<NSLogEvents::SnapshotEventLogEntry, NSLogEvents::EventKind::SnapshotTag>(evt);
+        this->DoSnapshotInflate(snapEvent->RestoreTimestamp, true);
+    }
+
     void EventLog::ReplaySingleEntry()
     {
         if(!this->m_currentReplayEventIterator.IsValid())
@@ -2090,6 +2134,13 @@ namespace TTD
             return _u("Record Disabled -- No Log Written!");
         }
 
+        this->EmitLog_Helper(false);
+
+        return this->m_logInfoRootDir.Contents;
+    }
+
+    void EventLog::EmitLog_Helper(bool snapshotOnly)
+    {
 #if ENABLE_BASIC_TRACE || ENABLE_FULL_BC_TRACE
         this->m_diagnosticLogger.ForceFlush();
 #endif
@@ -2130,7 +2181,8 @@ namespace TTD
         writer.WriteUInt64(NSTokens::Key::usedMemory, usedSpace, NSTokens::Separator::CommaSeparator);
         writer.WriteUInt64(NSTokens::Key::reservedMemory, reservedSpace, NSTokens::Separator::CommaSeparator);
 
-        uint32 ecount = this->m_eventList.Count();
+        //a startup snapshot only carries the snapshot event that was just added at the end of the log
+        uint32 ecount = snapshotOnly ? 1 : this->m_eventList.Count();
         writer.WriteLengthValue(ecount, NSTokens::Separator::CommaAndBigSpaceSeparator);
 
         JsUtil::Stack<int64, HeapAllocator> callNestingStack(&HeapAllocator::Instance);
@@ -2139,7 +2191,7 @@ namespace TTD
         writer.WriteSequenceStart_DefaultKey(NSTokens::Separator::CommaSeparator);
         writer.AdjustIndent(1);
         writer.WriteSeperator(NSTokens::Separator::BigSpaceSeparator);
-        for(auto iter = this->m_eventList.GetIteratorAtFirst(); iter.IsValid(); iter.MoveNext())
+        for(auto iter = (snapshotOnly ? this->m_eventList.GetIteratorAtLast() : this->m_eventList.GetIteratorAtFirst()); iter.IsValid(); iter.MoveNext())
         {
             const NSLogEvents::EventLogEntry* evt = iter.Current();
 
@@ -2283,8 +2335,6 @@ namespace TTD
         writer.WriteRecordEnd(NSTokens::Separator::BigSpaceSeparator);
 
         writer.FlushAndClose();
-
-        return this->m_logInfoRootDir.Contents;
     }
 
     void EventLog::ParseLogInto()
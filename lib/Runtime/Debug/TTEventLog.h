@@ -89,6 +89,17 @@ namespace TTD
         void NormalReturn(Js::Var returnValue);
     };
 
+    //A class to ensure that even when exceptions are thrown the excluded execution mode we pushed is popped again
+    class TTDExcludedExecutionModePopper
+    {
+    private:
+        EventLog* m_log;
+
+    public:
+        TTDExcludedExecutionModePopper(EventLog* log);
+        ~TTDExcludedExecutionModePopper();
+    };
+
     //A list class for the events that we accumulate in the event log
     class TTEventList
     {
@@ -547,7 +558,14 @@ namespace TTD
         void UpdateInflateMapForFreshScriptContexts();
 
         //Do the inflation of the snapshot that is at the given event time
-        void DoSnapshotInflate(int64 etime);
+        //A startup snapshot is inflated into a fresh context so it skips the collection and the object reuse of a re-inflate
+        void DoSnapshotInflate(int64 etime, bool isStartupSnapshot);
+
+        //Take a snapshot of the (bootstrapped) context and write it out as a startup snapshot -- a log with only that snapshot event in it
+        LPCWSTR EmitStartupSnapshot();
+
+        //Inflate the startup snapshot that was parsed by InitForTTDReplay into the TTD context (the caller detaches the context afterwards)
+        void InflateStartupSnapshot();
 
         //For replay the from the current event (should either be a top-level call/code-load action or a snapshot)
         void ReplaySingleEntry();
@@ -637,6 +655,7 @@ namespace TTD
         //Emit code and support
 
         LPCWSTR EmitLogIfNeeded();
+        void EmitLog_Helper(bool snapshotOnly);
         void ParseLogInto();
     };
 }
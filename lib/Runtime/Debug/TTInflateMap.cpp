@@ -99,6 +99,25 @@ namespace TTD
         this->m_slotArrayPinSet->Clear();
     }
 
+    void InflateMap::PrepForFreshInflate(uint32 ctxCount, uint32 handlerCount, uint32 typeCount, uint32 objectCount, uint32 bodyCount, uint32 envCount, uint32 slotCount)
+    {
+        this->m_typeMap.Initialize(typeCount);
+        this->m_handlerMap.Initialize(handlerCount);
+        this->m_tagToGlobalObjectMap.Initialize(ctxCount);
+        this->m_environmentMap.Initialize(envCount);
+        this->m_slotArrayMap.Initialize(slotCount);
+        this->m_promiseDataMap.Clear();
+
+        //Nothing from the previous context can be reused in a fresh one so we just clear these (they were sized for the same snapshot)
+        AssertMsg(!this->m_oldObjectMap.IsValid() && this->m_oldInflatePinSet == nullptr, "We should have cleaned up after the last inflate.");
+        this->m_objectMap.Clear();
+        this->m_functionBodyMap.Clear();
+
+        this->m_inflatePinSet->Clear();
+        this->m_environmentPinSet->Clear();
+        this->m_slotArrayPinSet->Clear();
+    }
+
     void InflateMap::CleanupAfterInflate()
     {
         this->m_handlerMap.Unload();
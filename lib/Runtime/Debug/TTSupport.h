@@ -1122,6 +1122,15 @@ namespace TTD
             this->Unload();
         }
 
+        //Remove all the entries but keep the hash array for the next use
+        void Clear()
+        {
+            AssertMsg(this->m_hashArray != nullptr, "Not valid!!");
+
+            memset(this->m_hashArray, 0, this->m_capacity * sizeof(Entry));
+            this->m_count = 0;
+        }
+
         void MoveDataInto(TTDIdentifierDictionary& src)
         {
             this->m_h1Prime = src.m_h1Prime;
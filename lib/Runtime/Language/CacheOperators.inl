@@ -86,6 +86,32 @@ namespace Js
                 {
                     return true;
                 }
+
+                // The polymorphic inline cache can't grow any further, so fall back to the script context's megamorphic
+                // inline cache before doing a full lookup.
+                MegamorphicInlineCache *const megamorphicInlineCache = requestContext->GetMegamorphicInlineCache();
+                if (megamorphicInlineCache &&
+                    (IsPolymorphicInlineCacheAvailable || polymorphicInlineCache) &&
+                    MegamorphicInlineCache::IsMegamorphic(polymorphicInlineCache) &&
+                    megamorphicInlineCache->TryGetProperty<
+                            CheckLocal,
+                            CheckProto,
+                            CheckAccessor,
+                            CheckMissing,
+                            IsInlineCacheAvailable,
+                            ReturnOperationInfo
+                        >(
+                            instance,
+                            object,
+                            propertyId,
+                            propertyValue,
+                            requestContext,
+                            operationInfo,
+                            inlineCache
+                        ))
+                {
+                    return true;
+                }
             }
         }
 
@@ -199,6 +225,29 @@ namespace Js
                 {
                     return true;
                 }
+
+                MegamorphicInlineCache *const megamorphicInlineCache = requestContext->GetMegamorphicInlineCache();
+                if (megamorphicInlineCache &&
+                    (IsPolymorphicInlineCacheAvailable || polymorphicInlineCache) &&
+                    MegamorphicInlineCache::IsMegamorphic(polymorphicInlineCache) &&
+                    megamorphicInlineCache->TrySetProperty<
+                            CheckLocal,
+                            CheckLocalTypeWithoutProperty,
+                            CheckAccessor,
+                            IsInlineCacheAvailable,
+                            ReturnOperationInfo
+                        >(
+                            object,
+                            propertyId,
+                            propertyValue,
+                            requestContext,
+                            operationInfo,
+                            inlineCache,
+                            propertyOperationFlags
+                        ))
+                {
+                    return true;
+                }
             }
         }
 
@@ -488,6 +537,48 @@ namespace Js
                     isProto,
                     requestContext);
             }
+
+            if(MegamorphicInlineCache::IsMegamorphic(polymorphicInlineCache))
+            {
+                MegamorphicInlineCache *const megamorphicInlineCache = requestContext->EnsureMegamorphicInlineCache();
+                if(!IsAccessor)
+                {
+                    if(!isProto)
+                    {
+                        megamorphicInlineCache->CacheLocal(
+                            type,
+                            propertyId,
+                            propertyIndex,
+                            isInlineSlot,
+                            typeWithoutProperty,
+                            requiredAuxSlotCapacity,
+                            requestContext);
+                    }
+                    else
+                    {
+                        megamorphicInlineCache->CacheProto(
+                            objectWithProperty,
+                            propertyId,
+                            propertyIndex,
+                            isInlineSlot,
+                            isMissing,
+                            type,
+                            requestContext);
+                    }
+                }
+                else
+                {
+                    megamorphicInlineCache->CacheAccessor(
+                        IsRead,
+                        propertyId,
+                        propertyIndex,
+                        isInlineSlot,
+                        type,
+                        objectWithProperty,
+                        isProto,
+                        requestContext);
+                }
+            }
         }
 
         if(!includeTypePropertyCache)
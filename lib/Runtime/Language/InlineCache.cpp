@@ -909,6 +909,108 @@ namespace Js
     }
 #endif
 
+    MegamorphicInlineCache * MegamorphicInlineCache::New(ScriptContext * scriptContext)
+    {
+        // The inline caches must come from the inline cache arena, which is what the thread context's invalidation lists
+        // and ScriptContext::ClearInlineCaches operate on. The property IDs are plain data and live in the general arena.
+        PropertyId * propertyIds = AnewArrayZ(scriptContext->GeneralAllocator(), PropertyId, MegamorphicInlineCacheSize);
+        MegamorphicInlineCache * megamorphicInlineCache = Anew(scriptContext->GeneralAllocator(), MegamorphicInlineCache, propertyIds);
+        for (uint i = 0; i < InlineCacheChunkCount; i++)
+        {
+            megamorphicInlineCache->inlineCacheChunks[i] =
+                AllocatorNewArrayZ(InlineCacheAllocator, scriptContext->GetInlineCacheAllocator(), InlineCache, MaxPolymorphicInlineCacheSize);
+        }
+        return megamorphicInlineCache;
+    }
+
+    InlineCache * MegamorphicInlineCache::GetInlineCacheToPopulate(const Type * type, const PropertyId propertyId)
+    {
+        uint inlineCacheIndex = GetInlineCacheIndex(type, propertyId);
+        InlineCache *const inlineCache = GetInlineCache(inlineCacheIndex);
+        if (propertyIds[inlineCacheIndex] != propertyId)
+        {
+            // The entry was registered for invalidation under its previous property ID, which no longer applies once it
+            // is reused for another property.
+            inlineCache->RemoveFromInvalidationList();
+            inlineCache->Clear();
+            propertyIds[inlineCacheIndex] = propertyId;
+        }
+        return inlineCache;
+    }
+
+    void MegamorphicInlineCache::CacheLocal(
+        Type *const type,
+        const PropertyId propertyId,
+        const PropertyIndex propertyIndex,
+        const bool isInlineSlot,
+        Type *const typeWithoutProperty,
+        int requiredAuxSlotCapacity,
+        ScriptContext *const requestContext)
+    {
+        // An add property cache is looked up by the type the object has before the property is added.
+        InlineCache *const inlineCache = GetInlineCacheToPopulate(typeWithoutProperty ? typeWithoutProperty : type, propertyId);
+        inlineCache->CacheLocal(
+            type, propertyId, propertyIndex, isInlineSlot, typeWithoutProperty, requiredAuxSlotCapacity, requestContext);
+
+#if DBG_DUMP
+        if (PHASE_VERBOSE_TRACE1(Js::MegamorphicInlineCachePhase))
+        {
+            Output::Print(_u("MIC::CacheLocal, %s: "), requestContext->GetPropertyName(propertyId)->GetBuffer());
+            inlineCache->Dump();
+            Output::Print(_u("\n"));
+            Output::Flush();
+        }
+#endif
+    }
+
+    void MegamorphicInlineCache::CacheProto(
+        DynamicObject *const prototypeObjectWithProperty,
+        const PropertyId propertyId,
+        const PropertyIndex propertyIndex,
+        const bool isInlineSlot,
+        const bool isMissing,
+        Type *const type,
+        ScriptContext *const requestContext)
+    {
+        InlineCache *const inlineCache = GetInlineCacheToPopulate(type, propertyId);
+        inlineCache->CacheProto(
+            prototypeObjectWithProperty, propertyId, propertyIndex, isInlineSlot, isMissing, type, requestContext);
+
+#if DBG_DUMP
+        if (PHASE_VERBOSE_TRACE1(Js::MegamorphicInlineCachePhase))
+        {
+            Output::Print(_u("MIC::CacheProto, %s: "), requestContext->GetPropertyName(propertyId)->GetBuffer());
+            inlineCache->Dump();
+            Output::Print(_u("\n"));
+            Output::Flush();
+        }
+#endif
+    }
+
+    void MegamorphicInlineCache::CacheAccessor(
+        const bool isGetter,
+        const PropertyId propertyId,
+        const PropertyIndex propertyIndex,
+        const bool isInlineSlot,
+        Type *const type,
+        DynamicObject *const object,
+        const bool isOnProto,
+        ScriptContext *const requestContext)
+    {
+        InlineCache *const inlineCache = GetInlineCacheToPopulate(type, propertyId);
+        inlineCache->CacheAccessor(isGetter, propertyId, propertyIndex, isInlineSlot, type, object, isOnProto, requestContext);
+
+#if DBG_DUMP
+        if (PHASE_VERBOSE_TRACE1(Js::MegamorphicInlineCachePhase))
+        {
+            Output::Print(_u("MIC::CacheAccessor, %s: "), requestContext->GetPropertyName(propertyId)->GetBuffer());
+            inlineCache->Dump();
+            Output::Print(_u("\n"));
+            Output::Flush();
+        }
+#endif
+    }
+
     bool EquivalentTypeSet::Contains(const Js::Type * type, uint16* pIndex) const
     {
         for (uint16 ti = 0; ti < this->count; ti++)
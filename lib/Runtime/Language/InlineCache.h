@@ -533,6 +533,108 @@ namespace Js
 #endif
     };
 
+    // Cache of (type, property ID) pairs shared by all property access sites of a script context whose polymorphic inline
+    // cache has already grown to MaxPolymorphicInlineCacheSize. Each entry is an ordinary inline cache allocated from the
+    // script context's inline cache arena, so it is registered on, and invalidated through, the thread context's proto and
+    // store field inline cache invalidation lists like any other inline cache. Since an entry may be reused for a different
+    // property, the property ID it was populated for is kept alongside it.
+    class MegamorphicInlineCache
+    {
+    private:
+        // The inline cache arena only hands out arrays up to MaxPolymorphicInlineCacheSize caches, so the table is
+        // allocated in chunks of that size.
+        static const uint InlineCacheChunkCount = MegamorphicInlineCacheSize / MaxPolymorphicInlineCacheSize;
+        CompileAssert(InlineCacheChunkCount * MaxPolymorphicInlineCacheSize == MegamorphicInlineCacheSize);
+
+        InlineCache * inlineCacheChunks[InlineCacheChunkCount];
+        PropertyId * propertyIds;
+
+        MegamorphicInlineCache(PropertyId * propertyIds)
+            : propertyIds(propertyIds)
+        {
+        }
+
+    public:
+        static MegamorphicInlineCache * New(ScriptContext * scriptContext);
+
+        static bool IsMegamorphic(PolymorphicInlineCache *const polymorphicInlineCache)
+        {
+            return polymorphicInlineCache->GetSize() == MaxPolymorphicInlineCacheSize && !PHASE_OFF1(Js::MegamorphicInlineCachePhase);
+        }
+
+        void CacheLocal(
+            Type *const type,
+            const PropertyId propertyId,
+            const PropertyIndex propertyIndex,
+            const bool isInlineSlot,
+            Type *const typeWithoutProperty,
+            int requiredAuxSlotCapacity,
+            ScriptContext *const requestContext);
+
+        void CacheProto(
+            DynamicObject *const prototypeObjectWithProperty,
+            const PropertyId propertyId,
+            const PropertyIndex propertyIndex,
+            const bool isInlineSlot,
+            const bool isMissing,
+            Type *const type,
+            ScriptContext *const requestContext);
+
+        void CacheAccessor(
+            const bool isGetter,
+            const PropertyId propertyId,
+            const PropertyIndex propertyIndex,
+            const bool isInlineSlot,
+            Type *const type,
+            DynamicObject *const object,
+            const bool isOnProto,
+            ScriptContext *const requestContext);
+
+        template<
+            bool CheckLocal,
+            bool CheckProto,
+            bool CheckAccessor,
+            bool CheckMissing,
+            bool IsInlineCacheAvailable,
+            bool ReturnOperationInfo>
+        bool TryGetProperty(
+            Var const instance,
+            RecyclableObject *const propertyObject,
+            const PropertyId propertyId,
+            Var *const propertyValue,
+            ScriptContext *const requestContext,
+            PropertyCacheOperationInfo *const operationInfo,
+            InlineCache *const inlineCacheToPopulate);
+
+        template<
+            bool CheckLocal,
+            bool CheckLocalTypeWithoutProperty,
+            bool CheckAccessor,
+            bool IsInlineCacheAvailable,
+            bool ReturnOperationInfo>
+        bool TrySetProperty(
+            RecyclableObject *const object,
+            const PropertyId propertyId,
+            Var propertyValue,
+            ScriptContext *const requestContext,
+            PropertyCacheOperationInfo *const operationInfo,
+            InlineCache *const inlineCacheToPopulate,
+            const PropertyOperationFlags propertyOperationFlags = PropertyOperation_None);
+
+    private:
+        static uint GetInlineCacheIndex(const Type * type, const PropertyId propertyId)
+        {
+            return (uint)((((size_t)type) >> PolymorphicInlineCacheShift) ^ ((size_t)propertyId * 0x9E3779B1)) & (MegamorphicInlineCacheSize - 1);
+        }
+
+        InlineCache * GetInlineCache(const uint inlineCacheIndex) const
+        {
+            return &inlineCacheChunks[inlineCacheIndex / MaxPolymorphicInlineCacheSize][inlineCacheIndex % MaxPolymorphicInlineCacheSize];
+        }
+
+        InlineCache * GetInlineCacheToPopulate(const Type * type, const PropertyId propertyId);
+    };
+
     class EquivalentTypeSet
     {
     private:
@@ -626,4 +626,77 @@ namespace Js
 
         return result;
     }
+
+    template<
+        bool CheckLocal,
+        bool CheckProto,
+        bool CheckAccessor,
+        bool CheckMissing,
+        bool IsInlineCacheAvailable,
+        bool ReturnOperationInfo>
+    bool MegamorphicInlineCache::TryGetProperty(
+        Var const instance,
+        RecyclableObject *const propertyObject,
+        const PropertyId propertyId,
+        Var *const propertyValue,
+        ScriptContext *const requestContext,
+        PropertyCacheOperationInfo *const operationInfo,
+        InlineCache *const inlineCacheToPopulate)
+    {
+        Assert(!IsInlineCacheAvailable || inlineCacheToPopulate);
+        Assert(!ReturnOperationInfo || operationInfo);
+
+        uint inlineCacheIndex = GetInlineCacheIndex(propertyObject->GetType(), propertyId);
+        if (propertyIds[inlineCacheIndex] != propertyId)
+        {
+            return false;
+        }
+
+        InlineCache *const cache = GetInlineCache(inlineCacheIndex);
+        bool result = cache->TryGetProperty<CheckLocal, CheckProto, CheckAccessor, CheckMissing, ReturnOperationInfo>(
+            instance, propertyObject, propertyId, propertyValue, requestContext, operationInfo);
+
+        if (IsInlineCacheAvailable && result)
+        {
+            cache->CopyTo(propertyId, requestContext, inlineCacheToPopulate);
+        }
+
+        return result;
+    }
+
+    template<
+        bool CheckLocal,
+        bool CheckLocalTypeWithoutProperty,
+        bool CheckAccessor,
+        bool IsInlineCacheAvailable,
+        bool ReturnOperationInfo>
+    bool MegamorphicInlineCache::TrySetProperty(
+        RecyclableObject *const object,
+        const PropertyId propertyId,
+        Var propertyValue,
+        ScriptContext *const requestContext,
+        PropertyCacheOperationInfo *const operationInfo,
+        InlineCache *const inlineCacheToPopulate,
+        const PropertyOperationFlags propertyOperationFlags)
+    {
+        Assert(!IsInlineCacheAvailable || inlineCacheToPopulate);
+        Assert(!ReturnOperationInfo || operationInfo);
+
+        uint inlineCacheIndex = GetInlineCacheIndex(object->GetType(), propertyId);
+        if (propertyIds[inlineCacheIndex] != propertyId)
+        {
+            return false;
+        }
+
+        InlineCache *const cache = GetInlineCache(inlineCacheIndex);
+        bool result = cache->TrySetProperty<CheckLocal, CheckLocalTypeWithoutProperty, CheckAccessor, ReturnOperationInfo>(
+            object, propertyId, propertyValue, requestContext, operationInfo, propertyOperationFlags);
+
+        if (IsInlineCacheAvailable && result)
+        {
+            cache->CopyTo(propertyId, requestContext, inlineCacheToPopulate);
+        }
+
+        return result;
+    }
 }
@@ -2227,6 +2227,24 @@ namespace Js
         m_outSp        = m_outParams;
     }
 
+    void InterpreterStackFrame::EnumerateStackRanges(RecyclerScanStackCallback& scanStackCallback)
+    {
+        // asm.js frames keep raw int/double values and interior pointers in their slots, so they stay conservative
+        if (m_functionBody->GetIsAsmJsFunction())
+        {
+            return;
+        }
+
+        //
+        // The locals and the pushed out params only ever hold Vars (or pointers to the start of an object
+        // or into this frame). The rest of the out param area above m_outSp is left over from earlier calls.
+        //
+        Var * outParamsEnd = m_localSlots + m_functionBody->GetLocalsCount() + m_functionBody->GetOutParamMaxDepth();
+        Assert(m_outSp >= m_localSlots + m_functionBody->GetLocalsCount() && m_outSp <= outParamsEnd);
+
+        scanStackCallback((void **)m_localSlots, (m_outSp - m_localSlots) * sizeof(Var), (outParamsEnd - m_outSp) * sizeof(Var));
+    }
+
     _NOINLINE
     Var InterpreterStackFrame::DebugProcessThunk(void* returnAddress, void* addressOfReturnAddress)
     {
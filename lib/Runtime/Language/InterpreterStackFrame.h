@@ -222,6 +222,7 @@ namespace Js
         uint GetCurrentLoopNum() const { return currentLoopNum; }
         InterpreterStackFrame* GetPreviousFrame() const {return previousInterpreterFrame;}
         void SetPreviousFrame(InterpreterStackFrame *interpreterFrame) {previousInterpreterFrame = interpreterFrame;}
+        void EnumerateStackRanges(RecyclerScanStackCallback& scanStackCallback);
         Var GetArgumentsObject() const { return m_arguments; }
         void SetArgumentsObject(Var args) { m_arguments = args; }
         UINT16 GetFlags() const { return m_flags; }
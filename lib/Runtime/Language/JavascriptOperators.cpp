@@ -6031,7 +6031,11 @@ CommonNumber:
         RecyclableObject* prototype = JavascriptOperators::GetPrototypeObjectForConstructorCache(function, constructorScriptContext, prototypeCanBeCached);
         prototype = RecyclableObject::FromVar(CrossSite::MarshalVar(requestContext, prototype));
 
-        DynamicObject* newObject = requestContext->GetLibrary()->CreateObject(prototype, 8);
+        // Unless slack tracking found that earlier instances needed more room, start out with 8 inline slots. The capacity is
+        // shrunk to what the constructor actually uses once the cached type is finalized.
+        uint16 inlineSlotCapacity = functionBody != nullptr && functionBody->GetConstructorInlineSlotCapacity() != 0 ?
+            functionBody->GetConstructorInlineSlotCapacity() : 8;
+        DynamicObject* newObject = requestContext->GetLibrary()->CreateObject(prototype, inlineSlotCapacity);
 
         JS_ETW(EventWriteJSCRIPT_RECYCLER_ALLOCATE_OBJECT(newObject));
 #if ENABLE_DEBUG_CONFIG_OPTIONS
@@ -6251,6 +6255,11 @@ CommonNumber:
             DynamicType* cachedType = constructorCache->NeedsTypeUpdate() ? constructorCache->GetPendingType() : constructorCache->GetType();
             DynamicTypeHandler* cachedTypeHandler = cachedType->GetTypeHandler();
 
+            if (TryGrowConstructorInlineSlotCapacity(constructor, constructorBody, cachedTypeHandler))
+            {
+                return;
+            }
+
             // Consider: We could delay inline slot capacity shrinking until the second time this constructor is invoked.  In some cases
             // this might permit more properties to remain inlined if the objects grow after constructor.  This would require flagging
             // the cache as special (already possible) and forcing the shrinking during work item creation if we happen to JIT this
@@ -6289,6 +6298,49 @@ CommonNumber:
         }
     }
 
+    bool JavascriptOperators::TryGrowConstructorInlineSlotCapacity(JavascriptFunction* constructor, FunctionBody* constructorBody, DynamicTypeHandler* cachedTypeHandler)
+    {
+        // Constructor slack tracking. The cached type is only finalized after the first few instances have been created (see
+        // ConstructorCallsRequiredToFinalizeCachedType). By then the types on the path from the cached type's root also
+        // reflect properties those instances received after the constructor returned. If the instances outgrew the inline
+        // slots they were allocated with, remember a larger capacity on the function body and drop the constructor cache,
+        // so it is repopulated with a root type that keeps all of those properties inline. We grow at most once per function
+        // body. Next time around the cached type is finalized and shrunk as usual.
+        if (PHASE_OFF(Js::ConstructorSlackTrackingPhase, constructorBody) ||
+            constructorBody->GetConstructorInlineSlotCapacity() != 0 ||
+            cachedTypeHandler->GetIsInlineSlotCapacityLocked())
+        {
+            return false;
+        }
+
+        uint16 maxPathLength;
+        if (!cachedTypeHandler->GetMaxPathLengthFromRoot(&maxPathLength) ||
+            maxPathLength <= cachedTypeHandler->GetInlineSlotCapacity())
+        {
+            return false;
+        }
+
+        const uint16 newInlineSlotCapacity = (uint16)min(static_cast<uint32>(maxPathLength), static_cast<uint32>(CONFIG_FLAG(MaxConstructorInlineSlotCapacity)));
+        if (newInlineSlotCapacity <= cachedTypeHandler->GetInlineSlotCapacity())
+        {
+            return false;
+        }
+
+#if DBG_DUMP
+        if (Js::Configuration::Global.flags.Trace.IsEnabled(Js::InlineSlotsPhase))
+        {
+            char16 debugStringBuffer[MAX_FUNCTION_BODY_DEBUG_STRING_SIZE];
+
+            Output::Print(_u("Inline slot capacity grown: Function:%04s Before:%d After:%d\n"),
+                constructorBody->GetDebugNumberSet(debugStringBuffer), cachedTypeHandler->GetInlineSlotCapacity(), newInlineSlotCapacity);
+        }
+#endif
+
+        constructorBody->SetConstructorInlineSlotCapacity(newInlineSlotCapacity);
+        constructor->ResetConstructorCacheToDefault();
+        return true;
+    }
+
     void JavascriptOperators::TraceUseConstructorCache(const ConstructorCache* ctorCache, const JavascriptFunction* ctor, bool isHit)
     {
 #if DBG_DUMP
@@ -0,0 +1,245 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+#pragma once
+
+namespace Js
+{
+#if defined(_M_X64)
+    // Lane-wise operations on a 16-byte block of elements of the given type. Compares set every bit of a matching
+    // lane, so _mm_movemask_epi8 reports sizeof(T) bits per matching element.
+    template <typename T, size_t size = sizeof(T)> struct ArrayBlockLanes;
+
+    template <typename T>
+    struct ArrayBlockLanes<T, 2>
+    {
+        static __m128i Splat(T value) { return _mm_set1_epi16((short)value); }
+        static __m128i Eq(__m128i block, __m128i splat) { return _mm_cmpeq_epi16(block, splat); }
+        static __m128i Reverse(__m128i block)
+        {
+            block = _mm_shufflelo_epi16(block, _MM_SHUFFLE(0, 1, 2, 3));
+            block = _mm_shufflehi_epi16(block, _MM_SHUFFLE(0, 1, 2, 3));
+            return _mm_shuffle_epi32(block, _MM_SHUFFLE(1, 0, 3, 2));
+        }
+    };
+
+    template <typename T>
+    struct ArrayBlockLanes<T, 1>
+    {
+        static __m128i Splat(T value) { return _mm_set1_epi8((char)value); }
+        static __m128i Eq(__m128i block, __m128i splat) { return _mm_cmpeq_epi8(block, splat); }
+        static __m128i Reverse(__m128i block)
+        {
+            // Swap the bytes of each 16-bit lane, then reverse the 16-bit lanes
+            block = _mm_or_si128(_mm_slli_epi16(block, 8), _mm_srli_epi16(block, 8));
+            return ArrayBlockLanes<uint16>::Reverse(block);
+        }
+    };
+
+    template <typename T>
+    struct ArrayBlockLanes<T, 4>
+    {
+        static __m128i Splat(T value) { return _mm_set1_epi32((int)value); }
+        static __m128i Eq(__m128i block, __m128i splat) { return _mm_cmpeq_epi32(block, splat); }
+        static __m128i Reverse(__m128i block) { return _mm_shuffle_epi32(block, _MM_SHUFFLE(0, 1, 2, 3)); }
+    };
+
+    template <typename T>
+    struct ArrayBlockLanes<T, 8>
+    {
+        static __m128i Splat(T value) { return _mm_set1_epi64x((int64)value); }
+        static __m128i Eq(__m128i block, __m128i splat)
+        {
+            // SSE2 has no 64-bit compare: a lane matches when both of its 32-bit halves do
+            __m128i halves = _mm_cmpeq_epi32(block, splat);
+            return _mm_and_si128(halves, _mm_shuffle_epi32(halves, _MM_SHUFFLE(2, 3, 0, 1)));
+        }
+        static __m128i Reverse(__m128i block) { return _mm_shuffle_epi32(block, _MM_SHUFFLE(1, 0, 3, 2)); }
+    };
+
+    template <>
+    struct ArrayBlockLanes<float, 4> : ArrayBlockLanes<uint32, 4>
+    {
+        static __m128i Splat(float value) { return _mm_castps_si128(_mm_set1_ps(value)); }
+        static __m128i Eq(__m128i block, __m128i splat) { return _mm_castps_si128(_mm_cmpeq_ps(_mm_castsi128_ps(block), _mm_castsi128_ps(splat))); }
+        static __m128i IsNaN(__m128i block) { return _mm_castps_si128(_mm_cmpunord_ps(_mm_castsi128_ps(block), _mm_castsi128_ps(block))); }
+    };
+
+    template <>
+    struct ArrayBlockLanes<double, 8> : ArrayBlockLanes<uint64, 8>
+    {
+        static __m128i Splat(double value) { return _mm_castpd_si128(_mm_set1_pd(value)); }
+        static __m128i Eq(__m128i block, __m128i splat) { return _mm_castpd_si128(_mm_cmpeq_pd(_mm_castsi128_pd(block), _mm_castsi128_pd(splat))); }
+        static __m128i IsNaN(__m128i block) { return _mm_castpd_si128(_mm_cmpunord_pd(_mm_castsi128_pd(block), _mm_castsi128_pd(block))); }
+    };
+#endif
+
+    // Searches and bulk updates over the contiguous elements of a native array segment or a typed array buffer.
+    // On x64 the elements are handled 16 bytes at a time; elsewhere the scalar loops do all of the work.
+    class ArrayKernels
+    {
+    public:
+        static const uint32 NotFound = (uint32)-1;
+
+        // First index in [start, end) whose element is == value, or NotFound. For floating point elements this is the
+        // strict equality of numbers: NaN is never found and -0 and +0 find each other.
+        template <typename T>
+        static uint32 IndexOf(const T* elements, uint32 start, uint32 end, T value)
+        {
+            return Find(elements, start, end, EqualMatch<T>(value));
+        }
+
+        // Last index in [start, end) whose element is == value, or NotFound
+        template <typename T>
+        static uint32 LastIndexOf(const T* elements, uint32 start, uint32 end, T value)
+        {
+            return FindLast(elements, start, end, EqualMatch<T>(value));
+        }
+
+        // First index in [start, end) holding any NaN, for the SameValueZero search of includes
+        template <typename T>
+        static uint32 IndexOfNaN(const T* elements, uint32 start, uint32 end)
+        {
+            return Find(elements, start, end, NaNMatch<T>());
+        }
+
+        template <typename T>
+        static void Fill(T* elements, uint32 start, uint32 end, T value)
+        {
+            uint32 i = start;
+#if defined(_M_X64)
+            const uint32 elementsPerBlock = sizeof(__m128i) / sizeof(T);
+            const __m128i splat = ArrayBlockLanes<T>::Splat(value);
+            for (; i < end && end - i >= elementsPerBlock; i += elementsPerBlock)
+            {
+                _mm_storeu_si128(reinterpret_cast<__m128i *>(elements + i), splat);
+            }
+#endif
+            for (; i < end; i++)
+            {
+                elements[i] = value;
+            }
+        }
+
+        template <typename T>
+        static void Reverse(T* elements, uint32 length)
+        {
+            uint32 lower = 0;
+            uint32 upper = length;
+#if defined(_M_X64)
+            // Swap whole blocks from both ends, reversing the lanes of each
+            const uint32 elementsPerBlock = sizeof(__m128i) / sizeof(T);
+            while (upper - lower >= 2 * elementsPerBlock)
+            {
+                upper -= elementsPerBlock;
+                __m128i lowerBlock = _mm_loadu_si128(reinterpret_cast<const __m128i *>(elements + lower));
+                __m128i upperBlock = _mm_loadu_si128(reinterpret_cast<const __m128i *>(elements + upper));
+                _mm_storeu_si128(reinterpret_cast<__m128i *>(elements + lower), ArrayBlockLanes<T>::Reverse(upperBlock));
+                _mm_storeu_si128(reinterpret_cast<__m128i *>(elements + upper), ArrayBlockLanes<T>::Reverse(lowerBlock));
+                lower += elementsPerBlock;
+            }
+#endif
+            while (upper - lower >= 2)
+            {
+                upper--;
+                T temp = elements[lower];
+                elements[lower] = elements[upper];
+                elements[upper] = temp;
+                lower++;
+            }
+        }
+
+    private:
+        template <typename T>
+        class EqualMatch
+        {
+        public:
+            EqualMatch(T value) : value(value)
+#if defined(_M_X64)
+                , splat(ArrayBlockLanes<T>::Splat(value))
+#endif
+            {
+            }
+
+            bool Match(T element) const { return element == value; }
+#if defined(_M_X64)
+            __m128i Match(__m128i block) const { return ArrayBlockLanes<T>::Eq(block, splat); }
+#endif
+
+        private:
+            T value;
+#if defined(_M_X64)
+            __m128i splat;
+#endif
+        };
+
+        template <typename T>
+        class NaNMatch
+        {
+        public:
+            bool Match(T element) const { return element != element; }
+#if defined(_M_X64)
+            __m128i Match(__m128i block) const { return ArrayBlockLanes<T>::IsNaN(block); }
+#endif
+        };
+
+        template <typename T, typename TMatch>
+        static uint32 Find(const T* elements, uint32 start, uint32 end, const TMatch& match)
+        {
+            uint32 i = start;
+#if defined(_M_X64)
+            const uint32 elementsPerBlock = sizeof(__m128i) / sizeof(T);
+            for (; i < end && end - i >= elementsPerBlock; i += elementsPerBlock)
+            {
+                __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i *>(elements + i));
+                int mask = _mm_movemask_epi8(match.Match(block));
+                if (mask != 0)
+                {
+                    DWORD index;
+                    _BitScanForward(&index, (DWORD)mask);
+                    return i + index / sizeof(T);
+                }
+            }
+#endif
+            for (; i < end; i++)
+            {
+                if (match.Match(elements[i]))
+                {
+                    return i;
+                }
+            }
+            return NotFound;
+        }
+
+        template <typename T, typename TMatch>
+        static uint32 FindLast(const T* elements, uint32 start, uint32 end, const TMatch& match)
+        {
+            uint32 i = end;
+#if defined(_M_X64)
+            const uint32 elementsPerBlock = sizeof(__m128i) / sizeof(T);
+            while (i > start && i - start >= elementsPerBlock)
+            {
+                i -= elementsPerBlock;
+                __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i *>(elements + i));
+                int mask = _mm_movemask_epi8(match.Match(block));
+                if (mask != 0)
+                {
+                    DWORD index;
+                    _BitScanReverse(&index, (DWORD)mask);
+                    return i + index / sizeof(T);
+                }
+            }
+#endif
+            while (i > start)
+            {
+                i--;
+                if (match.Match(elements[i]))
+                {
+                    return i;
+                }
+            }
+            return NotFound;
+        }
+    };
+}
@@ -6,6 +6,7 @@
 #include "Library/JSONStack.h"
 #include "Library/JSONParser.h"
 #include "Library/JSON.h"
+#include "Library/JSONStringifier.h"
 
 #define MAX_JSON_STRINGIFY_NAMES_ON_STACK 20
 static const int JSONspaceSize = 10; //ES5 defined limit on the indentation space
@@ -60,7 +61,7 @@ namespace JSON
     Js::Var Parse(Js::JavascriptString* input, Js::RecyclableObject* reviver, Js::ScriptContext* scriptContext)
     {
         // alignment required because of the union in JSONParser::m_token
-        __declspec (align(8)) JSONParser parser(scriptContext, reviver);
+        __declspec (align(8)) JSONParser<char16> parser(scriptContext, reviver);
         Js::Var result = NULL;
 
         TryFinally([&]()
@@ -94,6 +95,24 @@ namespace JSON
         return result;
     }
 
+    Js::Var ParseUtf8(const utf8char_t* input, charcount_t length, Js::ScriptContext* scriptContext)
+    {
+        // alignment required because of the union in JSONParser::m_token
+        __declspec (align(8)) JSONParser<utf8char_t> parser(scriptContext, nullptr);
+        Js::Var result = NULL;
+
+        TryFinally([&]()
+        {
+            result = parser.Parse(input, length);
+        },
+        [&](bool/*hasException*/)
+        {
+            parser.Finalizer();
+        });
+
+        return result;
+    }
+
     inline bool IsValidReplacerType(Js::TypeId typeId)
     {
         switch(typeId)
@@ -320,13 +339,16 @@ namespace JSON
         {
             stringifySession.CompleteInit(space, tempAlloc);
 
-            Js::DynamicObject* wrapper = scriptContext->GetLibrary()->CreateObject();
-            JS_ETW(EventWriteJSCRIPT_RECYCLER_ALLOCATE_OBJECT(wrapper));
-            Js::PropertyRecord const * propertyRecord;
-            scriptContext->GetOrAddPropertyRecord(_u(""), 0, &propertyRecord);
-            Js::PropertyId propertyId = propertyRecord->GetPropertyId();
-            Js::JavascriptOperators::InitProperty(wrapper, propertyId, value);
-            result = stringifySession.Str(scriptContext->GetLibrary()->GetEmptyString(), propertyId, wrapper);
+            if (stringifySession.GetReplacerType() == StringifySession::ReplacerNone)
+            {
+                JSONStringifier stringifier(scriptContext, tempAlloc, &stringifySession);
+                result = stringifier.TryStringify(value);
+            }
+
+            if (result == nullptr)
+            {
+                result = stringifySession.Str(value);
+            }
         }
         END_TEMP_ALLOCATOR(tempAlloc, scriptContext);
 
@@ -334,6 +356,23 @@ namespace JSON
         return result;
     }
 
+    bool StringifyUtf8(Js::Var value, Js::Var space, JSONWriteCallback writeCallback, void* callbackState, Js::ScriptContext* scriptContext)
+    {
+        bool hasText = false;
+        StringifySession stringifySession(scriptContext);
+
+        BEGIN_TEMP_ALLOCATOR(tempAlloc, scriptContext, _u("JSON"))
+        {
+            stringifySession.CompleteInit(space, tempAlloc);
+
+            JSONStringifier stringifier(scriptContext, tempAlloc, &stringifySession);
+            hasText = stringifier.Stream(value, writeCallback, callbackState);
+        }
+        END_TEMP_ALLOCATOR(tempAlloc, scriptContext);
+
+        return hasText;
+    }
+
     // -------- StringifySession implementation ------------//
 
     void StringifySession::CompleteInit(Js::Var space, ArenaAllocator* tempAlloc)
@@ -388,7 +427,33 @@ namespace JSON
         objectStack = Anew(tempAlloc, JSONStack, tempAlloc, scriptContext);
     }
 
+    Js::Var StringifySession::Str(Js::Var value)
+    {
+        return StrValue(GetSerializableValue(value));
+    }
+
+    Js::Var StringifySession::GetSerializableValue(Js::Var value)
+    {
+        Js::DynamicObject* wrapper = scriptContext->GetLibrary()->CreateObject();
+        JS_ETW(EventWriteJSCRIPT_RECYCLER_ALLOCATE_OBJECT(wrapper));
+        Js::PropertyRecord const * propertyRecord;
+        scriptContext->GetOrAddPropertyRecord(_u(""), 0, &propertyRecord);
+        Js::PropertyId propertyId = propertyRecord->GetPropertyId();
+        Js::JavascriptOperators::InitProperty(wrapper, propertyId, value);
+        return GetSerializableValue(scriptContext->GetLibrary()->GetEmptyString(), propertyId, wrapper);
+    }
+
     Js::Var StringifySession::Str(uint32 index, Js::Var holder)
+    {
+        return StrValue(GetSerializableValue(index, holder));
+    }
+
+    Js::Var StringifySession::Str(Js::JavascriptString* key, Js::PropertyId keyId, Js::Var holder)
+    {
+        return StrValue(GetSerializableValue(key, keyId, holder));
+    }
+
+    Js::Var StringifySession::GetSerializableValue(uint32 index, Js::Var holder)
     {
         Js::Var value;
         Js::RecyclableObject *undefined = scriptContext->GetLibrary()->GetUndefined();
@@ -415,10 +480,10 @@ namespace JSON
         }
 
         Js::JavascriptString *key = scriptContext->GetIntegerString(index);
-        return StrHelper(key, value, holder);
+        return PrepareValue(key, value, holder);
     }
 
-    Js::Var StringifySession::Str(Js::JavascriptString* key, Js::PropertyId keyId, Js::Var holder)
+    Js::Var StringifySession::GetSerializableValue(Js::JavascriptString* key, Js::PropertyId keyId, Js::Var holder)
     {
         Js::Var value;
         // We should look only into object's own properties here. When an object is serialized, only the own properties are considered,
@@ -431,17 +496,16 @@ namespace JSON
         {
             return scriptContext->GetLibrary()->GetUndefined();
         }
-        return StrHelper(key, value, holder);
+        return PrepareValue(key, value, holder);
     }
 
-    Js::Var StringifySession::StrHelper(Js::JavascriptString* key, Js::Var value, Js::Var holder)
+    Js::Var StringifySession::PrepareValue(Js::JavascriptString* key, Js::Var value, Js::Var holder)
     {
         PROBE_STACK(scriptContext, Js::Constants::MinStackDefault);
         AssertMsg(Js::RecyclableObject::Is(holder), "The holder argument in a JSON::Str function must be an object");
 
         Js::Var values[3];
         Js::Arguments args(0, values);
-        Js::Var undefined = scriptContext->GetLibrary()->GetUndefined();
 
         //check and apply 'toJSON' filter
         if (Js::JavascriptOperators::IsJsNativeObject(value) || (Js::JavascriptOperators::IsObject(value)))
@@ -484,8 +548,15 @@ namespace JSON
         {
             value = Js::JavascriptBooleanObject::FromVar(value)->GetValue() ? scriptContext->GetLibrary()->GetTrue() : scriptContext->GetLibrary()->GetFalse();
         }
+        return value;
+    }
+
+    Js::Var StringifySession::StrValue(Js::Var value)
+    {
+        PROBE_STACK(scriptContext, Js::Constants::MinStackDefault);
 
-        id = Js::JavascriptOperators::GetTypeId(value);
+        Js::Var undefined = scriptContext->GetLibrary()->GetUndefined();
+        Js::TypeId id = Js::JavascriptOperators::GetTypeId(value);
         switch (id)
         {
         case Js::TypeIds_Undefined:
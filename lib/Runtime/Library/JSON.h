@@ -7,7 +7,10 @@
 namespace JSON
 {
     class JSONStack;
-    class JSONParser;
+    template <typename EncodedChar> class JSONParser;
+
+    // Receives the UTF-8 output of JSONStringifier::Stream; returning false stops the stringification
+    typedef bool (*JSONWriteCallback)(void* callbackState, const utf8char_t* bytes, size_t byteCount);
 
     class EntryInfo
     {
@@ -18,9 +21,15 @@ namespace JSON
 
     Js::Var Stringify(Js::RecyclableObject* function, Js::CallInfo callInfo, ...);
     Js::Var Parse(Js::RecyclableObject* function, Js::CallInfo callInfo, ...);
+    // Parses UTF-8 JSON text directly, without a reviver; used by JsParseJsonUtf8
+    Js::Var ParseUtf8(const utf8char_t* input, charcount_t length, Js::ScriptContext* scriptContext);
+    // Stringifies without a replacer into UTF-8 chunks; used by JsStringifyJsonUtf8. Returns false if there is no JSON text.
+    bool StringifyUtf8(Js::Var value, Js::Var space, JSONWriteCallback writeCallback, void* callbackState, Js::ScriptContext* scriptContext);
 
     class StringifySession
     {
+        friend class JSONStringifier;
+
     public:
         enum ReplacerType
         {
@@ -61,9 +70,21 @@ namespace JSON
         }
         void CompleteInit(Js::Var space, ArenaAllocator* alloc);
 
+        // Stringifies a top-level value, held by a new object as its "" property
+        Js::Var Str(Js::Var value);
         Js::Var Str(Js::JavascriptString* key, Js::PropertyId keyId, Js::Var holder);
         Js::Var Str(uint32 index, Js::Var holder);
 
+        // Like Str, but returns the member's value after toJSON, the replacer and the unwrapping of primitive wrappers
+        // instead of its JSON text; StrValue gives the text of such a value
+        Js::Var GetSerializableValue(Js::Var value);
+        Js::Var GetSerializableValue(Js::JavascriptString* key, Js::PropertyId keyId, Js::Var holder);
+        Js::Var GetSerializableValue(uint32 index, Js::Var holder);
+        Js::Var StrValue(Js::Var value);
+
+        ReplacerType GetReplacerType() const { return replacerType; }
+        Js::JavascriptString* GetGap() const { return gap; }
+
     private:
         Js::JavascriptString* Quote(Js::JavascriptString* value);
 
@@ -99,6 +120,6 @@ namespace JSON
         Js::JavascriptString* gap;
         uint indent;
         Js::JavascriptString* propertySeparator;     // colon or colon+space
-        Js::Var StringifySession::StrHelper(Js::JavascriptString* key, Js::Var value, Js::Var holder);
+        Js::Var PrepareValue(Js::JavascriptString* key, Js::Var value, Js::Var holder);
     };
 } // namespace JSON
@@ -11,7 +11,8 @@ using namespace Js;
 namespace JSON
 {
     // -------- Parser implementation ------------//
-    void JSONParser::Finalizer()
+    template <typename EncodedChar>
+    void JSONParser<EncodedChar>::Finalizer()
     {
         m_scanner.Finalizer();
         if(arenaAllocatorObject)
@@ -20,7 +21,8 @@ namespace JSON
         }
     }
 
-    Js::Var JSONParser::Parse(LPCWSTR str, int length)
+    template <typename EncodedChar>
+    Js::Var JSONParser<EncodedChar>::Parse(const EncodedChar* str, int length)
     {
         if (length > MIN_CACHE_LENGTH)
         {
@@ -40,12 +42,16 @@ namespace JSON
         return ret;
     }
 
-    Js::Var JSONParser::Parse(Js::JavascriptString* input)
+    template <>
+    Js::Var JSONParser<char16>::Parse(Js::JavascriptString* input)
     {
-        return Parse(input->GetSz(), input->GetLength());
+        const char16* str = input->GetSz();
+        this->inputString = input;
+        return Parse(str, input->GetLength());
     }
 
-    Js::Var JSONParser::Walk(Js::JavascriptString* name, Js::PropertyId id, Js::Var holder, uint32 index)
+    template <typename EncodedChar>
+    Js::Var JSONParser<EncodedChar>::Walk(Js::JavascriptString* name, Js::PropertyId id, Js::Var holder, uint32 index)
     {
         AssertMsg(reviver, "JSON post parse walk with null reviver");
         Js::Var value;
@@ -184,7 +190,8 @@ namespace JSON
         return value;
     }
 
-    Js::Var JSONParser::ParseObject()
+    template <typename EncodedChar>
+    Js::Var JSONParser<EncodedChar>::ParseObject()
     {
         PROBE_STACK(scriptContext, Js::Constants::MinStackDefault);
 
@@ -200,9 +207,19 @@ namespace JSON
 
         case tkStrCon:
             {
-                // will auto-null-terminate the string (as length=len+1)
                 uint len = m_scanner.GetCurrentStringLen();
-                retVal = Js::JavascriptString::NewCopyBuffer(m_scanner.GetCurrentString(), len, scriptContext);
+                // No escapes: share the input's buffer instead of copying, but only for values large enough that a
+                // retained one can't pin a much larger payload (a short copy costs less than the SubString anyway)
+                if (inputString != nullptr && m_scanner.IsCurrentStringDirectInputTextMapped() &&
+                    len >= MIN_SUBSTRING_LENGTH && len >= inputString->GetLength() / MAX_SUBSTRING_INPUT_RATIO)
+                {
+                    retVal = Js::SubString::New(inputString, m_scanner.GetCurrentStringOffset(), len);
+                }
+                else
+                {
+                    // will auto-null-terminate the string (as length=len+1)
+                    retVal = Js::JavascriptString::NewCopyBuffer(m_scanner.GetCurrentString(), len, scriptContext);
+                }
                 Scan();
                 return retVal;
             }
@@ -412,4 +429,7 @@ namespace JSON
             m_scanner.ThrowSyntaxError(JSERR_JsonSyntax);
         }
     }
+
+    template class JSONParser<char16>;
+    template class JSONParser<utf8char_t>;
 } // namespace JSON
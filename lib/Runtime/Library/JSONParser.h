@@ -46,15 +46,18 @@ namespace JSON
     };
 
 
+    // EncodedChar is char16 for JSON.parse and utf8char_t for JsParseJsonUtf8
+    template <typename EncodedChar>
     class JSONParser
     {
     public:
         JSONParser(Js::ScriptContext* sc, Js::RecyclableObject* rv) : scriptContext(sc),
-            reviver(rv),  arenaAllocatorObject(nullptr), arenaAllocator(nullptr), typeCacheList(nullptr)
+            reviver(rv),  arenaAllocatorObject(nullptr), arenaAllocator(nullptr), typeCacheList(nullptr), inputString(nullptr)
         {
         };
 
-        Js::Var Parse(LPCWSTR str, int length);
+        Js::Var Parse(const EncodedChar* str, int length);
+        // Only for char16
         Js::Var Parse(Js::JavascriptString* input);
         Js::Var Walk(Js::JavascriptString* name, Js::PropertyId id, Js::Var holder, uint32 index = Js::JavascriptArray::InvalidIndex);
         void Finalizer();
@@ -80,13 +83,17 @@ namespace JSON
         }
 
         Token m_token;
-        JSONScanner m_scanner;
+        JSONScanner<EncodedChar> m_scanner;
         Js::ScriptContext* scriptContext;
         Js::RecyclableObject* reviver;
         Js::TempGuestArenaAllocatorObject* arenaAllocatorObject;
         ArenaAllocator* arenaAllocator;
         typedef JsUtil::BaseDictionary<const Js::PropertyRecord *, JsonTypeCache*, ArenaAllocator, PowerOf2SizePolicy, Js::PropertyRecordStringHashComparer>  JsonTypeCacheList;
         JsonTypeCacheList* typeCacheList;
+        // When parsing a JavascriptString, string values without escapes are slices of it
+        Js::JavascriptString* inputString;
         static const int MIN_CACHE_LENGTH = 50; // Use Json type cache only if the JSON string is larger than this constant.
+        static const uint MIN_SUBSTRING_LENGTH = 256; // Copy string values shorter than this instead of slicing the input.
+        static const uint MAX_SUBSTRING_INPUT_RATIO = 16; // Copy string values smaller than this fraction of the input as well.
     };
 } // namespace JSON
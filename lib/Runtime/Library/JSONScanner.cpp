@@ -9,14 +9,111 @@ using namespace Js;
 
 namespace JSON
 {
+#if defined(_M_X64)
+    // Lane-wise compares for a 16-byte block of code units of the given encoding
+    template <typename EncodedChar> struct JSONBlockLanes;
+
+    template <>
+    struct JSONBlockLanes<char16>
+    {
+        static __m128i Eq(__m128i block, char c) { return _mm_cmpeq_epi16(block, _mm_set1_epi16(c)); }
+        // There is no unsigned compare; the saturating subtract is zero exactly for code units <= c.
+        static __m128i AtMost(__m128i block, char c) { return IsZero(_mm_subs_epu16(block, _mm_set1_epi16(c))); }
+        static __m128i IsZero(__m128i block) { return _mm_cmpeq_epi16(block, _mm_setzero_si128()); }
+    };
+
+    template <>
+    struct JSONBlockLanes<utf8char_t>
+    {
+        static __m128i Eq(__m128i block, char c) { return _mm_cmpeq_epi8(block, _mm_set1_epi8(c)); }
+        static __m128i AtMost(__m128i block, char c) { return IsZero(_mm_subs_epu8(block, _mm_set1_epi8(c))); }
+        static __m128i IsZero(__m128i block) { return _mm_cmpeq_epi8(block, _mm_setzero_si128()); }
+    };
+#endif
+
+    // Structural pass of the scanner: finds the next character that needs per-character handling, so Scan and
+    // ScanString only step through quotes, escapes, control characters and token starts. On x64 the input is
+    // examined 16 bytes at a time.
+    class JSONBlockScanner
+    {
+    public:
+        // Anything but '"', '\\' and control characters; these are copied through unchanged
+        template <typename EncodedChar>
+        static const EncodedChar* SkipPlainStringChars(const EncodedChar* p, const EncodedChar* last) { return SkipWhileNot<PlainStringStop>(p, last); }
+        // Space, tab, CR and LF
+        template <typename EncodedChar>
+        static const EncodedChar* SkipWhiteSpace(const EncodedChar* p, const EncodedChar* last) { return SkipWhileNot<WhiteSpaceStop>(p, last); }
+
+    private:
+        template <typename TStop, typename EncodedChar>
+        static const EncodedChar* SkipWhileNot(const EncodedChar* p, const EncodedChar* last)
+        {
+#if defined(_M_X64)
+            const int unitsPerBlock = sizeof(__m128i) / sizeof(EncodedChar);
+            while (last - p >= unitsPerBlock)
+            {
+                __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i *>(p));
+                int stopMask = _mm_movemask_epi8(TStop::template Match<JSONBlockLanes<EncodedChar>>(block));
+                if (stopMask != 0)
+                {
+                    DWORD index;
+                    _BitScanForward(&index, (DWORD)stopMask);
+                    return p + index / sizeof(EncodedChar);
+                }
+                p += unitsPerBlock;
+            }
+#endif
+            while (p < last && !TStop::Match(*p))
+            {
+                p++;
+            }
+            return p;
+        }
+
+        struct PlainStringStop
+        {
+            static bool Match(char16 c) { return c == '"' || c == '\\' || c <= 0x1F; }
+#if defined(_M_X64)
+            template <typename Lanes>
+            static __m128i Match(__m128i block)
+            {
+                return _mm_or_si128(Lanes::AtMost(block, 0x1F), _mm_or_si128(Lanes::Eq(block, '"'), Lanes::Eq(block, '\\')));
+            }
+#endif
+        };
+
+        struct WhiteSpaceStop
+        {
+            static bool Match(char16 c) { return c != ' ' && c != '\t' && c != '\r' && c != '\n'; }
+#if defined(_M_X64)
+            template <typename Lanes>
+            static __m128i Match(__m128i block)
+            {
+                return Lanes::IsZero(_mm_or_si128(
+                    _mm_or_si128(Lanes::Eq(block, ' '), Lanes::Eq(block, '\t')),
+                    _mm_or_si128(Lanes::Eq(block, '\r'), Lanes::Eq(block, '\n'))));
+            }
+#endif
+        };
+    };
+
+    // Powers of ten that are exactly representable as doubles
+    static const double exactPowersOfTen[] =
+    {
+        1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+        1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+    };
+
     // -------- Scanner implementation ------------//
-    JSONScanner::JSONScanner()
+    template <typename EncodedChar>
+    JSONScanner<EncodedChar>::JSONScanner()
         : inputText(0), inputLen(0), pToken(0), stringBuffer(0), allocator(0), allocatorObject(0),
-        currentRangeCharacterPairList(0), stringBufferLength(0), currentIndex(0)
+        currentRangeCharacterPairList(0), stringBufferLength(0), currentIndex(0), isCurrentStringDirectInputTextMapped(false)
     {
     }
 
-    void JSONScanner::Finalizer()
+    template <typename EncodedChar>
+    void JSONScanner<EncodedChar>::Finalizer()
     {
         // All dynamic memory allocated by this object is on the arena - either the one this object owns or by the
         // one shared with JSON parser - here we will deallocate ours. The others will be deallocated when JSONParser
@@ -28,7 +125,8 @@ namespace JSON
         }
     }
 
-    void JSONScanner::Init(const char16* input, uint len, Token* pOutToken, Js::ScriptContext* sc, const char16* current, ArenaAllocator* allocator)
+    template <typename EncodedChar>
+    void JSONScanner<EncodedChar>::Init(const EncodedChar* input, uint len, Token* pOutToken, Js::ScriptContext* sc, const EncodedChar* current, ArenaAllocator* allocator)
     {
         // Note that allocator could be nullptr from JSONParser, if we could not reuse an allocator, keep our own
         inputText = input;
@@ -39,7 +137,52 @@ namespace JSON
         this->allocator = allocator;
     }
 
-    tokens JSONScanner::Scan()
+    template <typename EncodedChar>
+    uint JSONScanner<EncodedChar>::CopyInputUnits(char16* dest, const char16* src, uint count)
+    {
+        js_wmemcpy_s(dest, count, src, count);
+        return count;
+    }
+
+    template <typename EncodedChar>
+    uint JSONScanner<EncodedChar>::CopyInputUnits(char16* dest, const utf8char_t* src, uint count)
+    {
+        // Structural characters are ASCII and never part of a multi-unit sequence, so a range between them
+        // decodes on its own. Like JsPointerToStringUtf8, invalid sequences are kept rather than replaced.
+        LPCUTF8 p = src;
+        return (uint)utf8::DecodeUnitsInto(dest, p, src + count, utf8::doAllowInvalidWCHARs);
+    }
+
+    template <>
+    double JSONScanner<char16>::StrToDbl(const char16* str, const char16** end)
+    {
+        return Js::NumberUtilities::StrToDbl(str, end, scriptContext);
+    }
+
+    template <>
+    double JSONScanner<utf8char_t>::StrToDbl(const utf8char_t* str, const utf8char_t** end)
+    {
+        // UTF-8 input need not be null terminated and StrToDbl reads until a character cannot continue the
+        // number, so the characters that could be part of it are copied to a terminated buffer first.
+        const utf8char_t* p = str;
+        const utf8char_t* last = inputText + inputLen;
+        while (p < last && (Js::NumberUtilities::IsDigit(*p) || *p == '.' || *p == 'e' || *p == 'E' || *p == '+' || *p == '-'))
+        {
+            p++;
+        }
+        uint length = (uint)(p - str);
+        this->EnsureStringBuffer(length + 1);
+        CopyInputUnits(this->stringBuffer, str, length);
+        this->stringBuffer[length] = _u('\0');
+
+        const char16* numberEnd;
+        double value = Js::NumberUtilities::StrToDbl(this->stringBuffer, &numberEnd, scriptContext);
+        *end = str + (numberEnd - this->stringBuffer);
+        return value;
+    }
+
+    template <typename EncodedChar>
+    tokens JSONScanner<EncodedChar>::Scan()
     {
         pTokenString = currentChar;
 
@@ -56,7 +199,8 @@ namespace JSON
             case '\r':
             case '\n':
             case ' ':
-                //WS - keep looping
+                //WS - skip the rest of the run and keep looping
+                currentChar = JSONBlockScanner::SkipWhiteSpace(currentChar, inputText + inputLen);
                 break;
 
             case '"':
@@ -77,25 +221,28 @@ namespace JSON
                 {
                     currentChar--;
 
-                    // we use StrToDbl() here for compat with the rest of the engine. StrToDbl() accept a larger syntax.
-                    // Verify first the JSON grammar.
-                    const char16* saveCurrentChar = currentChar;
-                    if(!IsJSONNumber())
-                    {
-                       ThrowSyntaxError(JSERR_JsonBadNumber);
-                    }
-                    currentChar = saveCurrentChar;
                     double val;
-                    const char16* end;
-                    val = Js::NumberUtilities::StrToDbl(currentChar, &end, scriptContext);
-                    if(currentChar == end)
+                    if (!TryScanExactNumber(&val))
                     {
-                       ThrowSyntaxError(JSERR_JsonBadNumber);
+                        // we use StrToDbl() here for compat with the rest of the engine. StrToDbl() accept a larger syntax.
+                        // Verify first the JSON grammar.
+                        const EncodedChar* saveCurrentChar = currentChar;
+                        if(!IsJSONNumber())
+                        {
+                           ThrowSyntaxError(JSERR_JsonBadNumber);
+                        }
+                        currentChar = saveCurrentChar;
+                        const EncodedChar* end;
+                        val = StrToDbl(currentChar, &end);
+                        if(currentChar == end)
+                        {
+                           ThrowSyntaxError(JSERR_JsonBadNumber);
+                        }
+                        currentChar = end;
                     }
                     AssertMsg(!Js::JavascriptNumber::IsNan(val), "Bad result from string to double conversion");
                     pToken->tk = tkFltCon;
                     pToken->SetDouble(val, false);
-                    currentChar = end;
                     return tkFltCon;
                 }
 
@@ -156,7 +303,8 @@ namespace JSON
         return (pToken->tk = tkEOF);
     }
 
-    bool JSONScanner::IsJSONNumber()
+    template <typename EncodedChar>
+    bool JSONScanner<EncodedChar>::IsJSONNumber()
     {
         bool firstDigitIsAZero = false;
         if (PeekNextChar() == '0')
@@ -220,19 +368,132 @@ namespace JSON
         return true;
     }
 
-    tokens JSONScanner::ScanString()
+    // Fast path for the common number shapes: at most 19 significant digits, which fit in a uint64. With at most 15
+    // digits and a decimal exponent within +/-22, the digits are exact in a double and a single multiply or divide by
+    // an exact power of ten rounds correctly; other values go through NumberUtilities::TryDblFromDecimal. Either way
+    // the result matches StrToDbl. Anything else, including malformed numbers and the rare values TryDblFromDecimal
+    // can't decide, is left to the IsJSONNumber/StrToDbl path so errors and rounding do not change. currentChar only
+    // moves on success.
+    template <typename EncodedChar>
+    bool JSONScanner<EncodedChar>::TryScanExactNumber(double* value)
+    {
+        const int maxExactDigits = 15;
+        const int maxDigits = 19;
+        const EncodedChar* p = currentChar;
+        const EncodedChar* last = inputText + inputLen;
+        uint64 digits = 0;
+        int digitCount = 0;
+        int exponent = 0;
+
+        if (*p == '0')
+        {
+            p++;
+        }
+        else
+        {
+            for (; p < last && Js::NumberUtilities::IsDigit(*p); p++)
+            {
+                if (++digitCount > maxDigits)
+                {
+                    return false;
+                }
+                digits = digits * 10 + (*p - '0');
+            }
+        }
+
+        if (p < last && *p == '.')
+        {
+            p++;
+            if (p == last || !Js::NumberUtilities::IsDigit(*p))
+            {
+                return false;
+            }
+            for (; p < last && Js::NumberUtilities::IsDigit(*p); p++)
+            {
+                // Leading zeros of a fraction are not significant
+                if (digits != 0 || *p != '0')
+                {
+                    if (++digitCount > maxDigits)
+                    {
+                        return false;
+                    }
+                }
+                digits = digits * 10 + (*p - '0');
+                exponent--;
+            }
+        }
+
+        if (p < last && (*p == 'e' || *p == 'E'))
+        {
+            p++;
+            bool negativeExponent = false;
+            if (p < last && (*p == '+' || *p == '-'))
+            {
+                negativeExponent = (*p == '-');
+                p++;
+            }
+            if (p == last || !Js::NumberUtilities::IsDigit(*p))
+            {
+                return false;
+            }
+            int explicitExponent = 0;
+            for (; p < last && Js::NumberUtilities::IsDigit(*p); p++)
+            {
+                if (explicitExponent > 1000)
+                {
+                    return false;
+                }
+                explicitExponent = explicitExponent * 10 + (*p - '0');
+            }
+            exponent += negativeExponent ? -explicitExponent : explicitExponent;
+        }
+
+        if (p < last && Js::NumberUtilities::IsDigit(*p))
+        {
+            // "0" followed by more digits; let IsJSONNumber report it
+            return false;
+        }
+
+        double result = (double)digits;
+        if (digitCount > maxExactDigits || exponent < -22 || exponent > 22)
+        {
+            if (!Js::NumberUtilities::TryDblFromDecimal(digits, exponent, &result))
+            {
+                return false;
+            }
+        }
+        else if (digits != 0 && exponent != 0)
+        {
+            result = exponent > 0 ? result * exactPowersOfTen[exponent] : result / exactPowersOfTen[-exponent];
+        }
+
+        *value = result;
+        currentChar = p;
+        return true;
+    }
+
+    template <typename EncodedChar>
+    tokens JSONScanner<EncodedChar>::ScanString()
     {
         char16 ch;
 
         this->currentIndex = 0;
-        this->currentString = const_cast<char16*>(currentChar);
         bool endFound = false;
         bool isStringDirectInputTextMapped = true;
-        LPCWSTR bulkStart = currentChar;
+        const EncodedChar* bulkStart = currentChar;
         uint bulkLength = 0;
 
         while (currentChar < inputText + inputLen)
         {
+            // Characters that need no unescaping are only counted into the current bulk
+            const EncodedChar* plainEnd = JSONBlockScanner::SkipPlainStringChars(currentChar, inputText + inputLen);
+            bulkLength += (uint)(plainEnd - currentChar);
+            currentChar = plainEnd;
+            if (currentChar == inputText + inputLen)
+            {
+                break;
+            }
+
             ch = ReadNextChar();
             int tempHex;
 
@@ -370,6 +631,7 @@ namespace JSON
            ThrowSyntaxError(JSERR_JsonNoStrEnd);
         }
 
+        this->isCurrentStringDirectInputTextMapped = isStringDirectInputTextMapped && sizeof(EncodedChar) == sizeof(char16);
         if (isStringDirectInputTextMapped == false)
         {
             // If the last bulk is not ended with an escape character, make sure that is
@@ -392,8 +654,17 @@ namespace JSON
             this->GetCurrentRangeCharacterPairList()->Clear();
             this->currentString = this->stringBuffer;
         }
+        else if (sizeof(EncodedChar) != sizeof(char16))
+        {
+            // UTF-8 without escapes is still transcoded
+            this->EnsureStringBuffer(bulkLength);
+            this->currentIndex = CopyInputUnits(this->stringBuffer, bulkStart, bulkLength);
+            this->currentString = this->stringBuffer;
+        }
         else
         {
+            this->currentString = reinterpret_cast<char16*>(const_cast<EncodedChar*>(bulkStart));
+
             // make currentIndex the length (w/o the \0)
             currentIndex = bulkLength;
 
@@ -404,7 +675,8 @@ namespace JSON
         return (pToken->tk = tkStrCon);
     }
 
-    void JSONScanner::BuildUnescapedString(bool shouldSkipLastCharacter)
+    template <typename EncodedChar>
+    void JSONScanner<EncodedChar>::BuildUnescapedString(bool shouldSkipLastCharacter)
     {
         AssertMsg(this->allocator != nullptr, "We must have built the allocator");
         AssertMsg(this->currentRangeCharacterPairList != nullptr, "We must have built the currentRangeCharacterPairList");
@@ -412,17 +684,7 @@ namespace JSON
 
         // Step 1: Ensure the buffer has sufficient space
         int requiredSize = this->GetCurrentStringLen();
-        if (requiredSize > this->stringBufferLength)
-        {
-            if (this->stringBuffer)
-            {
-                AdeleteArray(this->allocator, this->stringBufferLength, this->stringBuffer);
-                this->stringBuffer = nullptr;
-            }
-
-            this->stringBuffer = AnewArray(this->allocator, char16, requiredSize);
-            this->stringBufferLength = requiredSize;
-        }
+        this->EnsureStringBuffer(requiredSize);
 
         // Step 2: Copy the data to the buffer
         int totalCopied = 0;
@@ -431,10 +693,9 @@ namespace JSON
         for (int i = 0; i <= lastCharacterIndex; i++)
         {
             RangeCharacterPair data = this->currentRangeCharacterPairList->Item(i);
-            int charactersToCopy = data.m_rangeLength;
-            js_wmemcpy_s(begin_copy, charactersToCopy, this->inputText + data.m_rangeStart, charactersToCopy);
-            begin_copy += charactersToCopy;
-            totalCopied += charactersToCopy;
+            int charactersCopied = CopyInputUnits(begin_copy, this->inputText + data.m_rangeStart, data.m_rangeLength);
+            begin_copy += charactersCopied;
+            totalCopied += charactersCopied;
 
             if (i == lastCharacterIndex && shouldSkipLastCharacter)
             {
@@ -446,7 +707,13 @@ namespace JSON
             totalCopied++;
         }
 
-        if (totalCopied != requiredSize)
+        if (sizeof(EncodedChar) != sizeof(char16))
+        {
+            // UTF-8 ranges may decode to fewer code units than they have bytes
+            Assert(totalCopied <= requiredSize);
+            this->currentIndex = totalCopied;
+        }
+        else if (totalCopied != requiredSize)
         {
             OUTPUT_TRACE_DEBUGONLY(Js::JSONPhase, _u("BuildUnescapedString(): allocated size = %d != copying size %d\n"), requiredSize, totalCopied);
             AssertMsg(totalCopied == requiredSize, "BuildUnescapedString(): The allocated size and copying size should match.");
@@ -455,19 +722,46 @@ namespace JSON
         OUTPUT_TRACE_DEBUGONLY(Js::JSONPhase, _u("BuildUnescapedString(): unescaped string as '%.*s'\n"), GetCurrentStringLen(), this->stringBuffer);
     }
 
-    JSONScanner::RangeCharacterPairList* JSONScanner::GetCurrentRangeCharacterPairList(void)
+    template <typename EncodedChar>
+    typename JSONScanner<EncodedChar>::RangeCharacterPairList* JSONScanner<EncodedChar>::GetCurrentRangeCharacterPairList(void)
     {
         if (this->currentRangeCharacterPairList == nullptr)
         {
-            if (this->allocator == nullptr)
-            {
-                this->allocatorObject = this->scriptContext->GetTemporaryGuestAllocator(_u("JSONScanner"));
-                this->allocator = this->allocatorObject->GetAllocator();
-            }
-
+            this->EnsureAllocator();
             this->currentRangeCharacterPairList = Anew(this->allocator, RangeCharacterPairList, this->allocator, 4);
         }
 
         return this->currentRangeCharacterPairList;
     }
+    template <typename EncodedChar>
+    void JSONScanner<EncodedChar>::EnsureAllocator()
+    {
+        if (this->allocator == nullptr)
+        {
+            this->allocatorObject = this->scriptContext->GetTemporaryGuestAllocator(_u("JSONScanner"));
+            this->allocator = this->allocatorObject->GetAllocator();
+        }
+    }
+
+    template <typename EncodedChar>
+    void JSONScanner<EncodedChar>::EnsureStringBuffer(int requiredSize)
+    {
+        // Keep a buffer even for empty strings so the current string is never null
+        requiredSize = max(requiredSize, 1);
+        if (requiredSize > this->stringBufferLength)
+        {
+            this->EnsureAllocator();
+            if (this->stringBuffer)
+            {
+                AdeleteArray(this->allocator, this->stringBufferLength, this->stringBuffer);
+                this->stringBuffer = nullptr;
+            }
+
+            this->stringBuffer = AnewArray(this->allocator, char16, requiredSize);
+            this->stringBufferLength = requiredSize;
+        }
+    }
+
+    template class JSONScanner<char16>;
+    template class JSONScanner<utf8char_t>;
 } // namespace JSON
@@ -6,22 +6,32 @@
 
 namespace JSON
 {
-    class JSONParser;
+    template <typename EncodedChar> class JSONParser;
 
     // Small scanner for exclusive JSON purpose. The general
     // JScript scanner is not appropriate here because of the JSON restricted lexical grammar
     // token enums and structures are shared although the token semantics is slightly different.
+    // EncodedChar is char16 for JSON.parse and utf8char_t for JsParseJsonUtf8. String tokens are always
+    // char16: UTF-8 input is transcoded one string at a time, never as a whole.
+    template <typename EncodedChar>
     class JSONScanner
     {
     public:
         JSONScanner();
         tokens Scan();
-        void Init(const char16* input, uint len, Token* pOutToken,
-            ::Js::ScriptContext* sc, const char16* current, ArenaAllocator* allocator);
+        void Init(const EncodedChar* input, uint len, Token* pOutToken,
+            ::Js::ScriptContext* sc, const EncodedChar* current, ArenaAllocator* allocator);
 
         void Finalizer();
         char16* GetCurrentString() { return currentString; } 
         uint GetCurrentStringLen() { return currentIndex; }
+        // True when the current string had no escapes and GetCurrentString() points into the input text; never for UTF-8
+        bool IsCurrentStringDirectInputTextMapped() { return isCurrentStringDirectInputTextMapped; }
+        uint GetCurrentStringOffset()
+        {
+            Assert(isCurrentStringDirectInputTextMapped);
+            return uint(reinterpret_cast<const EncodedChar*>(currentString) - inputText);
+        }
         uint GetScanPosition() { return uint(currentChar - inputText); }
 
         void __declspec(noreturn) ThrowSyntaxError(int wErr)
@@ -50,6 +60,10 @@ namespace JSON
         Js::TempGuestArenaAllocatorObject* allocatorObject;
         ArenaAllocator* allocator;
         void BuildUnescapedString(bool shouldSkipLastCharacter);
+        void EnsureAllocator();
+        void EnsureStringBuffer(int requiredSize);
+        static uint CopyInputUnits(char16* dest, const char16* src, uint count);
+        static uint CopyInputUnits(char16* dest, const utf8char_t* src, uint count);
 
         RangeCharacterPairList* GetCurrentRangeCharacterPairList(void);
 
@@ -65,20 +79,23 @@ namespace JSON
 
         tokens ScanString();
         bool IsJSONNumber();
+        bool TryScanExactNumber(double* value);
+        double StrToDbl(const EncodedChar* str, const EncodedChar** end);
 
-        const char16* inputText;
+        const EncodedChar* inputText;
         uint    inputLen;
-        const char16* currentChar;
-        const char16* pTokenString;
+        const EncodedChar* currentChar;
+        const EncodedChar* pTokenString;
 
         Token*   pToken;
         ::Js::ScriptContext* scriptContext;
 
         uint     currentIndex;
         char16* currentString;
+        bool     isCurrentStringDirectInputTextMapped;
         __field_ecount(stringBufferLength) char16* stringBuffer;
         int      stringBufferLength;
 
-        friend class JSONParser;
+        friend class JSONParser<EncodedChar>;
     };
 } // namespace JSON
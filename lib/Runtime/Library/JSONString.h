@@ -52,6 +52,12 @@ namespace Js
         static const WCHAR escapeMap[128];
         static const BYTE escapeMapCount[128];
     public:
+        // Returns the character that follows the backslash when wch has to be escaped, or '\0' if it does not
+        static WCHAR GetEscapeChar(char16 wch)
+        {
+            return wch < _countof(escapeMap) ? escapeMap[wch] : _u('\0');
+        }
+
         template <EscapingOperation op>
         static Js::JavascriptString* Escape(Js::JavascriptString* value, uint start = 0, WritableStringBuffer* outputString = nullptr)
         {
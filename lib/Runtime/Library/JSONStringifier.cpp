@@ -0,0 +1,868 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+#include "RuntimeLibraryPch.h"
+#include "Library/JSONStack.h"
+#include "Library/JSON.h"
+#include "Library/JSONStringifier.h"
+
+using namespace Js;
+
+namespace JSON
+{
+    // Calls append(chars, count) with the pieces of the escaped form of a string, without the quotes
+    template <typename Fn>
+    static void ForEachEscapedPiece(const char16* chars, charcount_t count, Fn append)
+    {
+        static const char16 hexDigits[] = _u("0123456789abcdef");
+
+        const char16* end = chars + count;
+        const char16* flushed = chars;
+        for (const char16* current = chars; current < end; current++)
+        {
+            WCHAR escapeChar = JSONString::GetEscapeChar(*current);
+            if (escapeChar == _u('\0'))
+            {
+                continue;
+            }
+
+            if (current != flushed)
+            {
+                append(flushed, (charcount_t)(current - flushed));
+            }
+            flushed = current + 1;
+
+            char16 escape[6] = { _u('\\'), escapeChar };
+            charcount_t escapeLength = 2;
+            if (escapeChar == _u('u'))
+            {
+                // Only control characters are escaped this way
+                escape[2] = _u('0');
+                escape[3] = _u('0');
+                escape[4] = hexDigits[(*current >> 4) & 0xF];
+                escape[5] = hexDigits[*current & 0xF];
+                escapeLength = 6;
+            }
+            append(escape, escapeLength);
+        }
+        if (end != flushed)
+        {
+            append(flushed, (charcount_t)(end - flushed));
+        }
+    }
+
+    JSONStringifier::JSONStringifier(ScriptContext* scriptContext, ArenaAllocator* alloc, StringifySession* session)
+        : scriptContext(scriptContext),
+          alloc(alloc),
+          session(session),
+          gap(session->GetGap() ? session->GetGap()->GetString() : nullptr),
+          gapLength(session->GetGap() ? session->GetGap()->GetLength() : 0),
+          indent(0),
+          typeInfos(alloc),
+          lastType(nullptr),
+          lastTypeInfo(nullptr),
+          sessionCallCount(0),
+          buffer(nullptr),
+          length(0),
+          capacity(0),
+          writeCallback(nullptr),
+          callbackState(nullptr),
+          utf8Buffer(nullptr),
+          stopped(false)
+    {
+    }
+
+    JavascriptString* JSONStringifier::TryStringify(Var value)
+    {
+        TypeId typeId = JavascriptOperators::GetTypeId(value);
+        if (typeId != TypeIds_Object && typeId != TypeIds_Array && typeId != TypeIds_NativeIntArray && typeId != TypeIds_NativeFloatArray)
+        {
+            // Primitives are cheap enough in the StringifySession
+            return nullptr;
+        }
+
+        TypeInfo* typeInfo;
+        if (!IsPlain(value, &typeInfo))
+        {
+            return nullptr;
+        }
+
+        Grow(InitialBufferLength);
+        if (!TryAppendValue(value, typeInfo))
+        {
+            return nullptr;
+        }
+
+        buffer[length] = _u('\0');
+        if (capacity - length > length / 4)
+        {
+            // Don't keep a mostly empty buffer alive with the result
+            return JavascriptString::NewCopyBuffer(buffer, length, scriptContext);
+        }
+        return JavascriptString::NewWithBuffer(buffer, length, scriptContext);
+    }
+
+    bool JSONStringifier::Stream(Var value, JSONWriteCallback writeCallback, void* callbackState)
+    {
+        this->writeCallback = writeCallback;
+        this->callbackState = callbackState;
+        buffer = AnewArray(alloc, char16, StreamBufferLength);
+        capacity = StreamBufferLength;
+        utf8Buffer = AnewArray(alloc, utf8char_t, StreamBufferLength * 3 + 1);
+
+        bool hasText = true;
+        TypeInfo* typeInfo;
+        if (JavascriptOperators::IsObject(value) && IsPlain(value, &typeInfo))
+        {
+            TryAppendValue(value, typeInfo);
+        }
+        else
+        {
+            Var serializableValue = session->GetSerializableValue(value);
+            SessionCompleted();
+            hasText = AppendWithSession(serializableValue, []() {});
+        }
+
+        Flush(true);
+        return hasText;
+    }
+
+    JSONStringifier::TypeInfo* JSONStringifier::GetTypeInfo(RecyclableObject* object)
+    {
+        // Only script can change a type, and the cache is cleared whenever the StringifySession may have run some
+        Type* type = object->GetType();
+        if (type != lastType)
+        {
+            TypeInfo* typeInfo;
+            if (!typeInfos.TryGetValue(type, &typeInfo))
+            {
+                typeInfo = CreateTypeInfo(object);
+                typeInfos.Add(type, typeInfo);
+            }
+            lastType = type;
+            lastTypeInfo = typeInfo;
+        }
+        return lastTypeInfo;
+    }
+
+    JSONStringifier::TypeInfo* JSONStringifier::CreateTypeInfo(RecyclableObject* object)
+    {
+        if (MayHaveToJSON(object))
+        {
+            return nullptr;
+        }
+
+        TypeInfo* typeInfo = Anew(alloc, TypeInfo);
+        typeInfo->propertyCount = 0;
+        typeInfo->propertyIds = nullptr;
+        typeInfo->prefixes = nullptr;
+        typeInfo->prefixEnds = nullptr;
+
+        if (JavascriptArray::Is(object))
+        {
+            // Only the elements of an array are written
+            return typeInfo;
+        }
+
+        DynamicTypeHandler* typeHandler = DynamicObject::FromVar(object)->GetDynamicType()->GetTypeHandler();
+        if (!typeHandler->IsPathTypeHandler())
+        {
+            // Other handlers can have accessors and non-enumerable properties
+            return nullptr;
+        }
+
+        int propertyCount = typeHandler->GetPropertyCount();
+        if (propertyCount == 0)
+        {
+            return typeInfo;
+        }
+
+        PropertyId* propertyIds = AnewArray(alloc, PropertyId, propertyCount);
+        charcount_t* prefixEnds = AnewArray(alloc, charcount_t, propertyCount);
+        charcount_t separatorLength = gap ? 2 : 1;
+        charcount_t prefixesLength = 0;
+        for (int i = 0; i < propertyCount; i++)
+        {
+            PropertyId propertyId = typeHandler->GetPropertyId(scriptContext, (PropertyIndex)i);
+            if (IsInternalPropertyId(propertyId))
+            {
+                return nullptr;
+            }
+            propertyIds[i] = propertyId;
+
+            PropertyRecord const * propertyRecord = scriptContext->GetPropertyName(propertyId);
+            if (!propertyRecord->IsSymbol())
+            {
+                prefixesLength = UInt32Math::Add(prefixesLength, 2 + separatorLength);
+                ForEachEscapedPiece(propertyRecord->GetBuffer(), propertyRecord->GetLength(), [&](const char16*, charcount_t count)
+                {
+                    prefixesLength = UInt32Math::Add(prefixesLength, count);
+                });
+            }
+            prefixEnds[i] = prefixesLength;
+        }
+
+        char16* prefixes = prefixesLength != 0 ? AnewArray(alloc, char16, prefixesLength) : nullptr;
+        char16* current = prefixes;
+        for (int i = 0; i < propertyCount; i++)
+        {
+            PropertyRecord const * propertyRecord = scriptContext->GetPropertyName(propertyIds[i]);
+            if (propertyRecord->IsSymbol())
+            {
+                continue;
+            }
+
+            *current++ = _u('"');
+            ForEachEscapedPiece(propertyRecord->GetBuffer(), propertyRecord->GetLength(), [&](const char16* chars, charcount_t count)
+            {
+                js_wmemcpy_s(current, prefixesLength - (charcount_t)(current - prefixes), chars, count);
+                current += count;
+            });
+            *current++ = _u('"');
+            *current++ = _u(':');
+            if (gap)
+            {
+                *current++ = _u(' ');
+            }
+        }
+        Assert(current == prefixes + prefixesLength);
+
+        typeInfo->propertyCount = propertyCount;
+        typeInfo->propertyIds = propertyIds;
+        typeInfo->prefixes = prefixes;
+        typeInfo->prefixEnds = prefixEnds;
+        return typeInfo;
+    }
+
+    bool JSONStringifier::MayHaveToJSON(RecyclableObject* object)
+    {
+        for (RecyclableObject* current = object; ; current = current->GetPrototype())
+        {
+            TypeId typeId = current->GetTypeId();
+            if (typeId == TypeIds_Null)
+            {
+                return false;
+            }
+
+            // Looking up a property on a proxy or a host object can run code
+            if (typeId < TypeIds_Function || typeId > TypeIds_LastBuiltinDynamicObject || current->IsExternal())
+            {
+                return true;
+            }
+
+            if (current->HasProperty(PropertyIds::toJSON))
+            {
+                return true;
+            }
+        }
+    }
+
+    bool JSONStringifier::IsPlain(Var value, TypeInfo** typeInfo)
+    {
+        *typeInfo = nullptr;
+        switch (JavascriptOperators::GetTypeId(value))
+        {
+        case TypeIds_Undefined:
+        case TypeIds_Symbol:
+        case TypeIds_Null:
+        case TypeIds_Boolean:
+        case TypeIds_Integer:
+        case TypeIds_Number:
+        case TypeIds_String:
+            return true;
+
+        case TypeIds_Object:
+            if (!VirtualTableInfo<DynamicObject>::HasVirtualTable(value) || DynamicObject::FromVar(value)->HasObjectArray())
+            {
+                // Indexed properties come first in enumeration order
+                return false;
+            }
+            break;
+
+        case TypeIds_Array:
+        case TypeIds_NativeIntArray:
+        case TypeIds_NativeFloatArray:
+            if (JavascriptArray::FromVar(value)->IsCrossSiteObject())
+            {
+                return false;
+            }
+            break;
+
+        default:
+            return false;
+        }
+
+        // Cycles are reported by the StringifySession
+        *typeInfo = GetTypeInfo(RecyclableObject::FromVar(value));
+        return *typeInfo != nullptr && !session->objectStack->Has(value);
+    }
+
+    bool JSONStringifier::TryAppendValue(Var value, TypeInfo* typeInfo)
+    {
+        JavascriptLibrary* library = scriptContext->GetLibrary();
+        switch (JavascriptOperators::GetTypeId(value))
+        {
+        case TypeIds_Undefined:
+        case TypeIds_Symbol:
+            // Only reached for array elements; object members with these values are skipped
+        case TypeIds_Null:
+            AppendString(library->GetNullDisplayString());
+            return true;
+
+        case TypeIds_Boolean:
+            AppendString(JavascriptBoolean::FromVar(value)->GetValue() ? library->GetTrueDisplayString() : library->GetFalseDisplayString());
+            return true;
+
+        case TypeIds_Integer:
+            AppendInt32(TaggedInt::ToInt32(value));
+            return true;
+
+        case TypeIds_Number:
+            AppendDouble(JavascriptNumber::GetValue(value));
+            return true;
+
+        case TypeIds_String:
+            {
+                JavascriptString* string = JavascriptString::FromVar(value);
+                AppendQuoted(string->GetString(), string->GetLength());
+                return true;
+            }
+
+        case TypeIds_Object:
+            return TryAppendObject(DynamicObject::FromVar(value), typeInfo);
+
+        default:
+            return TryAppendArray(JavascriptArray::FromVar(value));
+        }
+    }
+
+    bool JSONStringifier::TryAppendObject(DynamicObject* object, TypeInfo* typeInfo)
+    {
+        PROBE_STACK(scriptContext, Js::Constants::MinStackDefault);
+
+        session->objectStack->Push(object);
+        indent++;
+        AppendChar(_u('{'));
+        bool succeeded = TryAppendMembers(object, typeInfo);
+        indent--;
+        session->objectStack->Pop();
+        return succeeded;
+    }
+
+    bool JSONStringifier::TryAppendMembers(DynamicObject* object, TypeInfo* typeInfo)
+    {
+        Type* type = object->GetType();
+        bool isEmpty = true;
+        charcount_t prefixStart = 0;
+        for (int i = 0; i < typeInfo->propertyCount && !stopped; i++)
+        {
+            charcount_t prefixEnd = typeInfo->prefixEnds[i];
+            charcount_t prefixLength = prefixEnd - prefixStart;
+            const char16* prefix = typeInfo->prefixes + prefixStart;
+            prefixStart = prefixEnd;
+            if (prefixLength == 0)
+            {
+                continue;
+            }
+
+            // Once script has changed the object, the rest of the members are read like the session would
+            if (object->GetType() == type)
+            {
+                Var value = object->GetSlot(i);
+                TypeId typeId = JavascriptOperators::GetTypeId(value);
+                if (typeId == TypeIds_Undefined || typeId == TypeIds_Symbol)
+                {
+                    continue;
+                }
+
+                TypeInfo* valueTypeInfo;
+                if (IsPlain(value, &valueTypeInfo))
+                {
+                    AppendMemberStart(isEmpty, prefix, prefixLength);
+                    isEmpty = false;
+                    if (!TryAppendValue(value, valueTypeInfo))
+                    {
+                        return false;
+                    }
+                    continue;
+                }
+            }
+
+            Var value = GetWithSession(typeInfo->propertyIds[i], object);
+            if (AppendWithSession(value, [&]() { AppendMemberStart(isEmpty, prefix, prefixLength); }))
+            {
+                isEmpty = false;
+            }
+        }
+
+        if (!isEmpty && gap)
+        {
+            AppendNewLine(indent - 1);
+        }
+        AppendChar(_u('}'));
+        return !stopped;
+    }
+
+    bool JSONStringifier::TryAppendArray(JavascriptArray* array)
+    {
+        PROBE_STACK(scriptContext, Js::Constants::MinStackDefault);
+
+        session->objectStack->Push(array);
+        indent++;
+        AppendChar(_u('['));
+
+        uint32 arrayLength = array->GetLength();
+        bool succeeded;
+        switch (array->GetTypeId())
+        {
+        case TypeIds_NativeIntArray:
+            succeeded = TryAppendItems<int32>(array, arrayLength);
+            break;
+        case TypeIds_NativeFloatArray:
+            succeeded = TryAppendItems<double>(array, arrayLength);
+            break;
+        default:
+            succeeded = TryAppendItems<Var>(array, arrayLength);
+            break;
+        }
+
+        if (succeeded)
+        {
+            if (arrayLength != 0 && gap)
+            {
+                AppendNewLine(indent - 1);
+            }
+            AppendChar(_u(']'));
+        }
+
+        indent--;
+        session->objectStack->Pop();
+        return succeeded && !stopped;
+    }
+
+    template <typename T>
+    bool JSONStringifier::TryAppendItems(JavascriptArray* array, uint32 arrayLength)
+    {
+        uint32 startSessionCallCount = sessionCallCount;
+        SparseArraySegment<T>* head = (SparseArraySegment<T>*)array->GetHead();
+        uint32 headLength = head->left == 0 ? head->length : 0;
+
+        for (uint32 i = 0; i < arrayLength && !stopped; i++)
+        {
+            if (sessionCallCount != startSessionCallCount)
+            {
+                // Script run by the session may have changed the array, or even its kind
+                return TryAppendItemsWithSession(array, i, arrayLength);
+            }
+
+            T item;
+            bool hasItem;
+            if (i < headLength)
+            {
+                item = head->elements[i];
+                hasItem = !SparseArraySegment<T>::IsMissingItem(&item);
+            }
+            else
+            {
+                hasItem = !!array->DirectGetItemAt<T>(i, &item);
+            }
+
+            if (!hasItem)
+            {
+                // A hole is looked up on the prototype chain
+                return TryAppendItemsWithSession(array, i, arrayLength);
+            }
+
+            AppendItemStart(i);
+            if (!TryAppendItem(array, i, item))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    bool JSONStringifier::TryAppendItemsWithSession(JavascriptArray* array, uint32 start, uint32 arrayLength)
+    {
+        for (uint32 i = start; i < arrayLength && !stopped; i++)
+        {
+            AppendItemStart(i);
+            AppendItemWithSession(i, array);
+        }
+        return true;
+    }
+
+    bool JSONStringifier::TryAppendItem(JavascriptArray* array, uint32 index, Var item)
+    {
+        TypeInfo* typeInfo;
+        if (IsPlain(item, &typeInfo))
+        {
+            return TryAppendValue(item, typeInfo);
+        }
+
+        AppendItemWithSession(index, array);
+        return true;
+    }
+
+    Var JSONStringifier::GetWithSession(PropertyId propertyId, Var holder)
+    {
+        Var value = session->GetSerializableValue(scriptContext->GetPropertyString(propertyId), propertyId, holder);
+        SessionCompleted();
+        return value;
+    }
+
+    Var JSONStringifier::GetWithSession(JavascriptString* name, PropertyId propertyId, Var holder)
+    {
+        Var value = session->GetSerializableValue(name, propertyId, holder);
+        SessionCompleted();
+        return value;
+    }
+
+    Var JSONStringifier::GetWithSession(uint32 index, Var holder)
+    {
+        Var value = session->GetSerializableValue(index, holder);
+        SessionCompleted();
+        return value;
+    }
+
+    void JSONStringifier::AppendItemWithSession(uint32 index, Var array)
+    {
+        if (!AppendWithSession(GetWithSession(index, array), []() {}))
+        {
+            AppendString(scriptContext->GetLibrary()->GetNullDisplayString());
+        }
+    }
+
+    template <typename Fn>
+    bool JSONStringifier::AppendWithSession(Var value, Fn appendStart)
+    {
+        TypeId typeId = JavascriptOperators::GetTypeId(value);
+        if (typeId == TypeIds_Undefined || typeId == TypeIds_Symbol)
+        {
+            return false;
+        }
+
+        TypeInfo* typeInfo;
+        if (IsPlain(value, &typeInfo))
+        {
+            appendStart();
+            TryAppendValue(value, typeInfo);
+            return true;
+        }
+
+        // Only objects and arrays are written member by member, and only when streaming; the session's text of
+        // anything else is copied in
+        bool isJsNativeObject = !!JavascriptOperators::IsJsNativeObject(value);
+        if (!IsStreaming() || (isJsNativeObject ? JavascriptConversion::IsCallable(value) : !JavascriptOperators::IsObject(value)))
+        {
+            session->indent = indent;
+            Var text = session->StrValue(value);
+            SessionCompleted();
+            if (JavascriptOperators::IsUndefinedObject(text))
+            {
+                return false;
+            }
+            appendStart();
+            AppendString(JavascriptString::FromVar(text));
+            return true;
+        }
+
+        if (session->objectStack->Has(value, isJsNativeObject))
+        {
+            JavascriptError::ThrowTypeError(scriptContext, JSERR_JSONSerializeCircular);
+        }
+
+        appendStart();
+        session->objectStack->Push(value, isJsNativeObject);
+        indent++;
+        if (isJsNativeObject && JavascriptOperators::IsArray(value))
+        {
+            AppendArrayWithSession(value);
+        }
+        else
+        {
+            AppendObjectWithSession(RecyclableObject::FromVar(value));
+        }
+        indent--;
+        session->objectStack->Pop(isJsNativeObject);
+        return true;
+    }
+
+    void JSONStringifier::AppendObjectWithSession(RecyclableObject* object)
+    {
+        PROBE_STACK(scriptContext, Js::Constants::MinStackDefault);
+
+        // The members are the same ones StringifySession::StringifyObject would write without a replacer
+        AppendChar(_u('{'));
+        bool isEmpty = true;
+        auto appendMember = [&](JavascriptString* name, PropertyId propertyId)
+        {
+            Var value = GetWithSession(name, propertyId, object);
+            if (AppendWithSession(value, [&]() { AppendMemberStart(isEmpty, nullptr, 0); AppendMemberName(name); }))
+            {
+                isEmpty = false;
+            }
+        };
+
+        PropertyRecord const * propertyRecord;
+        if (JavascriptProxy::Is(object))
+        {
+            JavascriptProxy* proxy = JavascriptProxy::FromVar(object);
+            JavascriptArray* keys = proxy->PropertyKeysTrap(JavascriptProxy::KeysTrapKind::GetOwnPropertyNamesKind);
+            SessionCompleted();
+
+            uint32 keyCount = keys->GetLength();
+            for (uint32 i = 0; i < keyCount && !stopped; i++)
+            {
+                JavascriptString* name = JavascriptString::FromVar(keys->DirectGetItem(i));
+                JavascriptConversion::ToPropertyKey(name, scriptContext, &propertyRecord);
+
+                PropertyDescriptor propertyDescriptor;
+                BOOL hasDescriptor = JavascriptOperators::GetOwnPropertyDescriptor(proxy, propertyRecord->GetPropertyId(), scriptContext, &propertyDescriptor);
+                SessionCompleted();
+                if (hasDescriptor && propertyDescriptor.IsEnumerable())
+                {
+                    appendMember(name, propertyRecord->GetPropertyId());
+                }
+            }
+        }
+        else
+        {
+            Var enumeratorVar;
+            if (object->GetEnumerator(FALSE, &enumeratorVar, scriptContext, true, false))
+            {
+                JavascriptEnumerator* enumerator = static_cast<JavascriptEnumerator*>(enumeratorVar);
+                Var nameVar;
+                PropertyId propertyId;
+                while (!stopped && (nameVar = enumerator->GetCurrentAndMoveNext(propertyId)) != nullptr)
+                {
+                    if (JavascriptOperators::IsUndefinedObject(nameVar))
+                    {
+                        continue;
+                    }
+
+                    JavascriptString* name = JavascriptString::FromVar(nameVar);
+                    if (propertyId == Js::Constants::NoProperty)
+                    {
+                        scriptContext->GetOrAddPropertyRecord(name->GetString(), name->GetLength(), &propertyRecord);
+                        propertyId = propertyRecord->GetPropertyId();
+                    }
+                    appendMember(name, propertyId);
+                }
+            }
+        }
+
+        if (!isEmpty && gap)
+        {
+            AppendNewLine(indent - 1);
+        }
+        AppendChar(_u('}'));
+    }
+
+    void JSONStringifier::AppendArrayWithSession(Var array)
+    {
+        PROBE_STACK(scriptContext, Js::Constants::MinStackDefault);
+
+        uint32 arrayLength;
+        if (JavascriptArray::Is(array))
+        {
+            arrayLength = JavascriptArray::FromAnyArray(array)->GetLength();
+        }
+        else
+        {
+            // As in StringifySession::StringifyArray, the length of any kind of array fits in 32 bits
+            arrayLength = (uint32)JavascriptConversion::ToLength(JavascriptOperators::OP_GetLength(array, scriptContext), scriptContext);
+            SessionCompleted();
+        }
+
+        AppendChar(_u('['));
+        for (uint32 i = 0; i < arrayLength && !stopped; i++)
+        {
+            AppendItemStart(i);
+            AppendItemWithSession(i, array);
+        }
+        if (arrayLength != 0 && gap)
+        {
+            AppendNewLine(indent - 1);
+        }
+        AppendChar(_u(']'));
+    }
+
+    void JSONStringifier::SessionCompleted()
+    {
+        // The session may have run script, which can change any type or prototype
+        typeInfos.Clear();
+        lastType = nullptr;
+        lastTypeInfo = nullptr;
+        sessionCallCount++;
+    }
+
+    void JSONStringifier::AppendMemberStart(bool isFirst, const char16* prefix, charcount_t prefixLength)
+    {
+        if (!isFirst)
+        {
+            AppendChar(_u(','));
+        }
+        if (gap)
+        {
+            AppendNewLine(indent);
+        }
+        AppendChars(prefix, prefixLength);
+    }
+
+    void JSONStringifier::AppendMemberName(JavascriptString* name)
+    {
+        AppendQuoted(name->GetString(), name->GetLength());
+        AppendChar(_u(':'));
+        if (gap)
+        {
+            AppendChar(_u(' '));
+        }
+    }
+
+    void JSONStringifier::AppendItemStart(uint32 index)
+    {
+        if (index != 0)
+        {
+            AppendChar(_u(','));
+        }
+        if (gap)
+        {
+            AppendNewLine(indent);
+        }
+    }
+
+    void JSONStringifier::AppendChar(char16 c)
+    {
+        Reserve(1);
+        buffer[length++] = c;
+    }
+
+    void JSONStringifier::AppendChars(const char16* chars, charcount_t count)
+    {
+        // A stream buffer doesn't grow, so long runs go through it in parts
+        while (IsStreaming() && count > capacity - length)
+        {
+            charcount_t partLength = capacity - length;
+            js_wmemcpy_s(buffer + length, partLength, chars, partLength);
+            length = capacity;
+            chars += partLength;
+            count -= partLength;
+            Flush(false);
+        }
+
+        Reserve(count);
+        js_wmemcpy_s(buffer + length, capacity - length, chars, count);
+        length += count;
+    }
+
+    void JSONStringifier::AppendQuoted(const char16* chars, charcount_t count)
+    {
+        AppendChar(_u('"'));
+        ForEachEscapedPiece(chars, count, [&](const char16* piece, charcount_t pieceLength)
+        {
+            AppendChars(piece, pieceLength);
+        });
+        AppendChar(_u('"'));
+    }
+
+    void JSONStringifier::AppendInt32(int32 value)
+    {
+        char16 digits[12];
+        charcount_t count = 0;
+        uint32 magnitude = value < 0 ? 0u - (uint32)value : (uint32)value;
+        do
+        {
+            digits[_countof(digits) - ++count] = (char16)(_u('0') + magnitude % 10);
+            magnitude /= 10;
+        } while (magnitude != 0);
+        if (value < 0)
+        {
+            digits[_countof(digits) - ++count] = _u('-');
+        }
+        AppendChars(digits + _countof(digits) - count, count);
+    }
+
+    void JSONStringifier::AppendDouble(double value)
+    {
+        if (!NumberUtilities::IsFinite(value))
+        {
+            AppendString(scriptContext->GetLibrary()->GetNullDisplayString());
+            return;
+        }
+
+        int32 intValue;
+        if (JavascriptNumber::TryGetInt32Value<true>(value, &intValue))
+        {
+            AppendInt32(intValue);
+            return;
+        }
+
+        char16 digits[256];
+        if (!NumberUtilities::FNonZeroFiniteDblToStr(value, digits, _countof(digits)))
+        {
+            JavascriptError::ThrowOutOfMemoryError(scriptContext);
+        }
+        AppendChars(digits, (charcount_t)wcslen(digits));
+    }
+
+    void JSONStringifier::AppendNewLine(uint level)
+    {
+        AppendChar(_u('\n'));
+        for (uint i = 0; i < level; i++)
+        {
+            AppendChars(gap, gapLength);
+        }
+    }
+
+    void JSONStringifier::Grow(charcount_t count)
+    {
+        if (IsStreaming())
+        {
+            Flush(false);
+            Assert(capacity - length >= count);
+            return;
+        }
+
+        charcount_t requiredCapacity = UInt32Math::Add(length, count);
+        if (!IsValidCharCount(requiredCapacity))
+        {
+            Js::Throw::OutOfMemory();
+        }
+        charcount_t newCapacity = max(requiredCapacity, capacity <= MaxCharCount / 2 ? capacity * 2 : MaxCharCount);
+
+        // Leave room for the terminating null added in TryStringify
+        char16* newBuffer = RecyclerNewArrayLeaf(scriptContext->GetRecycler(), char16, newCapacity + 1);
+        if (length != 0)
+        {
+            js_wmemcpy_s(newBuffer, newCapacity, buffer, length);
+        }
+        buffer = newBuffer;
+        capacity = newCapacity;
+    }
+
+    void JSONStringifier::Flush(bool isFinal)
+    {
+        Assert(IsStreaming());
+
+        // Keep a high surrogate at the end for the next flush, so that the pair is encoded together
+        charcount_t flushLength = length;
+        if (!isFinal && flushLength != 0 && NumberUtilities::IsSurrogateUpperPart(buffer[flushLength - 1]))
+        {
+            flushLength--;
+        }
+
+        if (!stopped && flushLength != 0)
+        {
+            size_t byteCount = utf8::EncodeTrueUtf8IntoAndNullTerminate(utf8Buffer, buffer, flushLength);
+            stopped = !writeCallback(callbackState, utf8Buffer, byteCount);
+        }
+
+        length -= flushLength;
+        if (length != 0)
+        {
+            buffer[0] = buffer[flushLength];
+        }
+    }
+} // namespace JSON
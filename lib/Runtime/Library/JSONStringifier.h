@@ -0,0 +1,114 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+#pragma once
+
+namespace JSON
+{
+    class StringifySession;
+
+    // Fast path for JSON.stringify without a replacer. Objects with a PathTypeHandler and arrays are written straight
+    // into a single growable buffer by reading their slots and segments. A member the fast path can't write (toJSON,
+    // proxies, wrapper objects, holes, cycles) is stringified on its own by the StringifySession and copied in, so only
+    // a top-level value that isn't plain data makes TryStringify give up. Script run by the session can change
+    // anything, so all type information is dropped afterwards and the objects and arrays being written read their
+    // remaining members through the session too.
+    //
+    // Stream writes into a fixed size buffer that is flushed to a callback as UTF-8 instead. There the objects and
+    // arrays the fast path can't write are enumerated through the session member by member as well, so no subtree is
+    // ever built as one string; only the text of a primitive member comes from the session.
+    class JSONStringifier
+    {
+    public:
+        JSONStringifier(Js::ScriptContext* scriptContext, ArenaAllocator* alloc, StringifySession* session);
+
+        // Returns nullptr if the value is not an object or array with plain data
+        Js::JavascriptString* TryStringify(Js::Var value);
+
+        // Returns false if the value has no JSON text (undefined, a function or a symbol)
+        bool Stream(Js::Var value, JSONWriteCallback writeCallback, void* callbackState);
+
+    private:
+        // Per-type data. The prefix of a property is its quoted name followed by the property separator; the prefixes
+        // are stored back to back and prefixEnds[i] is the end of the i'th one. Symbols get an empty prefix.
+        struct TypeInfo
+        {
+            int propertyCount;
+            const Js::PropertyId* propertyIds;
+            const char16* prefixes;
+            const charcount_t* prefixEnds;
+        };
+        typedef JsUtil::BaseDictionary<Js::Type*, TypeInfo*, ArenaAllocator> TypeInfoMap;
+
+        static const charcount_t InitialBufferLength = 256;
+        static const charcount_t StreamBufferLength = 16 * 1024;
+
+        bool IsStreaming() const { return writeCallback != nullptr; }
+
+        TypeInfo* GetTypeInfo(Js::RecyclableObject* object);
+        TypeInfo* CreateTypeInfo(Js::RecyclableObject* object);
+        static bool MayHaveToJSON(Js::RecyclableObject* object);
+        bool IsPlain(Js::Var value, TypeInfo** typeInfo);
+
+        bool TryAppendValue(Js::Var value, TypeInfo* typeInfo);
+        bool TryAppendObject(Js::DynamicObject* object, TypeInfo* typeInfo);
+        bool TryAppendMembers(Js::DynamicObject* object, TypeInfo* typeInfo);
+        bool TryAppendArray(Js::JavascriptArray* array);
+        template <typename T> bool TryAppendItems(Js::JavascriptArray* array, uint32 arrayLength);
+        bool TryAppendItemsWithSession(Js::JavascriptArray* array, uint32 start, uint32 arrayLength);
+        bool TryAppendItem(Js::JavascriptArray* array, uint32 index, Js::Var item);
+        bool TryAppendItem(Js::JavascriptArray* array, uint32 index, int32 item) { AppendInt32(item); return true; }
+        bool TryAppendItem(Js::JavascriptArray* array, uint32 index, double item) { AppendDouble(item); return true; }
+
+        Js::Var GetWithSession(Js::PropertyId propertyId, Js::Var holder);
+        Js::Var GetWithSession(Js::JavascriptString* name, Js::PropertyId propertyId, Js::Var holder);
+        Js::Var GetWithSession(uint32 index, Js::Var holder);
+        void AppendItemWithSession(uint32 index, Js::Var array);
+        template <typename Fn> bool AppendWithSession(Js::Var value, Fn appendStart);
+        void AppendObjectWithSession(Js::RecyclableObject* object);
+        void AppendArrayWithSession(Js::Var array);
+        void SessionCompleted();
+
+        void AppendMemberStart(bool isFirst, const char16* prefix, charcount_t prefixLength);
+        void AppendMemberName(Js::JavascriptString* name);
+        void AppendItemStart(uint32 index);
+        void AppendChar(char16 c);
+        void AppendChars(const char16* chars, charcount_t count);
+        void AppendString(Js::JavascriptString* string) { AppendChars(string->GetString(), string->GetLength()); }
+        void AppendQuoted(const char16* chars, charcount_t count);
+        void AppendInt32(int32 value);
+        void AppendDouble(double value);
+        void AppendNewLine(uint level);
+        void Reserve(charcount_t count)
+        {
+            if (capacity - length < count)
+            {
+                Grow(count);
+            }
+        }
+        void Grow(charcount_t count);
+        void Flush(bool isFinal);
+
+        Js::ScriptContext* scriptContext;
+        ArenaAllocator* alloc;
+        StringifySession* session;
+        const char16* gap;
+        charcount_t gapLength;
+        uint indent;
+
+        TypeInfoMap typeInfos;
+        Js::Type* lastType;
+        TypeInfo* lastTypeInfo;
+        uint sessionCallCount;
+
+        char16* buffer;
+        charcount_t length;
+        charcount_t capacity;
+
+        JSONWriteCallback writeCallback;
+        void* callbackState;
+        utf8char_t* utf8Buffer;
+        bool stopped;
+    };
+} // namespace JSON
@@ -6,6 +6,7 @@
 #include "RuntimeLibraryPch.h"
 #include "Types/PathTypeHandler.h"
 #include "Types/SpreadArgument.h"
+#include "DataStructures/TimSort.h"
 
 namespace Js
 {
@@ -3976,26 +3977,25 @@ namespace Js
         // 2. If the search value is a number that can be represented as int32, then we inspect the elements, but we don't need to perform the full strict equality algorithm.
         // Instead we can use simple C++ equality (which in case of such values is equivalent to strict equality in JavaScript).
 
-        if (!HasNoMissingValues() || fromIndex >= GetHead()->length)
+        if (fromIndex >= GetHead()->length)
         {
             return -1;
         }
 
         bool isSearchTaggedInt = TaggedInt::Is(search);
-        if (!isSearchTaggedInt && !JavascriptNumber::Is_NoTaggedIntCheck(search))
-        {
-            // The value can't be in the array, but it could be in a prototype, and we can only guarantee that
-            // the head segment has no gaps.
-            fromIndex = toIndex > GetHead()->length ? GetHead()->length : -1;
-            return -1;
-        }
         int32 searchAsInt32;
         if (isSearchTaggedInt)
         {
             searchAsInt32 = TaggedInt::ToInt32(search);
         }
-        else if (!JavascriptNumber::TryGetInt32Value<true>(JavascriptNumber::GetValue(search), &searchAsInt32))
+        else if (!JavascriptNumber::Is_NoTaggedIntCheck(search) ||
+            !JavascriptNumber::TryGetInt32Value<true>(JavascriptNumber::GetValue(search), &searchAsInt32))
         {
+            if (!HasNoMissingValues())
+            {
+                return -1;
+            }
+
             // The value can't be in the array, but it could be in a prototype, and we can only guarantee that
             // the head segment has no gaps.
             fromIndex = toIndex > GetHead()->length ? GetHead()->length : -1;
@@ -4008,13 +4008,22 @@ namespace Js
 
         SparseArraySegment<int32> * head = static_cast<SparseArraySegment<int32>*>(GetHead());
         uint32 toIndexTrimmed = toIndex <= head->length ? toIndex : head->length;
-        for (uint32 i = fromIndex; i < toIndexTrimmed; i++)
+
+        // The missing value marks a hole, so it is never an element that can be found
+        uint32 index = searchAsInt32 == JavascriptNativeIntArray::MissingItem ?
+            ArrayKernels::NotFound :
+            ArrayKernels::IndexOf(head->elements, fromIndex, toIndexTrimmed, searchAsInt32);
+
+        // A hole before the match would have to be looked up in the prototype chain; leave that to the slow path.
+        if (!HasNoMissingValues() &&
+            ArrayKernels::IndexOf(head->elements, fromIndex, index == ArrayKernels::NotFound ? toIndexTrimmed : index, JavascriptNativeIntArray::MissingItem) != ArrayKernels::NotFound)
         {
-            int32 element = head->GetElement(i);
-            if (searchAsInt32 == element)
-            {
-                return i;
-            }
+            return -1;
+        }
+
+        if (index != ArrayKernels::NotFound)
+        {
+            return index;
         }
 
         // Element not found in the head segment. Keep looking only if the range of indices extends past
@@ -4032,7 +4041,7 @@ namespace Js
         // 2. If the search value is a number, then we inspect the elements, but we don't need to perform the full strict equality algorithm.
         // Instead we can use simple C++ equality (which in case of such values is equivalent to strict equality in JavaScript).
 
-        if (!HasNoMissingValues() || fromIndex >= GetHead()->length)
+        if (fromIndex >= GetHead()->length)
         {
             return -1;
         }
@@ -4040,6 +4049,11 @@ namespace Js
         bool isSearchTaggedInt = TaggedInt::Is(search);
         if (!isSearchTaggedInt && !JavascriptNumber::Is_NoTaggedIntCheck(search))
         {
+            if (!HasNoMissingValues())
+            {
+                return -1;
+            }
+
             // The value can't be in the array, but it could be in a prototype, and we can only guarantee that
             // the head segment has no gaps.
             fromIndex = toIndex > GetHead()->length ? GetHead()->length : -1;
@@ -4056,29 +4070,86 @@ namespace Js
         SparseArraySegment<double> * head = static_cast<SparseArraySegment<double>*>(GetHead());
         uint32 toIndexTrimmed = toIndex <= head->length ? toIndex : head->length;
 
+        //NaN != NaN we expect to match for NaN in Array.prototype.includes algorithm
         bool matchNaN = includesAlgorithm && JavascriptNumber::IsNan(searchAsDouble);
 
-        for (uint32 i = fromIndex; i < toIndexTrimmed; i++)
-        {
-            double element = head->GetElement(i);
-
-            if (element == searchAsDouble)
-            {
-                return i;
-            }
+        uint32 index = matchNaN ?
+            ArrayKernels::IndexOfNaN(head->elements, fromIndex, toIndexTrimmed) :
+            ArrayKernels::IndexOf(head->elements, fromIndex, toIndexTrimmed, searchAsDouble);
 
-            //NaN != NaN we expect to match for NaN in Array.prototype.includes algorithm
-            if (matchNaN && JavascriptNumber::IsNan(element))
-            {
-                return i;
-            }
+        // The missing value is a NaN, so a NaN match may itself be a hole. Either way a hole up to the match
+        // would have to be looked up in the prototype chain; leave that to the slow path.
+        if (!HasNoMissingValues() &&
+            ArrayKernels::IndexOf(reinterpret_cast<uint64*>(head->elements), fromIndex, index == ArrayKernels::NotFound ? toIndexTrimmed : index + 1, FloatMissingItemPattern) != ArrayKernels::NotFound)
+        {
+            return -1;
+        }
 
+        if (index != ArrayKernels::NotFound)
+        {
+            return index;
         }
 
         fromIndex = toIndex > GetHead()->length ? GetHead()->length : -1;
         return -1;
     }
 
+    bool JavascriptNativeIntArray::HeadSegmentLastIndexOfHelper(Var search, int64 fromIndex, int32 *index)
+    {
+        // With no holes from 0 to fromIndex every index of the range is an int32 element of the head segment, so
+        // the prototype chain never needs to be consulted, and anything but an int32 value can't be found.
+        if (!HasNoMissingValues() || fromIndex >= GetHead()->length)
+        {
+            return false;
+        }
+
+        int32 searchAsInt32;
+        if (TaggedInt::Is(search))
+        {
+            searchAsInt32 = TaggedInt::ToInt32(search);
+        }
+        else if (!JavascriptNumber::Is_NoTaggedIntCheck(search) ||
+            !JavascriptNumber::TryGetInt32Value<true>(JavascriptNumber::GetValue(search), &searchAsInt32))
+        {
+            *index = -1;
+            return true;
+        }
+
+        SparseArraySegment<int32> * head = static_cast<SparseArraySegment<int32>*>(GetHead());
+        uint32 found = ArrayKernels::LastIndexOf(head->elements, 0, static_cast<uint32>(fromIndex) + 1, searchAsInt32);
+        *index = found == ArrayKernels::NotFound ? -1 : found;
+        return true;
+    }
+
+    bool JavascriptNativeFloatArray::HeadSegmentLastIndexOfHelper(Var search, int64 fromIndex, int32 *index)
+    {
+        // As for int arrays, but every number can be an element. Strict equality never matches NaN.
+        if (!HasNoMissingValues() || fromIndex >= GetHead()->length)
+        {
+            return false;
+        }
+
+        double searchAsDouble;
+        if (TaggedInt::Is(search))
+        {
+            searchAsDouble = TaggedInt::ToDouble(search);
+        }
+        else if (JavascriptNumber::Is_NoTaggedIntCheck(search))
+        {
+            searchAsDouble = JavascriptNumber::GetValue(search);
+        }
+        else
+        {
+            *index = -1;
+            return true;
+        }
+
+        SparseArraySegment<double> * head = static_cast<SparseArraySegment<double>*>(GetHead());
+        uint32 found = ArrayKernels::LastIndexOf(head->elements, 0, static_cast<uint32>(fromIndex) + 1, searchAsDouble);
+        *index = found == ArrayKernels::NotFound ? -1 : found;
+        return true;
+    }
+
     Var JavascriptArray::EntryJoin(RecyclableObject* function, CallInfo callInfo, ...)
     {
         PROBE_STACK(function->GetScriptContext(), Js::Constants::MinStackDefault);
@@ -4424,6 +4495,12 @@ Case0:
 
         if (pArr)
         {
+            int32 index;
+            if (pArr->HeadSegmentLastIndexOfHelper(search, fromIndex, &index))
+            {
+                return JavascriptNumber::ToVar(index, scriptContext);
+            }
+
             switch (pArr->GetTypeId())
             {
             case Js::TypeIds_Array:
@@ -5225,7 +5302,12 @@ Case0:
         else if (typedArrayBase)
         {
             Assert(length <= JavascriptArray::MaxArrayLength);
-            if (typedArrayBase->GetLength() == length)
+            if (typedArrayBase->GetLength() == length && !typedArrayBase->IsDetachedBuffer())
+            {
+                // All the elements exist and are plain numbers, so the buffer can be reversed in place
+                typedArrayBase->ReverseElements();
+            }
+            else if (typedArrayBase->GetLength() == length)
             {
                 // If typedArrayBase->length == length then we know that the TypedArray will have all items < length
                 // and we won't have to check that the elements exist or not.
@@ -6096,41 +6178,101 @@ Case0:
         }
     }
 
-    static void hybridSort(__inout_ecount(length) Var *elements, uint32 length, CompareVarsInfo* compareInfo)
+    // Calls compareVars directly from the sort instead of through a qsort_s callback
+    struct CompareVarsComparer
     {
-        // The cost of memory moves starts to be more expensive than additional comparer calls (given a simple comparer)
-        // for arrays of more than 512 elements.
-        if (length > 512)
+        CompareVarsInfo* compareInfo;
+
+        int Compare(const Var& left, const Var& right)
         {
-            qsort_s(elements, length, sizeof(Var), compareVars, compareInfo);
-            return;
+            return compareVars(compareInfo, &left, &right);
         }
+    };
+
+    // Passes the elements of a native array to the compare function as numbers
+    template <typename T>
+    struct CompareNativeElementsComparer
+    {
+        CompareVarsInfo* compareInfo;
 
-        for (int i = 1; i < (int)length; i++)
+        static Var ToVar(int32 value, ScriptContext* scriptContext)
         {
-            if (compareVars(compareInfo, elements + i, elements + i - 1) < 0) {
-                // binary search for the left-most element greater than value:
-                int first = 0;
-                int last = i - 1;
-                while (first <= last)
-                {
-                    int middle = (first + last) / 2;
-                    if (compareVars(compareInfo, elements + i, elements + middle) < 0)
-                    {
-                        last = middle - 1;
-                    }
-                    else
-                    {
-                        first = middle + 1;
-                    }
-                }
+            return JavascriptNumber::ToVar(value, scriptContext);
+        }
+
+        static Var ToVar(double value, ScriptContext* scriptContext)
+        {
+            return JavascriptNumber::ToVarWithCheck(value, scriptContext);
+        }
+
+        int Compare(const T& left, const T& right)
+        {
+            Var leftVar = ToVar(left, compareInfo->scriptContext);
+            Var rightVar = ToVar(right, compareInfo->scriptContext);
+            return compareVars(compareInfo, &leftVar, &rightVar);
+        }
+    };
 
-                // insert value right before first:
-                Var value = elements[i];
-                memmove(elements + first + 1, elements + first, (i - first) * sizeof(Var));
-                elements[first] = value;
+    // Orders int32 values the way the default sort orders their decimal strings, without creating the strings
+    struct CompareInt32AsStringsComparer
+    {
+        static uint32 CountDigits(uint32 value)
+        {
+            uint32 count = 1;
+            while (value >= 10)
+            {
+                value /= 10;
+                count++;
             }
+            return count;
         }
+
+        int Compare(const int32& left, const int32& right)
+        {
+            if (left == right)
+            {
+                return 0;
+            }
+
+            // '-' sorts before all the digits, and two negative numbers compare like their magnitudes
+            if ((left < 0) != (right < 0))
+            {
+                return left < 0 ? -1 : 1;
+            }
+
+            uint32 leftMagnitude = left < 0 ? 0u - (uint32)left : (uint32)left;
+            uint32 rightMagnitude = right < 0 ? 0u - (uint32)right : (uint32)right;
+            uint32 leftDigits = CountDigits(leftMagnitude);
+            uint32 rightDigits = CountDigits(rightMagnitude);
+
+            // Pad the shorter number with zeros; if it then equals the longer one, it is a prefix of it and sorts first
+            uint64 leftPadded = leftMagnitude;
+            uint64 rightPadded = rightMagnitude;
+            for (uint32 i = leftDigits; i < rightDigits; i++)
+            {
+                leftPadded *= 10;
+            }
+            for (uint32 i = rightDigits; i < leftDigits; i++)
+            {
+                rightPadded *= 10;
+            }
+
+            if (leftPadded == rightPadded)
+            {
+                return leftDigits < rightDigits ? -1 : 1;
+            }
+            return leftPadded < rightPadded ? -1 : 1;
+        }
+    };
+
+    static void stableSort(__inout_ecount(length) Var *elements, uint32 length, CompareVarsInfo* compareInfo, Recycler* recycler)
+    {
+        // An element can be referenced only from the buffer while the compare function runs, so it has to be scanned
+        uint32 bufferLength = JsUtil::TimSort<Var, CompareVarsComparer>::GetBufferLength(length);
+        Var* buffer = bufferLength != 0 ? RecyclerNewArrayZ(recycler, Var, bufferLength) : nullptr;
+
+        CompareVarsComparer comparer = { compareInfo };
+        JsUtil::TimSort<Var, CompareVarsComparer>::Sort(elements, length, comparer, buffer);
     }
 
     void JavascriptArray::Sort(RecyclableObject* compFn)
@@ -6176,7 +6318,7 @@ Case0:
 #ifdef VALIDATE_ARRAY
                     ValidateSegment(startSeg);
 #endif
-                    hybridSort(startSeg->elements, startSeg->length, &cvInfo);
+                    stableSort(startSeg->elements, startSeg->length, &cvInfo, recycler);
                 }
                 else
                 {
@@ -6208,7 +6350,7 @@ Case0:
 
                 if (compFn != nullptr)
                 {
-                    hybridSort(allElements->elements, allElements->length, &cvInfo);
+                    stableSort(allElements->elements, allElements->length, &cvInfo, recycler);
                 }
                 else
                 {
@@ -6319,20 +6461,84 @@ Case0:
         return countUndefined;
     }
 
-    int __cdecl JavascriptArray::CompareElements(void* context, const void* elem1, const void* elem2)
+    void JavascriptArray::SortElements(Element* elements, uint32 left, uint32 right)
     {
-        const Element* element1 = static_cast<const Element*>(elem1);
-        const Element* element2 = static_cast<const Element*>(elem2);
+        struct CompareElementsComparer
+        {
+            int Compare(const Element& element1, const Element& element2)
+            {
+                return JavascriptString::strcmp(element1.StringValue, element2.StringValue);
+            }
+        };
 
-        Assert(element1 != NULL);
-        Assert(element2 != NULL);
+        uint32 length = right - left + 1;
+        uint32 bufferLength = JsUtil::TimSort<Element, CompareElementsComparer>::GetBufferLength(length);
+        Element* buffer = bufferLength != 0 ? RecyclerNewArrayZ(GetRecycler(), Element, bufferLength) : nullptr;
 
-        return JavascriptString::strcmp(element1->StringValue, element2->StringValue);
+        CompareElementsComparer comparer;
+        JsUtil::TimSort<Element, CompareElementsComparer>::Sort(elements + left, length, comparer, buffer);
     }
 
-    void JavascriptArray::SortElements(Element* elements, uint32 left, uint32 right)
+    bool JavascriptArray::TrySortNativeIntArrayAsStrings(JavascriptNativeIntArray* arr)
     {
-        qsort_s(elements, right - left + 1, sizeof(Element), CompareElements, this);
+        SparseArraySegment<int32>* seg = (SparseArraySegment<int32>*)arr->head;
+        if (seg->next != nullptr || seg->left != 0 || seg->length != arr->length || !arr->HasNoMissingValues())
+        {
+            return false;
+        }
+
+        // Converting an int32 to a string has no side effects, so the segment can be sorted in place
+        uint32 bufferLength = JsUtil::TimSort<int32, CompareInt32AsStringsComparer>::GetBufferLength(seg->length);
+        int32* buffer = bufferLength != 0 ? RecyclerNewArrayLeaf(arr->GetRecycler(), int32, bufferLength) : nullptr;
+
+        CompareInt32AsStringsComparer comparer;
+        JsUtil::TimSort<int32, CompareInt32AsStringsComparer>::Sort(seg->elements, seg->length, comparer, buffer);
+        return true;
+    }
+
+    template <typename TArray>
+    bool JavascriptArray::TrySortNativeArrayWithComparer(TArray* arr, RecyclableObject* compFn)
+    {
+        typedef typename TArray::TElement T;
+
+        SparseArraySegment<T>* seg = (SparseArraySegment<T>*)arr->head;
+        if (seg->next != nullptr || seg->left != 0 || seg->length != arr->length || !arr->HasNoMissingValues())
+        {
+            return false;
+        }
+
+        ScriptContext* scriptContext = arr->GetScriptContext();
+        Recycler* recycler = scriptContext->GetRecycler();
+        uint32 length = seg->length;
+
+        // Sort a copy of the elements, so the array keeps its contents and its type while the compare function runs
+        T* values = RecyclerNewArrayLeaf(recycler, T, length);
+        js_memcpy_s(values, length * sizeof(T), seg->elements, length * sizeof(T));
+
+        uint32 bufferLength = JsUtil::TimSort<T, CompareNativeElementsComparer<T>>::GetBufferLength(length);
+        T* buffer = bufferLength != 0 ? RecyclerNewArrayLeaf(recycler, T, bufferLength) : nullptr;
+
+        CompareVarsInfo cvInfo;
+        cvInfo.scriptContext = scriptContext;
+        cvInfo.compFn = compFn;
+        CompareNativeElementsComparer<T> comparer = { &cvInfo };
+        JsUtil::TimSort<T, CompareNativeElementsComparer<T>>::Sort(values, length, comparer, buffer);
+
+        if (TArray::Is(arr) && arr->head == seg && seg->next == nullptr && seg->length == length && arr->length == length)
+        {
+            js_memcpy_s(seg->elements, length * sizeof(T), values, length * sizeof(T));
+        }
+        else
+        {
+            // The compare function changed the array; store the sorted values into whatever it is now
+            ThrowTypeErrorOnFailureHelper h(scriptContext, _u("Array.prototype.sort"));
+            for (uint32 i = 0; i < length; i++)
+            {
+                Var value = CompareNativeElementsComparer<T>::ToVar(values[i], scriptContext);
+                h.ThrowTypeErrorOnFailure(JavascriptOperators::SetItem(arr, arr, i, value, scriptContext));
+            }
+        }
+        return true;
     }
 
     Var JavascriptArray::EntrySort(RecyclableObject* function, CallInfo callInfo, ...)
@@ -6386,6 +6592,24 @@ Case0:
                 arr->FillFromPrototypes(0, arr->length); // We need find all missing value from [[proto]] object
             }
 
+            // Native arrays held in a single segment are sorted without converting them to var arrays
+            if (JavascriptNativeIntArray::Is(arr))
+            {
+                JavascriptNativeIntArray* intArray = JavascriptNativeIntArray::FromVar(arr);
+                if (compFn ? TrySortNativeArrayWithComparer(intArray, compFn) : TrySortNativeIntArrayAsStrings(intArray))
+                {
+                    return args[0];
+                }
+            }
+#if defined(_M_X64_OR_ARM64)
+            // Doubles are boxed for every call to the compare function on 32-bit platforms
+            else if (compFn && JavascriptNativeFloatArray::Is(arr) &&
+                TrySortNativeArrayWithComparer(JavascriptNativeFloatArray::FromVar(arr), compFn))
+            {
+                return args[0];
+            }
+#endif
+
             // Maintain nativity of the array only for the following cases (To favor inplace conversions - keeps the conversion cost less):
             // -    int cases for X86 and
             // -    FloatArray for AMD64
@@ -8146,9 +8370,11 @@ Case0:
 
         if (pArr)
         {
+            CallbackElementReader reader(pArr);
+
             for (uint32 k = 0; k < length; k++)
             {
-                if (!pArr->DirectGetItemAtFull(k, &element))
+                if (!reader.GetItem(k, &element))
                 {
                     continue;
                 }
@@ -8157,6 +8383,7 @@ Case0:
                     element,
                     JavascriptNumber::ToVar(k, scriptContext),
                     pArr);
+                reader.Revalidate();
 
                 if (!JavascriptConversion::ToBoolean(testResult, scriptContext))
                 {
@@ -8317,9 +8544,11 @@ Case0:
 
         if (pArr)
         {
+            CallbackElementReader reader(pArr);
+
             for (uint32 k = 0; k < length; k++)
             {
-                if (!pArr->DirectGetItemAtFull(k, &element))
+                if (!reader.GetItem(k, &element))
                 {
                     continue;
                 }
@@ -8328,6 +8557,7 @@ Case0:
                     element,
                     JavascriptNumber::ToVar(k, scriptContext),
                     pArr);
+                reader.Revalidate();
 
                 if (JavascriptConversion::ToBoolean(testResult, scriptContext))
                 {
@@ -8485,7 +8715,21 @@ Case0:
         if (pArr)
         {
             Assert(pArr == dynamicObject);
-            pArr->ForEachItemInRange<true>(0, length.IsUint32Max() ? MaxArrayLength : length.GetSmallIndex(), scriptContext, fn32);
+
+            CallbackElementReader reader(pArr);
+            uint32 end = length.IsUint32Max() ? MaxArrayLength : length.GetSmallIndex();
+
+            for (uint32 k = 0; k < end; k++)
+            {
+                Var element;
+                if (!reader.GetItem(k, &element))
+                {
+                    continue;
+                }
+
+                fn32(k, element);
+                reader.Revalidate();
+            }
         }
         else
         {
@@ -8586,6 +8830,34 @@ Case0:
         // We shouldn't have made it here if the count was going to be zero
         Assert(count > 0);
 
+        // When both ranges are in a typed array's buffer or in a native array's head segment with no holes, every element
+        // exists and holds a plain value, so the elements can be moved all at once.
+        if (typedArrayBase)
+        {
+            if (!typedArrayBase->IsDetachedBuffer() && fromVal + count <= typedArrayBase->GetLength() && toVal + count <= typedArrayBase->GetLength())
+            {
+                typedArrayBase->CopyElements(static_cast<uint32>(toVal), static_cast<uint32>(fromVal), static_cast<uint32>(count));
+                return obj;
+            }
+        }
+        else if (pArr && JavascriptNativeArray::Is(pArr) && pArr->HasNoMissingValues() &&
+            fromVal + count <= pArr->GetHead()->length && toVal + count <= pArr->GetHead()->length)
+        {
+            Assert(pArr->GetHead()->left == 0);
+
+            if (JavascriptNativeIntArray::Is(pArr))
+            {
+                SparseArraySegment<int32>* head = static_cast<SparseArraySegment<int32>*>(pArr->GetHead());
+                memmove(head->elements + toVal, head->elements + fromVal, static_cast<size_t>(count) * sizeof(int32));
+            }
+            else
+            {
+                SparseArraySegment<double>* head = static_cast<SparseArraySegment<double>*>(pArr->GetHead());
+                memmove(head->elements + toVal, head->elements + fromVal, static_cast<size_t>(count) * sizeof(double));
+            }
+            return obj;
+        }
+
         int direction;
 
         if (fromVal < toVal && toVal < (fromVal + count))
@@ -8744,6 +9016,48 @@ Case0:
             }
         }
 
+        // When the whole range is already in a typed array's buffer or in a native array's head segment with no holes,
+        // store the first element the usual way and copy its converted value over the rest of the range.
+        if (k < finalVal)
+        {
+            if (typedArrayBase)
+            {
+                // Converting a number has no side effects, so it doesn't matter that it is converted only once
+                if (finalVal <= typedArrayBase->GetLength() && !typedArrayBase->IsDetachedBuffer() &&
+                    (TaggedInt::Is(fillValue) || JavascriptNumber::Is_NoTaggedIntCheck(fillValue)))
+                {
+                    typedArrayBase->DirectSetItem(static_cast<uint32>(k), fillValue);
+                    typedArrayBase->FillElements(static_cast<uint32>(k), static_cast<uint32>(finalVal));
+                    return obj;
+                }
+            }
+            else if (pArr && JavascriptNativeArray::Is(pArr) && pArr->HasNoMissingValues() && finalVal <= pArr->GetHead()->length)
+            {
+                Assert(pArr->GetHead()->left == 0);
+
+                // Storing a value that the array can't hold converts it, in which case the rest is left to the loop below
+                uint32 start = static_cast<uint32>(k);
+                pArr->SetItem(start, fillValue, PropertyOperation_ThrowIfNotExtensible);
+                k++;
+
+                if (pArr->HasNoMissingValues() && finalVal <= pArr->GetHead()->length)
+                {
+                    if (pArr->GetTypeId() == TypeIds_NativeIntArray)
+                    {
+                        SparseArraySegment<int32>* head = static_cast<SparseArraySegment<int32>*>(pArr->GetHead());
+                        ArrayKernels::Fill(head->elements, start + 1, static_cast<uint32>(finalVal), head->elements[start]);
+                        return obj;
+                    }
+                    if (pArr->GetTypeId() == TypeIds_NativeFloatArray)
+                    {
+                        SparseArraySegment<double>* head = static_cast<SparseArraySegment<double>*>(pArr->GetHead());
+                        ArrayKernels::Fill(head->elements, start + 1, static_cast<uint32>(finalVal), head->elements[start]);
+                        return obj;
+                    }
+                }
+            }
+        }
+
         if (k < MaxArrayLength)
         {
             int64 end = min<int64>(finalVal, MaxArrayLength);
@@ -8954,9 +9268,11 @@ Case0:
         {
             // If source is a JavascriptArray, newObj may or may not be an array based on what was in source's constructor property
 
+            CallbackElementReader reader(pArr);
+
             for (uint32 k = 0; k < length; k++)
             {
-                if (!pArr->DirectGetItemAtFull(k, &element))
+                if (!reader.GetItem(k, &element))
                 {
                     continue;
                 }
@@ -8975,6 +9291,9 @@ Case0:
                 {
                     JavascriptArray::SetArrayLikeObjects(RecyclableObject::FromVar(newObj), k, mappedValue);
                 }
+
+                // Both the callback and a species-created result may have changed the source
+                reader.Revalidate();
             }
         }
         else if (typedArrayBase != nullptr)
@@ -9162,9 +9481,11 @@ Case0:
             Assert(length <= MaxArrayLength);
             uint32 i = 0;
 
+            CallbackElementReader reader(pArr);
+
             for (uint32 k = 0; k < length; k++)
             {
-                if (!pArr->DirectGetItemAtFull(k, &element))
+                if (!reader.GetItem(k, &element))
                 {
                     continue;
                 }
@@ -9188,6 +9509,9 @@ Case0:
                     }
                     ++i;
                 }
+
+                // Both the callback and a species-created result may have changed the source
+                reader.Revalidate();
             }
         }
         else
@@ -9324,9 +9648,11 @@ Case0:
 
             if (pArr)
             {
+                CallbackElementReader reader(pArr);
+
                 for (; k < length && bPresent == false; k++)
                 {
-                    if (!pArr->DirectGetItemAtFull((uint32)k, &element))
+                    if (!reader.GetItem((uint32)k, &element))
                     {
                         continue;
                     }
@@ -9378,9 +9704,11 @@ Case0:
 
         if (pArr)
         {
+            CallbackElementReader reader(pArr);
+
             for (; k < length; k++)
             {
-                if (!pArr->DirectGetItemAtFull((uint32)k, &element))
+                if (!reader.GetItem((uint32)k, &element))
                 {
                     continue;
                 }
@@ -9390,6 +9718,7 @@ Case0:
                     element,
                     JavascriptNumber::ToVar(k, scriptContext),
                     pArr);
+                reader.Revalidate();
             }
         }
         else if (typedArrayBase)
@@ -10250,6 +10579,57 @@ Case0:
         return ((SparseArraySegment<T>*)seg)->elements[index];
     }
 
+    //
+    // CallbackElementReader to read array elements (including elements from prototypes) between callbacks.
+    //
+    JavascriptArray::CallbackElementReader::CallbackElementReader(JavascriptArray* arr)
+        : arr(arr), requestContext(arr->GetScriptContext())
+    {
+        Revalidate();
+    }
+
+    //
+    // Check again which elements can be read from the head segment, after anything that may have changed the array.
+    //
+    inline void JavascriptArray::CallbackElementReader::Revalidate()
+    {
+        // Exact type ids: ES5 arrays and copy-on-access arrays keep their elements elsewhere
+        typeId = arr->GetTypeId();
+        head = arr->head;
+        headLength = 0;
+        if ((typeId == TypeIds_Array || typeId == TypeIds_NativeIntArray || typeId == TypeIds_NativeFloatArray) &&
+            arr->HasNoMissingValues())
+        {
+            Assert(head->left == 0);
+            headLength = head->length;
+        }
+    }
+
+    //
+    // Get the element at index the way DirectGetItemAtFull does.
+    //
+    inline BOOL JavascriptArray::CallbackElementReader::GetItem(uint32 index, Var* outVal) const
+    {
+        if (index < headLength)
+        {
+            switch (typeId)
+            {
+            case TypeIds_NativeIntArray:
+                *outVal = JavascriptNumber::ToVar(((SparseArraySegment<int32>*)head)->elements[index], requestContext);
+                break;
+            case TypeIds_NativeFloatArray:
+                *outVal = JavascriptNativeFloatArray::ElementToVar(((SparseArraySegment<double>*)head)->elements[index], requestContext);
+                break;
+            default:
+                *outVal = ((SparseArraySegment<Var>*)head)->elements[index];
+                break;
+            }
+            return TRUE;
+        }
+
+        return arr->DirectGetItemAtFull(index, outVal);
+    }
+
     //
     // Construct a BigIndex initialized to a given uint32 (small index).
     //
@@ -11993,24 +12373,26 @@ Case0:
     BOOL JavascriptNativeFloatArray::DirectGetVarItemAt(uint32 index, Var *value, ScriptContext *requestContext)
     {
         double dvalue;
-        int32 ivalue;
         if (!this->DirectGetItemAt<double>(index, &dvalue))
         {
             return FALSE;
         }
-        if (*(uint64*)&dvalue == 0ull)
-        {
-            *value = TaggedInt::ToVarUnchecked(0);
-        }
-        else if (JavascriptNumber::TryGetInt32Value(dvalue, &ivalue) && !TaggedInt::IsOverflow(ivalue))
+        *value = JavascriptNativeFloatArray::ElementToVar(dvalue, requestContext);
+        return TRUE;
+    }
+
+    Var JavascriptNativeFloatArray::ElementToVar(double value, ScriptContext *scriptContext)
+    {
+        int32 ivalue;
+        if (*(uint64*)&value == 0ull)
         {
-            *value = TaggedInt::ToVarUnchecked(ivalue);
+            return TaggedInt::ToVarUnchecked(0);
         }
-        else
+        else if (JavascriptNumber::TryGetInt32Value(value, &ivalue) && !TaggedInt::IsOverflow(ivalue))
         {
-            *value = JavascriptNumber::ToVarWithCheck(dvalue, requestContext);
+            return TaggedInt::ToVarUnchecked(ivalue);
         }
-        return TRUE;
+        return JavascriptNumber::ToVarWithCheck(value, scriptContext);
     }
 
     BOOL JavascriptNativeFloatArray::GetItemReference(Var originalInstance, uint32 index, Var* value, ScriptContext* requestContext)
@@ -516,6 +516,8 @@ namespace Js
         static Var IndexOfHelper(Arguments const & args, ScriptContext *scriptContext);
 
         virtual int32 HeadSegmentIndexOfHelper(Var search, uint32 &fromIndex, uint32 toIndex, bool includesAlgorithm, ScriptContext * scriptContext);
+        // Answers lastIndexOf from the head segment when the searched range has no holes; returns false otherwise
+        virtual bool HeadSegmentLastIndexOfHelper(Var search, int64 fromIndex, int32 *index) { return false; }
 
 
         template<typename T>
@@ -554,8 +556,9 @@ namespace Js
             JavascriptString* StringValue;
         };
 
-        static int __cdecl CompareElements(void* context, const void* elem1, const void* elem2);
         void SortElements(Element* elements, uint32 left, uint32 right);
+        static bool TrySortNativeIntArrayAsStrings(JavascriptNativeIntArray* arr);
+        template <typename TArray> static bool TrySortNativeArrayWithComparer(TArray* arr, RecyclableObject* compFn);
 
         template <typename Fn>
         static void ForEachOwnArrayIndexOfObject(RecyclableObject* obj, uint32 startIndex, uint32 limitIndex, Fn fn);
@@ -669,6 +672,26 @@ namespace Js
             void Init(JavascriptArray* arr);
         };
 
+        // CallbackElementReader reads the elements of an array for the builtins that call back into script once per
+        // element (every, some, forEach, map, filter and reduce). While the head segment has no missing values, each
+        // index below its length is an own element and the prototype chain is never consulted, so those are read
+        // straight out of the head. Only the callback can change that: call Revalidate after each call.
+        class CallbackElementReader
+        {
+        private:
+            JavascriptArray* arr;
+            ScriptContext* requestContext;
+            TypeId typeId;
+            SparseArraySegmentBase* head;
+            uint32 headLength;  // 0 when the head can't be read directly
+
+        public:
+            CallbackElementReader(JavascriptArray* arr);
+
+            BOOL GetItem(uint32 index, Var* outVal) const;
+            void Revalidate();
+        };
+
         template <typename T>
         class IndexTrace
         {
@@ -971,6 +994,7 @@ namespace Js
         static JavascriptNativeIntArray * BoxStackInstance(JavascriptNativeIntArray * instance);
     private:
         virtual int32 HeadSegmentIndexOfHelper(Var search, uint32 &fromIndex, uint32 toIndex, bool includesAlgorithm, ScriptContext * scriptContext) override;
+        virtual bool HeadSegmentLastIndexOfHelper(Var search, int64 fromIndex, int32 *index) override;
 
 #if ENABLE_TTD
     public:
@@ -1063,6 +1087,7 @@ namespace Js
         virtual BOOL GetItem(Var originalInstance, uint32 index, Var* value, ScriptContext * requestContext) override;
         virtual BOOL GetItemReference(Var originalInstance, uint32 index, Var* value, ScriptContext * requestContext) override;
         virtual BOOL DirectGetVarItemAt(uint index, Var* outval, ScriptContext *scriptContext);
+        static Var ElementToVar(double value, ScriptContext *scriptContext);
         virtual BOOL DirectGetItemAtFull(uint index, Var* outVal);
         virtual Var DirectGetItem(uint32 index);
         virtual DescriptorFlags GetItemSetter(uint32 index, Var* setterValue, ScriptContext* requestContext) override
@@ -1108,6 +1133,7 @@ namespace Js
         static double Pop(ScriptContext * scriptContext, Var nativeFloatArray);
     private:
         virtual int32 HeadSegmentIndexOfHelper(Var search, uint32 &fromIndex, uint32 toIndex, bool includesAlgorithm, ScriptContext * scriptContext) override;
+        virtual bool HeadSegmentLastIndexOfHelper(Var search, int64 fromIndex, int32 *index) override;
 
 #if ENABLE_TTD
     public:
@@ -534,4 +534,16 @@ namespace Js
         }
     }
 
+    template<>
+    inline void SparseArraySegment<int32>::ReverseSegment(Recycler *recycler)
+    {
+        ArrayKernels::Reverse(elements, length);
+    }
+
+    template<>
+    inline void SparseArraySegment<double>::ReverseSegment(Recycler *recycler)
+    {
+        ArrayKernels::Reverse(elements, length);
+    }
+
 }
@@ -2259,6 +2259,16 @@ namespace Js
             return TaggedInt::ToVarUnchecked(-1);
         }
 
+        // Converting fromIndex could have detached the buffer; the generic path deals with that
+        if (!typedArrayBase->IsDetachedBuffer())
+        {
+            Var result = typedArrayBase->IndexOfValue(typedArrayBase->GetTypeId(), search, fromIndex, length, false, scriptContext);
+            if (result != nullptr)
+            {
+                return result;
+            }
+        }
+
         return JavascriptArray::TemplatedIndexOfHelper<false>(typedArrayBase, search, fromIndex, length, scriptContext);
     }
 
@@ -2292,6 +2302,16 @@ namespace Js
             return scriptContext->GetLibrary()->GetFalse();
         }
 
+        // Converting fromIndex could have detached the buffer; the generic path deals with that
+        if (!typedArrayBase->IsDetachedBuffer())
+        {
+            Var result = typedArrayBase->IndexOfValue(typedArrayBase->GetTypeId(), search, fromIndex, length, true, scriptContext);
+            if (result != nullptr)
+            {
+                return result;
+            }
+        }
+
         return JavascriptArray::TemplatedIndexOfHelper<true>(typedArrayBase, search, fromIndex, length, scriptContext);
     }
 
@@ -2428,6 +2448,17 @@ namespace Js
             return TaggedInt::ToVarUnchecked(-1);
         }
 
+        // Converting fromIndex could have detached the buffer; the generic path deals with that
+        if (!typedArrayBase->IsDetachedBuffer())
+        {
+            Assert(fromIndex < length);
+            Var result = typedArrayBase->LastIndexOfValue(typedArrayBase->GetTypeId(), search, static_cast<uint32>(fromIndex), scriptContext);
+            if (result != nullptr)
+            {
+                return result;
+            }
+        }
+
         return JavascriptArray::LastIndexOfHelper(typedArrayBase, search, fromIndex, scriptContext);
     }
 
@@ -2677,6 +2708,162 @@ namespace Js
         }
     }
 
+    // The default order of TypedArray.prototype.sort is the order of unsigned keys that are made from the bits of the
+    // elements: integers have their sign bit flipped, and floats are mapped so that -0 sorts before +0 and NaN last.
+    template <typename T, typename TKey, bool isSigned>
+    struct TypedArrayIntegerSortKey
+    {
+        typedef TKey Key;
+        static const TKey SignBit = (TKey)1 << (sizeof(TKey) * 8 - 1);
+
+        static TKey ToKey(T value)
+        {
+            return isSigned ? (TKey)value ^ SignBit : (TKey)value;
+        }
+
+        static T FromKey(TKey key)
+        {
+            return (T)(isSigned ? key ^ SignBit : key);
+        }
+    };
+
+    template <typename T, typename TKey>
+    struct TypedArrayFloatSortKey
+    {
+        typedef TKey Key;
+        static const TKey SignBit = (TKey)1 << (sizeof(TKey) * 8 - 1);
+        static const TKey NaNKey = (TKey)-1;
+
+        static TKey ToKey(T value)
+        {
+            if (NumberUtilities::IsNan(value))
+            {
+                return NaNKey;
+            }
+
+            TKey bits;
+            CompileAssert(sizeof(bits) == sizeof(value));
+            memcpy(&bits, &value, sizeof(bits));
+            return (bits & SignBit) ? ~bits : bits | SignBit;
+        }
+
+        static T FromKey(TKey key)
+        {
+            if (key == NaNKey)
+            {
+                return (T)NumberConstants::NaN;
+            }
+
+            TKey bits = (key & SignBit) ? key ^ SignBit : ~key;
+            T value;
+            memcpy(&value, &bits, sizeof(value));
+            return value;
+        }
+    };
+
+    template <typename T> struct TypedArraySortKey;
+    template <> struct TypedArraySortKey<int8> : TypedArrayIntegerSortKey<int8, uint8, true> {};
+    template <> struct TypedArraySortKey<uint8> : TypedArrayIntegerSortKey<uint8, uint8, false> {};
+    template <> struct TypedArraySortKey<int16> : TypedArrayIntegerSortKey<int16, uint16, true> {};
+    template <> struct TypedArraySortKey<uint16> : TypedArrayIntegerSortKey<uint16, uint16, false> {};
+    template <> struct TypedArraySortKey<int32> : TypedArrayIntegerSortKey<int32, uint32, true> {};
+    template <> struct TypedArraySortKey<uint32> : TypedArrayIntegerSortKey<uint32, uint32, false> {};
+    template <> struct TypedArraySortKey<int64> : TypedArrayIntegerSortKey<int64, uint64, true> {};
+    template <> struct TypedArraySortKey<uint64> : TypedArrayIntegerSortKey<uint64, uint64, false> {};
+    template <> struct TypedArraySortKey<bool> : TypedArrayIntegerSortKey<bool, uint8, false> {};
+    template <> struct TypedArraySortKey<char16> : TypedArrayIntegerSortKey<char16, uint16, false> {};
+    template <> struct TypedArraySortKey<float> : TypedArrayFloatSortKey<float, uint32> {};
+    template <> struct TypedArraySortKey<double> : TypedArrayFloatSortKey<double, uint64> {};
+
+    // Insertion sort is used below this length; the radix sort has a fixed cost for its buckets
+    static const uint32 TypedArrayMinRadixSortLength = 64;
+
+    template<typename T> void TypedArraySortElementsHelper(byte* buffer, uint32 length, Recycler* recycler)
+    {
+        typedef TypedArraySortKey<T> SortKey;
+        typedef typename SortKey::Key TKey;
+        const uint32 keyBits = sizeof(TKey) * 8;
+
+        T* elements = reinterpret_cast<T*>(buffer);
+
+        // Keys are sorted in arrays of their own: the buffer may be shared with another thread, and the bucket
+        // offsets must come from the same values that are scattered.
+        if (length < TypedArrayMinRadixSortLength)
+        {
+            TKey keys[TypedArrayMinRadixSortLength];
+            for (uint32 i = 0; i < length; i++)
+            {
+                TKey key = SortKey::ToKey(elements[i]);
+                uint32 j = i;
+                for (; j > 0 && keys[j - 1] > key; j--)
+                {
+                    keys[j] = keys[j - 1];
+                }
+                keys[j] = key;
+            }
+            for (uint32 i = 0; i < length; i++)
+            {
+                elements[i] = SortKey::FromKey(keys[i]);
+            }
+            return;
+        }
+
+        // LSD radix sort, 8 bits at a time for small keys and 11 bits at a time for 32 and 64 bit keys, which saves
+        // passes while the counts still fit in the cache. The counts for every digit are taken in a single pass, and a
+        // digit that is the same in all the keys (such as the high bits of small values) is skipped.
+        const uint32 digitBits = keyBits > 16 ? 11 : 8;
+        const uint32 digitCount = 1 << digitBits;
+        const TKey digitMask = (TKey)(digitCount - 1);
+        const uint32 passCount = (keyBits + digitBits - 1) / digitBits;
+
+        TKey* keys = RecyclerNewArrayLeaf(recycler, TKey, length);
+        TKey* sortedKeys = RecyclerNewArrayLeaf(recycler, TKey, length);
+        uint32* counts = RecyclerNewArrayLeafZ(recycler, uint32, passCount * digitCount);
+
+        for (uint32 i = 0; i < length; i++)
+        {
+            TKey key = SortKey::ToKey(elements[i]);
+            keys[i] = key;
+            for (uint32 pass = 0; pass < passCount; pass++)
+            {
+                counts[pass * digitCount + (uint32)((key >> (pass * digitBits)) & digitMask)]++;
+            }
+        }
+
+        for (uint32 pass = 0; pass < passCount; pass++)
+        {
+            uint32* offsets = counts + pass * digitCount;
+            const uint32 shift = pass * digitBits;
+            if (offsets[(uint32)((keys[0] >> shift) & digitMask)] == length)
+            {
+                continue;
+            }
+
+            uint32 offset = 0;
+            for (uint32 digit = 0; digit < digitCount; digit++)
+            {
+                uint32 count = offsets[digit];
+                offsets[digit] = offset;
+                offset += count;
+            }
+
+            for (uint32 i = 0; i < length; i++)
+            {
+                TKey key = keys[i];
+                sortedKeys[offsets[(uint32)((key >> shift) & digitMask)]++] = key;
+            }
+
+            TKey* temp = keys;
+            keys = sortedKeys;
+            sortedKeys = temp;
+        }
+
+        for (uint32 i = 0; i < length; i++)
+        {
+            elements[i] = SortKey::FromKey(keys[i]);
+        }
+    }
+
     Var TypedArrayBase::EntrySort(RecyclableObject* function, CallInfo callInfo, ...)
     {
         PROBE_STACK(function->GetScriptContext(), Js::Constants::MinStackDefault);
@@ -2720,6 +2907,13 @@ namespace Js
             compareFn = RecyclableObject::FromVar(args[1]);
         }
 
+        if (compareFn == nullptr)
+        {
+            // No script runs, so the elements can be sorted by their bits
+            typedArrayBase->GetSortElementsFunction()(typedArrayBase->GetByteBuffer(), length, scriptContext->GetRecycler());
+            return typedArrayBase;
+        }
+
         // Get the elements comparison function for the type of this TypedArray
         void* elementCompare = reinterpret_cast<void*>(typedArrayBase->GetCompareElementsFunction());
 
@@ -3049,6 +3243,249 @@ namespace Js
         return Js::JavascriptNumber::ToVarNoCheck(currentRes, scriptContext);
     }
 
+    // Converts a number to the element type when some element could be strictly equal to it
+    template<typename T>
+    static bool TryGetTypedArraySearchElement(double value, T *element)
+    {
+        // Integer elements are all exactly representable as int64; this also rejects NaN
+        if (!(value >= -9223372036854775808.0 && value < 9223372036854775808.0))
+        {
+            return false;
+        }
+
+        int64 i = static_cast<int64>(value);
+        if (static_cast<double>(i) != value || static_cast<int64>(static_cast<T>(i)) != i)
+        {
+            return false;
+        }
+
+        *element = static_cast<T>(i);
+        return true;
+    }
+
+    template<>
+    bool TryGetTypedArraySearchElement<float>(double value, float *element)
+    {
+        float f = static_cast<float>(value);
+        if (static_cast<double>(f) != value)
+        {
+            return false;
+        }
+
+        *element = f;
+        return true;
+    }
+
+    template<>
+    bool TryGetTypedArraySearchElement<double>(double value, double *element)
+    {
+        *element = value;
+        return true;
+    }
+
+    // Only floating point elements can be NaN
+    template<typename T>
+    static uint32 TypedArrayIndexOfNaN(const T* elements, uint32 start, uint32 end)
+    {
+        return ArrayKernels::NotFound;
+    }
+
+    template<>
+    uint32 TypedArrayIndexOfNaN<float>(const float* elements, uint32 start, uint32 end)
+    {
+        return ArrayKernels::IndexOfNaN(elements, start, end);
+    }
+
+    template<>
+    uint32 TypedArrayIndexOfNaN<double>(const double* elements, uint32 start, uint32 end)
+    {
+        return ArrayKernels::IndexOfNaN(elements, start, end);
+    }
+
+    Var TypedArrayBase::IndexOfValue(TypeId typeId, Var search, uint32 fromIndex, uint32 toIndex, bool includesAlgorithm, ScriptContext * scriptContext)
+    {
+        switch (typeId)
+        {
+        case TypeIds_Int8Array:
+            return this->IndexOfValue<int8>(search, fromIndex, toIndex, includesAlgorithm, scriptContext);
+
+        case TypeIds_Uint8Array:
+        case TypeIds_Uint8ClampedArray:
+            return this->IndexOfValue<uint8>(search, fromIndex, toIndex, includesAlgorithm, scriptContext);
+
+        case TypeIds_Int16Array:
+            return this->IndexOfValue<int16>(search, fromIndex, toIndex, includesAlgorithm, scriptContext);
+
+        case TypeIds_Uint16Array:
+            return this->IndexOfValue<uint16>(search, fromIndex, toIndex, includesAlgorithm, scriptContext);
+
+        case TypeIds_Int32Array:
+            return this->IndexOfValue<int32>(search, fromIndex, toIndex, includesAlgorithm, scriptContext);
+
+        case TypeIds_Uint32Array:
+            return this->IndexOfValue<uint32>(search, fromIndex, toIndex, includesAlgorithm, scriptContext);
+
+        case TypeIds_Float32Array:
+            return this->IndexOfValue<float>(search, fromIndex, toIndex, includesAlgorithm, scriptContext);
+
+        case TypeIds_Float64Array:
+            return this->IndexOfValue<double>(search, fromIndex, toIndex, includesAlgorithm, scriptContext);
+
+        default:
+            return nullptr;
+        }
+    }
+
+    template<typename T>
+    Var TypedArrayBase::IndexOfValue(Var search, uint32 fromIndex, uint32 toIndex, bool includesAlgorithm, ScriptContext * scriptContext)
+    {
+        Assert(!this->IsDetachedBuffer());
+
+        const T* typedBuffer = (const T*)this->buffer;
+        uint32 end = min(toIndex, this->GetLength());
+        uint32 index = ArrayKernels::NotFound;
+
+        // Every element is a number and there are no holes, so nothing else can be found
+        if (fromIndex < end && (TaggedInt::Is(search) || JavascriptNumber::Is_NoTaggedIntCheck(search)))
+        {
+            double value = TaggedInt::Is(search) ? TaggedInt::ToDouble(search) : JavascriptNumber::GetValue(search);
+            T element;
+            if (includesAlgorithm && JavascriptNumber::IsNan(value))
+            {
+                // SameValueZero finds NaN
+                index = TypedArrayIndexOfNaN(typedBuffer, fromIndex, end);
+            }
+            else if (TryGetTypedArraySearchElement(value, &element))
+            {
+                index = ArrayKernels::IndexOf(typedBuffer, fromIndex, end, element);
+            }
+        }
+
+        if (includesAlgorithm)
+        {
+            return scriptContext->GetLibrary()->CreateBoolean(index != ArrayKernels::NotFound);
+        }
+        return index == ArrayKernels::NotFound ? TaggedInt::ToVarUnchecked(-1) : JavascriptNumber::ToVar(index, scriptContext);
+    }
+
+    Var TypedArrayBase::LastIndexOfValue(TypeId typeId, Var search, uint32 fromIndex, ScriptContext * scriptContext)
+    {
+        switch (typeId)
+        {
+        case TypeIds_Int8Array:
+            return this->LastIndexOfValue<int8>(search, fromIndex, scriptContext);
+
+        case TypeIds_Uint8Array:
+        case TypeIds_Uint8ClampedArray:
+            return this->LastIndexOfValue<uint8>(search, fromIndex, scriptContext);
+
+        case TypeIds_Int16Array:
+            return this->LastIndexOfValue<int16>(search, fromIndex, scriptContext);
+
+        case TypeIds_Uint16Array:
+            return this->LastIndexOfValue<uint16>(search, fromIndex, scriptContext);
+
+        case TypeIds_Int32Array:
+            return this->LastIndexOfValue<int32>(search, fromIndex, scriptContext);
+
+        case TypeIds_Uint32Array:
+            return this->LastIndexOfValue<uint32>(search, fromIndex, scriptContext);
+
+        case TypeIds_Float32Array:
+            return this->LastIndexOfValue<float>(search, fromIndex, scriptContext);
+
+        case TypeIds_Float64Array:
+            return this->LastIndexOfValue<double>(search, fromIndex, scriptContext);
+
+        default:
+            return nullptr;
+        }
+    }
+
+    template<typename T>
+    Var TypedArrayBase::LastIndexOfValue(Var search, uint32 fromIndex, ScriptContext * scriptContext)
+    {
+        Assert(!this->IsDetachedBuffer());
+
+        const T* typedBuffer = (const T*)this->buffer;
+        uint32 end = fromIndex < this->GetLength() ? fromIndex + 1 : this->GetLength();
+        uint32 index = ArrayKernels::NotFound;
+
+        // Strict equality never finds NaN
+        if (TaggedInt::Is(search) || JavascriptNumber::Is_NoTaggedIntCheck(search))
+        {
+            double value = TaggedInt::Is(search) ? TaggedInt::ToDouble(search) : JavascriptNumber::GetValue(search);
+            T element;
+            if (TryGetTypedArraySearchElement(value, &element))
+            {
+                index = ArrayKernels::LastIndexOf(typedBuffer, 0, end, element);
+            }
+        }
+
+        return index == ArrayKernels::NotFound ? TaggedInt::ToVarUnchecked(-1) : JavascriptNumber::ToVar(index, scriptContext);
+    }
+
+    void TypedArrayBase::ReverseElements()
+    {
+        Assert(!this->IsDetachedBuffer());
+
+        switch (BYTES_PER_ELEMENT)
+        {
+        case 1:
+            ArrayKernels::Reverse((uint8*)this->buffer, this->GetLength());
+            break;
+        case 2:
+            ArrayKernels::Reverse((uint16*)this->buffer, this->GetLength());
+            break;
+        case 4:
+            ArrayKernels::Reverse((uint32*)this->buffer, this->GetLength());
+            break;
+        case 8:
+            ArrayKernels::Reverse((uint64*)this->buffer, this->GetLength());
+            break;
+        default:
+            AssertMsg(false, "Unexpected element size");
+        }
+    }
+
+    void TypedArrayBase::FillElements(uint32 start, uint32 end)
+    {
+        Assert(!this->IsDetachedBuffer());
+        Assert(start < end && end <= this->GetLength());
+
+        // The element at start already holds the converted value, so this only copies bits
+        switch (BYTES_PER_ELEMENT)
+        {
+        case 1:
+            ArrayKernels::Fill((uint8*)this->buffer, start + 1, end, ((uint8*)this->buffer)[start]);
+            break;
+        case 2:
+            ArrayKernels::Fill((uint16*)this->buffer, start + 1, end, ((uint16*)this->buffer)[start]);
+            break;
+        case 4:
+            ArrayKernels::Fill((uint32*)this->buffer, start + 1, end, ((uint32*)this->buffer)[start]);
+            break;
+        case 8:
+            ArrayKernels::Fill((uint64*)this->buffer, start + 1, end, ((uint64*)this->buffer)[start]);
+            break;
+        default:
+            AssertMsg(false, "Unexpected element size");
+        }
+    }
+
+    void TypedArrayBase::CopyElements(uint32 toIndex, uint32 fromIndex, uint32 count)
+    {
+        Assert(!this->IsDetachedBuffer());
+        Assert(toIndex <= this->GetLength() && count <= this->GetLength() - toIndex);
+        Assert(fromIndex <= this->GetLength() && count <= this->GetLength() - fromIndex);
+
+        const size_t toOffset = (size_t)toIndex * BYTES_PER_ELEMENT;
+        memmove_s(this->buffer + toOffset,
+                  this->GetByteLength() - toOffset,
+                  this->buffer + (size_t)fromIndex * BYTES_PER_ELEMENT,
+                  (size_t)count * BYTES_PER_ELEMENT);
+    }
+
     // static
     Var TypedArrayBase::ValidateTypedArray(Var aValue, ScriptContext *scriptContext)
     {
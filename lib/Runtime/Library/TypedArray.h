@@ -11,6 +11,7 @@ namespace Js
     typedef Var (*PFNCreateTypedArray)(Js::ArrayBuffer* arrayBuffer, uint32 offSet, uint32 mappedLength, Js::JavascriptLibrary* javascriptLibrary);
 
     template<typename T> int __cdecl TypedArrayCompareElementsHelper(void* context, const void* elem1, const void* elem2);
+    template<typename T> void TypedArraySortElementsHelper(byte* buffer, uint32 length, Recycler* recycler);
 
     class TypedArrayBase : public ArrayBufferParent
     {
@@ -168,6 +169,17 @@ namespace Js
         Var FindMinOrMax(Js::ScriptContext * scriptContext, TypeId typeId, bool findMax);
         template<typename T, bool checkNaNAndNegZero> Var FindMinOrMax(Js::ScriptContext * scriptContext, bool findMax);
 
+        // Search the buffer without boxing the elements. These return nullptr for element types they don't handle.
+        Var IndexOfValue(TypeId typeId, Var search, uint32 fromIndex, uint32 toIndex, bool includesAlgorithm, ScriptContext * scriptContext);
+        template<typename T> Var IndexOfValue(Var search, uint32 fromIndex, uint32 toIndex, bool includesAlgorithm, ScriptContext * scriptContext);
+        Var LastIndexOfValue(TypeId typeId, Var search, uint32 fromIndex, ScriptContext * scriptContext);
+        template<typename T> Var LastIndexOfValue(Var search, uint32 fromIndex, ScriptContext * scriptContext);
+
+        // Move whole elements of the buffer. The caller checks that the buffer isn't detached and the indices are in range.
+        void ReverseElements();
+        void FillElements(uint32 start, uint32 end); // Repeats the element at start over the rest of the range
+        void CopyElements(uint32 toIndex, uint32 fromIndex, uint32 count);
+
     protected:
         inline BOOL IsBuiltinProperty(PropertyId);
         static Var CreateNewInstanceFromIterator(RecyclableObject *iterator, ScriptContext *scriptContext, uint32 elementSize, PFNCreateTypedArray pfnCreateTypedArray);
@@ -178,6 +190,10 @@ namespace Js
         typedef int(__cdecl* CompareElementsFunction)(void*, const void*, const void*);
         virtual CompareElementsFunction GetCompareElementsFunction() = 0;
 
+        // Sorts the elements in the default numeric order, without a compare function
+        typedef void(*SortElementsFunction)(byte*, uint32, Recycler*);
+        virtual SortElementsFunction GetSortElementsFunction() = 0;
+
         virtual Var Subarray(uint32 begin, uint32 end) = 0;
         int32 BYTES_PER_ELEMENT;
         uint32 byteOffset;
@@ -427,6 +443,11 @@ namespace Js
         {
             return &TypedArrayCompareElementsHelper<TypeName>;
         }
+
+        SortElementsFunction GetSortElementsFunction()
+        {
+            return &TypedArraySortElementsHelper<TypeName>;
+        }
     };
 
     // in windows build environment, char16 is not an intrinsic type, and we cannot do the type
@@ -473,6 +494,11 @@ namespace Js
         {
             return &TypedArrayCompareElementsHelper<char16>;
         }
+
+        SortElementsFunction GetSortElementsFunction()
+        {
+            return &TypedArraySortElementsHelper<char16>;
+        }
     };
 
 #if defined(__clang__)
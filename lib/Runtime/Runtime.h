@@ -75,6 +75,7 @@ namespace Js
     struct InlineeCallInfo;
     struct InlineCache;
     struct PolymorphicInlineCache;
+    class MegamorphicInlineCache;
     struct Arguments;
     class StringDictionaryWrapper;
     struct ByteCodeDumper;
@@ -491,6 +492,7 @@ enum tagDEBUG_EVENT_INFO_TYPE
 #include "Library/PropertyString.h"
 
 #include "Library/JavascriptTypedNumber.h"
+#include "Library/ArrayKernels.h"
 #include "Library/SparseArraySegment.h"
 #include "Library/JavascriptError.h"
 #include "Library/JavascriptArray.h"
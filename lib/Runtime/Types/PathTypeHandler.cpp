@@ -1332,6 +1332,14 @@ namespace Js
 #endif
     }
 
+    bool PathTypeHandlerBase::GetMaxPathLengthFromRoot(uint16 * maxPathLength)
+    {
+        // Walks every type reachable from the root, so this also counts properties that instances sharing the root type
+        // received after their constructor returned.
+        *maxPathLength = 0;
+        return GetRootPathTypeHandler()->GetMaxPathLength(maxPathLength);
+    }
+
     void PathTypeHandlerBase::EnsureInlineSlotCapacityIsLocked()
     {
         EnsureInlineSlotCapacityIsLocked(true);
@@ -74,6 +74,7 @@ namespace Js
         virtual BOOL IsPathTypeHandler() const { return TRUE; }
 
         virtual void ShrinkSlotAndInlineSlotCapacity() override;
+        virtual bool GetMaxPathLengthFromRoot(uint16 * maxPathLength) override;
         virtual void LockInlineSlotCapacity() override { Assert(false); };
         virtual void EnsureInlineSlotCapacityIsLocked() override;
         virtual void VerifyInlineSlotCapacityIsLocked() override;
@@ -479,6 +479,7 @@ namespace Js
         virtual BOOL GetAttributesWithPropertyIndex(DynamicObject * instance, PropertyId propertyId, BigPropertyIndex index, PropertyAttributes * attributes) = 0;
 
         virtual void ShrinkSlotAndInlineSlotCapacity() { VerifyInlineSlotCapacityIsLocked(); };
+        virtual bool GetMaxPathLengthFromRoot(uint16 * maxPathLength) { return false; }
         virtual void LockInlineSlotCapacity() { VerifyInlineSlotCapacityIsLocked(); }
         virtual void EnsureInlineSlotCapacityIsLocked() { VerifyInlineSlotCapacityIsLocked(); }
         virtual void VerifyInlineSlotCapacityIsLocked() { Assert(GetIsInlineSlotCapacityLocked()); }
@@ -0,0 +1,172 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// every, some, forEach, map, filter and reduce read the elements of a dense array straight out of its head segment;
+// check that callbacks which change the array, its kind or its prototype still see what the spec says they see.
+
+var failed = false;
+
+function fail(message) {
+    WScript.Echo("FAILED: " + message);
+    failed = true;
+}
+
+function sameValue(a, b) {
+    return a === b ? (a !== 0 || 1 / a === 1 / b) : (a !== a && b !== b);
+}
+
+function checkSameElements(name, actual, expected) {
+    if (actual.length !== expected.length) {
+        fail(name + ": length " + actual.length + " != " + expected.length);
+        return;
+    }
+    for (var i = 0; i < expected.length; i++) {
+        if (!sameValue(actual[i], expected[i])) {
+            fail(name + ": index " + i + ": " + actual[i] + " != " + expected[i]);
+            return;
+        }
+    }
+}
+
+// Every builtin reports its visits as [index, element] pairs, in the order the callback saw them
+function visits(method, array, mutate) {
+    var seen = [];
+    var callback = function (element, index, object) {
+        if (object !== array) {
+            fail(method + ": wrong array argument");
+        }
+        seen.push(index, element);
+        mutate(array, index);
+        return method === "some" ? false : true;
+    };
+    if (method === "reduce") {
+        array.reduce(function (accumulator, element, index, object) {
+            if (accumulator !== seen.length) {
+                fail("reduce: wrong accumulator");
+            }
+            callback.call(undefined, element, index, object);
+            return seen.length;
+        }, 0);
+    } else {
+        array[method](callback);
+    }
+    return seen;
+}
+
+// The same visits with a loop of plain element reads
+function referenceVisits(method, array, mutate) {
+    var seen = [];
+    var length = array.length;
+    for (var k = 0; k < length; k++) {
+        if (k in array) {
+            seen.push(k, array[k]);
+            mutate(array, k);
+        }
+    }
+    return seen;
+}
+
+var methods = ["every", "some", "forEach", "map", "filter", "reduce"];
+
+var element = {};
+var kinds = {
+    int: function () { return [1, 2, 3, 4, 5, 6, 7, 8, 9, 10]; },
+    float: function () { return [1.5, 2.5, -0, 4.5, NaN, 6.5, 7.5, 8.5, 9.5, 10.5]; },
+    var: function () { return [1, "two", 3, element, 5, null, 7, undefined, 9, 10]; },
+    holes: function () { return [1, , 3, , 5, 6, , 8, 9, 10]; }
+};
+
+var mutations = {
+    none: function (array, index) { },
+    deleteAhead: function (array, index) { if (index === 2) { delete array[5]; } },
+    deleteLast: function (array, index) { if (index === 2) { delete array[9]; } },
+    shrink: function (array, index) { if (index === 3) { array.length = 6; } },
+    grow: function (array, index) { if (index === 1) { Array.prototype.push.call(array, 11, 12); } },
+    toFloat: function (array, index) { if (index === 2) { array[7] = 0.25; } },
+    toVar: function (array, index) { if (index === 4) { array[8] = "x"; } },
+    storeAhead: function (array, index) { array[index + 1] = -index; },
+    prototypeIndex: function (array, index) { if (index === 0) { delete array[5]; Array.prototype[5] = "proto"; } }
+};
+
+for (var kindName in kinds) {
+    for (var mutationName in mutations) {
+        methods.forEach(function (method) {
+            var what = method + " " + kindName + " " + mutationName;
+            var expected = referenceVisits(method, kinds[kindName](), mutations[mutationName]);
+            delete Array.prototype[5];
+            var actual = visits(method, kinds[kindName](), mutations[mutationName]);
+            delete Array.prototype[5];
+            checkSameElements(what, actual, expected);
+        });
+    }
+}
+
+// Holes are filled from the prototype chain, and elements added there during the iteration are seen
+var withHoles = [0, , 2, , 4];
+Array.prototype[1] = "one";
+Object.prototype[3] = "three";
+checkSameElements("map holes", withHoles.map(function (v) { return v; }), [0, "one", 2, "three", 4]);
+delete Array.prototype[1];
+delete Object.prototype[3];
+checkSameElements("filter holes", withHoles.filter(function () { Array.prototype[3] = "late"; return true; }), [0, 2, "late", 4]);
+delete Array.prototype[3];
+
+// Results, early exits and the this argument
+var thisArg = {};
+[1, 2.5, "x"].forEach(function () {
+    if (this !== thisArg) {
+        fail("forEach: wrong this argument");
+    }
+}, thisArg);
+[1, 2].map(function () {
+    "use strict";
+    if (this !== undefined) {
+        fail("map: wrong default this argument");
+    }
+});
+var ints = [3, 1, 4, 1, 5, 9, 2, 6];
+checkSameElements("map", ints.map(function (v, i) { return v * i; }), [0, 1, 8, 3, 20, 45, 12, 42]);
+checkSameElements("filter", ints.filter(function (v) { return v & 1; }), [3, 1, 1, 5, 9]);
+if (ints.reduce(function (a, v) { return a + v; }) !== 31 || ints.reduce(function (a, v) { return a + v; }, 100) !== 131) {
+    fail("reduce sum");
+}
+var calls = 0;
+if (!ints.some(function (v) { calls++; return v === 4; }) || calls !== 3) {
+    fail("some stops at the first match");
+}
+calls = 0;
+if (ints.every(function (v) { calls++; return v < 5; }) || calls !== 5) {
+    fail("every stops at the first failure");
+}
+var floats = [0.5, 1.5, -0, 2.5];
+checkSameElements("float elements", floats.map(function (v) { return v; }), [0.5, 1.5, -0, 2.5]);
+if (!Object.is(floats.reduce(function (a, v) { return v; }), 2.5) || floats.filter(function (v) { return Object.is(v, -0); }).length !== 1) {
+    fail("float reduce and filter");
+}
+
+// The callback sees the same values however the element is stored
+var big = [];
+for (var i = 0; i < 1000; i++) {
+    big.push(i % 7 === 0 ? i + 0.5 : i);
+}
+var total = 0;
+big.forEach(function (v) { total += v; });
+if (total !== 499500 + 143 * 0.5) {
+    fail("forEach total " + total);
+}
+
+// Exceptions from the callback propagate
+try {
+    [1, 2, 3].forEach(function (v) { if (v === 2) { throw new Error("stop"); } });
+    fail("forEach: expected an exception");
+} catch (e) {
+    if (e.message !== "stop") {
+        fail("forEach: unexpected exception " + e);
+    }
+}
+
+if (!failed) {
+    WScript.Echo("pass");
+}
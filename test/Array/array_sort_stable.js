@@ -0,0 +1,168 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+var failed = false;
+
+function fail(message) {
+    WScript.Echo("FAILED: " + message);
+    failed = true;
+}
+
+var seed = 1;
+function random(limit) {
+    seed = (seed * 1103515245 + 12345) % 2147483648;
+    return seed % limit;
+}
+
+var patterns = {
+    presorted: function (i, n) { return i; },
+    reversed: function (i, n) { return n - i; },
+    random: function (i, n) { return random(n); },
+    duplicates: function (i, n) { return random(5); },
+    sawtooth: function (i, n) { return i % 100; },
+    mostlySorted: function (i, n) { return i % 50 == 0 ? random(n) : i; }
+};
+
+var lengths = [0, 1, 2, 5, 31, 32, 33, 64, 100, 1000, 5000];
+
+// Reference stable insertion of each element after the equal ones already placed
+function referenceSort(items, compare) {
+    var result = [];
+    for (var i = 0; i < items.length; i++) {
+        var low = 0;
+        var high = result.length;
+        while (low < high) {
+            var middle = (low + high) >> 1;
+            if (compare(items[i], result[middle]) < 0) {
+                high = middle;
+            } else {
+                low = middle + 1;
+            }
+        }
+        result.splice(low, 0, items[i]);
+    }
+    return result;
+}
+
+function checkSameElements(name, actual, expected) {
+    if (actual.length !== expected.length) {
+        fail(name + ": length " + actual.length + " != " + expected.length);
+        return;
+    }
+    for (var i = 0; i < expected.length; i++) {
+        if (actual[i] !== expected[i]) {
+            fail(name + ": index " + i + ": " + actual[i] + " != " + expected[i]);
+            return;
+        }
+    }
+}
+
+// Objects with equal keys keep their original order
+for (var patternName in patterns) {
+    lengths.forEach(function (length) {
+        var items = [];
+        for (var i = 0; i < length; i++) {
+            items.push({ key: patterns[patternName](i, length), index: i });
+        }
+        var compare = function (a, b) { return a.key - b.key; };
+        var expected = referenceSort(items, compare);
+        checkSameElements("stable " + patternName + " " + length, items.slice().sort(compare), expected);
+    });
+}
+
+// The default order compares strings; native int and float arrays must agree with that
+for (var patternName in patterns) {
+    lengths.forEach(function (length) {
+        var ints = [];
+        var doubles = [];
+        for (var i = 0; i < length; i++) {
+            var value = patterns[patternName](i, length);
+            ints.push(i % 3 == 0 ? -value * 7 : value * 13);
+            doubles.push(value + 0.5);
+        }
+        ints.push(2147483647, -2147483648, 0, 10, 1, 100, -1, -10);
+
+        var stringOrder = function (a, b) { a = String(a); b = String(b); return a < b ? -1 : (a > b ? 1 : 0); };
+        checkSameElements("default int " + patternName + " " + length, ints.slice().sort(), referenceSort(ints, stringOrder));
+        checkSameElements("default double " + patternName + " " + length, doubles.slice().sort(), referenceSort(doubles, stringOrder));
+
+        var numericOrder = function (a, b) { return a - b; };
+        checkSameElements("compare int " + patternName + " " + length, ints.slice().sort(numericOrder), referenceSort(ints, numericOrder));
+        checkSameElements("compare double " + patternName + " " + length, doubles.slice().sort(numericOrder), referenceSort(doubles, numericOrder));
+    });
+}
+
+// Strings, undefined and holes
+var mixed = ["b", undefined, "a", , "c", undefined, "a"];
+var sortedMixed = mixed.sort();
+checkSameElements("mixed", sortedMixed, ["a", "a", "b", "c", undefined, undefined, undefined]);
+if (!(5 in sortedMixed) || 6 in sortedMixed) {
+    fail("holes should be moved after undefined");
+}
+
+// A compare function that throws leaves every element in the array
+function checkThrowingCompare(array, name) {
+    var original = array.slice().sort(function (a, b) { return a - b; });
+    var calls = 0;
+    try {
+        array.sort(function (a, b) {
+            if (++calls == 700) {
+                throw new Error("stop");
+            }
+            return a - b;
+        });
+        fail(name + ": expected an exception");
+    } catch (e) {
+        if (e.message !== "stop") {
+            fail(name + ": unexpected exception " + e);
+        }
+    }
+    checkSameElements(name, array.slice().sort(function (a, b) { return a - b; }), original);
+}
+
+var throwInts = [];
+var throwDoubles = [];
+var throwObjects = [];
+for (var i = 0; i < 1000; i++) {
+    throwInts.push(random(1000));
+    throwDoubles.push(random(1000) / 8);
+    throwObjects.push(new Number(random(1000)));
+}
+checkThrowingCompare(throwInts, "throw int");
+checkThrowingCompare(throwDoubles, "throw double");
+checkThrowingCompare(throwObjects, "throw object");
+
+// An inconsistent compare function still leaves a permutation of the elements
+var inconsistent = [];
+for (var i = 0; i < 2000; i++) {
+    inconsistent.push(i);
+}
+inconsistent.sort(function () { return random(3) - 1; });
+checkSameElements("inconsistent", inconsistent.slice().sort(function (a, b) { return a - b; }), inconsistent.map(function (v, i) { return i; }));
+
+// The compare function may change the array; the sorted elements are written back
+var changed = [5, 3, 9, 1, 7];
+changed.sort(function (a, b) {
+    changed[0] = "x";
+    return a - b;
+});
+checkSameElements("changed int", changed, [1, 3, 5, 7, 9]);
+
+var changedDouble = [5.5, 3.5, 9.5, 1.5, 7.5];
+changedDouble.sort(function (a, b) {
+    changedDouble.length = 2;
+    return a - b;
+});
+checkSameElements("changed double", changedDouble, [1.5, 3.5, 5.5, 7.5, 9.5]);
+
+// The native array stays usable as an int array after sorting with a compare function
+var native = [3, 1, 2];
+native.sort(function (a, b) { return b - a; });
+native.push(0);
+checkSameElements("native", native, [3, 2, 1, 0]);
+
+if (!failed) {
+    WScript.Echo("pass");
+}
@@ -0,0 +1,187 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// indexOf, lastIndexOf, includes, fill, copyWithin and reverse work on whole blocks of a native array's head
+// segment; check them against element by element versions, and check that holes still see the prototype.
+
+var failed = false;
+
+function fail(message) {
+    WScript.Echo("FAILED: " + message);
+    failed = true;
+}
+
+var seed = 1;
+function random(limit) {
+    seed = (seed * 1103515245 + 12345) % 2147483648;
+    return seed % limit;
+}
+
+function sameValue(a, b) {
+    return a === b ? (a !== 0 || 1 / a === 1 / b) : (a !== a && b !== b);
+}
+
+function referenceIndexOf(array, value, from) {
+    for (var i = from; i < array.length; i++) {
+        if (array[i] === value) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+function referenceLastIndexOf(array, value, from) {
+    for (var i = Math.min(from, array.length - 1); i >= 0; i--) {
+        if (array[i] === value) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+function referenceIncludes(array, value, from) {
+    for (var i = from; i < array.length; i++) {
+        if (array[i] === value || (array[i] !== array[i] && value !== value)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+function checkSameElements(name, actual, expected) {
+    if (actual.length !== expected.length) {
+        fail(name + ": length " + actual.length + " != " + expected.length);
+        return;
+    }
+    for (var i = 0; i < expected.length; i++) {
+        if (!sameValue(actual[i], expected[i])) {
+            fail(name + ": index " + i + ": " + actual[i] + " != " + expected[i]);
+            return;
+        }
+    }
+}
+
+// Copies element by element, so the result has the same kind of storage as the values
+function copyOf(array) {
+    var result = [];
+    for (var i = 0; i < array.length; i++) {
+        result[i] = array[i];
+    }
+    return result;
+}
+
+var kinds = [
+    { name: "int", values: [0, 1, -1, 5, 2147483647, -2147483648] },
+    { name: "float", values: [0, -0, 1.5, -2.5, NaN, Infinity, 5, 0.1] }
+];
+
+var searches = [0, -0, 1, -1, 5, 1.5, NaN, Infinity, 2147483647, -2147483646, 4294967295, "1", undefined, null];
+
+var lengths = [0, 1, 3, 4, 7, 8, 9, 17, 33, 100];
+
+kinds.forEach(function (kind) {
+    lengths.forEach(function (length) {
+        var array = [];
+        for (var i = 0; i < length; i++) {
+            array.push(kind.values[random(kind.values.length)]);
+        }
+        if (kind.name === "float" && length > 0) {
+            array[0] = 0.5;
+        }
+        var plain = copyOf(array);
+        var what = kind.name + " " + length;
+
+        searches.forEach(function (search) {
+            [0, 1, length >> 1, length - 1].forEach(function (from) {
+                if (from < 0) {
+                    return;
+                }
+                if (array.indexOf(search, from) !== referenceIndexOf(plain, search, from)) {
+                    fail("indexOf " + what + " " + String(search) + " from " + from);
+                }
+                if (array.lastIndexOf(search, from) !== referenceLastIndexOf(plain, search, from)) {
+                    fail("lastIndexOf " + what + " " + String(search) + " from " + from);
+                }
+                if (array.includes(search, from) !== referenceIncludes(plain, search, from)) {
+                    fail("includes " + what + " " + String(search) + " from " + from);
+                }
+            });
+        });
+
+        var reversed = copyOf(array).reverse();
+        checkSameElements("reverse " + what, array.reverse(), reversed);
+
+        for (var trial = 0; trial < 4; trial++) {
+            var target = random(length + 1);
+            var start = random(length + 1);
+            var end = random(length + 1);
+            var copied = copyOf(array);
+            var source = copied.slice(start, Math.max(start, Math.min(end, start + length - target)));
+            for (var i = 0; i < source.length; i++) {
+                copied[target + i] = source[i];
+            }
+            checkSameElements("copyWithin " + what + " " + [target, start, end], array.copyWithin(target, start, end), copied);
+
+            var value = kind.values[random(kind.values.length)];
+            var filled = copyOf(array);
+            for (var i = start; i < end; i++) {
+                filled[i] = value;
+            }
+            checkSameElements("fill " + what + " " + [value, start, end], array.fill(value, start, end), filled);
+        }
+    });
+});
+
+// Values the array can't hold convert it part way through fill
+var toFloat = [1, 2, 3, 4, 5, 6, 7, 8, 9, 10];
+toFloat.fill(1.5, 2, 8);
+checkSameElements("fill converts to float", toFloat, [1, 2, 1.5, 1.5, 1.5, 1.5, 1.5, 1.5, 9, 10]);
+var toNegativeZero = [1, 2, 3, 4, 5, 6, 7, 8, 9, 10];
+toNegativeZero.fill(-0, 1);
+checkSameElements("fill converts to float for -0", toNegativeZero, [1, -0, -0, -0, -0, -0, -0, -0, -0, -0]);
+var toVar = [1.5, 2.5, 3.5, 4.5, 5.5, 6.5, 7.5, 8.5];
+toVar.fill("x", 3, 6);
+checkSameElements("fill converts to var", toVar, [1.5, 2.5, 3.5, "x", "x", "x", 7.5, 8.5]);
+var missingValue = [1, 2, 3, 4, 5, 6, 7, 8];
+missingValue.fill(-2147483646, 0, 5);
+checkSameElements("fill with the int missing value", missingValue, [-2147483646, -2147483646, -2147483646, -2147483646, -2147483646, 6, 7, 8]);
+
+// Holes are looked up on the prototype, and are never found by searching for the value that marks them
+var intHoles = [1, 2, 3, , 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 4];
+var floatHoles = [1.5, 2.5, 3.5, , 5.5, 6.5, 7.5, 8.5, NaN, 10.5, 11.5, 12.5, 13.5, 14.5, 15.5, 16.5, 4.5];
+if (intHoles.indexOf(4) !== 16 || intHoles.lastIndexOf(4) !== 16 || intHoles.indexOf(-2147483646) !== -1 || intHoles.lastIndexOf(-2147483646) !== -1) {
+    fail("int holes");
+}
+if (!intHoles.includes(undefined) || intHoles.indexOf(undefined) !== -1 || intHoles.indexOf(16) !== 15) {
+    fail("int holes undefined");
+}
+if (floatHoles.indexOf(4.5) !== 16 || floatHoles.lastIndexOf(4.5) !== 16 || floatHoles.indexOf(NaN) !== -1 || !floatHoles.includes(undefined)) {
+    fail("float holes");
+}
+if (!floatHoles.includes(NaN) || floatHoles.includes(NaN, 9)) {
+    fail("float holes NaN");
+}
+Array.prototype[3] = 4;
+if (intHoles.indexOf(4) !== 3 || intHoles.lastIndexOf(4) !== 16 || !intHoles.includes(4, 2) || intHoles.includes(4, 4) !== true) {
+    fail("int holes with prototype");
+}
+Array.prototype[3] = NaN;
+if (!floatHoles.includes(NaN, 2) || floatHoles.includes(NaN, 9) || floatHoles.indexOf(NaN) !== -1) {
+    fail("float holes with prototype NaN");
+}
+Array.prototype[3] = 4.5;
+if (floatHoles.indexOf(4.5) !== 3 || floatHoles.lastIndexOf(4.5, 10) !== 3) {
+    fail("float holes with prototype");
+}
+delete Array.prototype[3];
+
+var reversedHoles = intHoles.slice().reverse();
+if (reversedHoles[0] !== 4 || 13 in reversedHoles || reversedHoles[16] !== 1) {
+    fail("reverse with holes");
+}
+
+if (!failed) {
+    WScript.Echo("pass");
+}
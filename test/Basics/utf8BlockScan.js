@@ -0,0 +1,122 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// Source loaded with WScript.LoadScript is parsed as UTF-8, where runs of ASCII in identifiers, white space,
+// comments and string literals are skipped 16 bytes at a time. Put multi-byte characters and the characters
+// those runs stop at on every offset around the block edges, and check the values and function source text
+// that come out. Run with -off:Utf8BlockScan as well, to cover the byte at a time loop on its own.
+
+var failed = false;
+
+function check(actual, expected, message) {
+    if (actual !== expected) {
+        WScript.Echo("FAILED: " + message + ": expected " + JSON.stringify(expected) + ", got " + JSON.stringify(actual));
+        failed = true;
+    }
+}
+
+// 2, 3 and 4 bytes in UTF-8; the 4 byte one is a surrogate pair
+var multiByte = ["\u00e9", "\u4e2d", "\ud83d\ude00"];
+var identifierMultiByte = ["\u00e9", "\u4e2d"];
+var whiteSpaceMultiByte = ["\u00a0", "\u3000", "\ufeff"];
+
+// Lengths of the runs before and after each character: both sides of one and two block edges
+var pads = [];
+for (var i = 0; i <= 35; i++) {
+    pads.push(i);
+}
+var tails = [0, 1, 14, 15, 16, 17];
+
+var id = 0;
+
+function run(source) {
+    WScript.LoadScript(source);
+}
+
+function testIdentifier(pad, tail, ch) {
+    var name = "a".repeat(pad) + ch + "b".repeat(tail);
+    run("var " + name + " = " + pad + "; result = " + name + " + 1;");
+    check(this[name], pad, "identifier value, pad " + pad + ", tail " + tail);
+    check(result, pad + 1, "identifier reference, pad " + pad + ", tail " + tail);
+
+    // ASCII only, ending on a block edge
+    var ascii = "c".repeat(pad) + "$_9".slice(0, tail % 4);
+    run("var " + ascii + "x = " + tail + ";");
+    check(this[ascii + "x"], tail, "ascii identifier, pad " + pad + ", tail " + tail);
+}
+
+function testWhiteSpace(pad, tail, ch) {
+    run("result =" + " ".repeat(pad) + "\t" + ch + " \t".repeat(tail) + pad + ";");
+    check(result, pad, "white space, pad " + pad + ", tail " + tail);
+}
+
+function testLineComment(pad, tail, ch) {
+    run("result = 0; //" + "x".repeat(pad) + ch + "y".repeat(tail) + "\nresult = " + pad + ";");
+    check(result, pad, "line comment, pad " + pad + ", tail " + tail);
+
+    // Line and paragraph separators end a line comment even though they are multi-byte
+    run("result = 0; //" + "x".repeat(pad) + "\u2028result = " + pad + ";");
+    check(result, pad, "line comment ended by LS, pad " + pad);
+    run("result = 0; //" + "x".repeat(pad) + "\u2029result = " + pad + ";");
+    check(result, pad, "line comment ended by PS, pad " + pad);
+    run("result = 0; //" + "x".repeat(pad) + "\rresult = " + tail + ";");
+    check(result, tail, "line comment ended by CR, pad " + pad);
+}
+
+function testDelimitedComment(pad, tail, ch) {
+    run("result = /*" + "x".repeat(pad) + ch + "*".repeat(tail % 3) + " y".repeat(tail) + "**/ " + pad + ";");
+    check(result, pad, "delimited comment, pad " + pad + ", tail " + tail);
+
+    // A line break in the comment makes it a line terminator, so no semicolon is needed
+    run("result = " + tail + "/*" + "x".repeat(pad) + "\n" + ch + "*/result = " + pad);
+    check(result, pad, "delimited comment with a line break, pad " + pad + ", tail " + tail);
+}
+
+function testString(pad, tail, ch) {
+    var value = "q".repeat(pad) + ch + "r".repeat(tail);
+    run("result = '" + value + "';");
+    check(result, value, "single quoted string, pad " + pad + ", tail " + tail);
+    run("result = \"" + value + "\";");
+    check(result, value, "double quoted string, pad " + pad + ", tail " + tail);
+
+    // The characters a plain run stops at, on and around the block edges
+    run("result = '" + "q".repeat(pad) + "\\n\"$`" + ch + "\\u00e9" + "r".repeat(tail) + "\\\\';");
+    check(result, "q".repeat(pad) + "\n\"$`" + ch + "\u00e9" + "r".repeat(tail) + "\\", "string with escapes, pad " + pad + ", tail " + tail);
+    run("result = \"" + "q".repeat(pad) + "'\\\r\n" + "r".repeat(tail) + "\";");
+    check(result, "q".repeat(pad) + "'" + "r".repeat(tail), "string with a line continuation, pad " + pad + ", tail " + tail);
+}
+
+// The function's source text is found from character offsets, so it is only right if every multi-byte
+// character skipped before and inside the function was counted
+function testFunctionText(pad, tail, ch) {
+    var name = "f" + (id++);
+    var text = "function " + name + "() { /*" + "x".repeat(pad) + ch + "*/ return '" + ch + "y".repeat(tail) + "'; // " + ch + "\n}";
+    run("//" + ch.repeat(tail) + "\nvar s" + name + " = '" + ch.repeat(pad) + "';\n" + " ".repeat(pad) + text);
+    check(this[name].toString(), text, "function text, pad " + pad + ", tail " + tail);
+    check(this[name](), ch + "y".repeat(tail), "function result, pad " + pad + ", tail " + tail);
+}
+
+for (var p = 0; p < pads.length; p++) {
+    for (var t = 0; t < tails.length; t++) {
+        var pad = pads[p];
+        var tail = tails[t];
+        for (var c = 0; c < identifierMultiByte.length; c++) {
+            testIdentifier(pad, tail, identifierMultiByte[c]);
+        }
+        for (var c = 0; c < whiteSpaceMultiByte.length; c++) {
+            testWhiteSpace(pad, tail, whiteSpaceMultiByte[c]);
+        }
+        for (var c = 0; c < multiByte.length; c++) {
+            testLineComment(pad, tail, multiByte[c]);
+            testDelimitedComment(pad, tail, multiByte[c]);
+            testString(pad, tail, multiByte[c]);
+            testFunctionText(pad, tail, multiByte[c]);
+        }
+    }
+}
+
+if (!failed) {
+    WScript.Echo("pass");
+}
@@ -0,0 +1,48 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// Loading the same source again may skip the deferred function bodies found by the first parse.
+// The functions must still parse, bind and run the same way, and the enclosing locals they capture must
+// still be captured.
+
+var source = [
+    "function outer(a) {",
+    "    /* { unbalanced braces in a comment } } */",
+    "    var s = '}{' + \"{\" + `${a}}`;",
+    "    function inner(b) { return function () { return a + b; }; }",
+    "    return inner(s.length)();",
+    "}",
+    "function strict() { 'use strict'; try { undeclared = 1; } catch (e) { return e instanceof ReferenceError; } return false; }",
+    "function callsEval(x) { return eval('x * 2'); }",
+    "var expr = function (n) { var f = (m) => { return m > 1 ? m * f(m - 1) : 1; }; return f(n); };",
+    "function \\u0066oo() { return 'foo'; }",
+    // Locals of an immediately invoked function that only its deferred inner functions refer to
+    "var counter = (function () { var count = 0; return function (n) { count += n; return count; }; })();",
+    "var greet = (function (name) { var unused; return function () { return 'hi ' + name; }; })('there');",
+    "var nested = (function () { var depth = 1; function up() { return function () { return ++depth; }; } return up(); })();",
+    "function result() {",
+    "    return [outer(10), strict(), callsEval(21), expr(5), foo(), outer.toString().length,",
+    "            counter(1) + counter(2), greet(), nested() + nested()].join(',');",
+    "}",
+].join("\n");
+
+var results = [];
+for (var i = 0; i < 3; i++) {
+    var context = WScript.LoadScript(source, "samethread");
+    results.push(context.result());
+}
+
+var expected = "16,true,42,120,foo," + source.split("\n").slice(0, 6).join("\n").length + ",4,hi there,5";
+var success = true;
+for (var i = 0; i < results.length; i++) {
+    if (results[i] !== expected) {
+        WScript.Echo("Failed: load " + i + " returned " + results[i] + ", expected " + expected);
+        success = false;
+    }
+}
+
+if (success) {
+    WScript.Echo("pass");
+}
@@ -0,0 +1,42 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// Objects only referenced from interpreter locals and pending out params must survive a collection
+// that runs in the middle of a call.
+
+function make(n) {
+    return { value: n, list: [n, n + 1, n + 2], text: "v" + n };
+}
+
+function check(o, n) {
+    return o.value === n && o.list.length === 3 && o.list[2] === n + 2 && o.text === "v" + n;
+}
+
+function collect() {
+    CollectGarbage();
+    return 0;
+}
+
+function leaf(a, b, c) {
+    var local = make(a.value + 100);
+    collect();
+    return check(a, a.value) && check(b, b.value) && check(c, c.value) && check(local, a.value + 100);
+}
+
+function nested(depth) {
+    var mine = make(depth);
+    if (depth === 0) {
+        // The first two arguments are already pushed when the collection in the third runs
+        return leaf(make(1), make(2), (collect(), make(3))) && check(mine, 0);
+    }
+    return nested(depth - 1) && check(mine, depth);
+}
+
+var passed = true;
+for (var i = 0; i < 5; i++) {
+    passed = passed && nested(20);
+}
+
+WScript.Echo(passed ? "pass" : "fail");
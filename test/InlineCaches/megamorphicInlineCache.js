@@ -0,0 +1,107 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// Drive a handful of property access sites past the largest polymorphic inline cache size, so that they fall back to
+// the script context's megamorphic inline cache, and check that the cached results are invalidated correctly.
+
+var shapeCount = 100;
+var passed = true;
+
+function check(actual, expected, message)
+{
+    if (actual !== expected)
+    {
+        WScript.Echo("FAILED: " + message + ": expected " + expected + ", actual " + actual);
+        passed = false;
+    }
+}
+
+function Proto() {}
+Proto.prototype.p = "proto";
+
+var objects = [];
+for (var i = 0; i < shapeCount; i++)
+{
+    var o = new Proto();
+    o["f" + i] = i;
+    o.x = i;
+    objects.push(o);
+}
+
+function getX(o) { return o.x; }
+function getP(o) { return o.p; }
+function getMissing(o) { return o.missing; }
+function setX(o, v) { o.x = v; }
+function addY(o, v) { o.y = v; }
+
+for (var iter = 0; iter < 4; iter++)
+{
+    for (var i = 0; i < shapeCount; i++)
+    {
+        check(getX(objects[i]), i, "local load");
+        check(getP(objects[i]), "proto", "proto load");
+        check(getMissing(objects[i]), undefined, "missing load");
+    }
+}
+
+// Stores and add-property stores.
+for (var i = 0; i < shapeCount; i++)
+{
+    setX(objects[i], -i);
+    check(getX(objects[i]), -i, "local store");
+}
+
+var added = [];
+for (var iter = 0; iter < 2; iter++)
+{
+    for (var i = 0; i < shapeCount; i++)
+    {
+        var o = new Proto();
+        o["g" + i] = i;
+        addY(o, i);
+        check(o.y, i, "add property store");
+        added.push(o);
+    }
+}
+
+// Changing the prototype must invalidate proto and missing property caches.
+Proto.prototype.p = "changed";
+Proto.prototype.missing = "found";
+for (var i = 0; i < shapeCount; i++)
+{
+    check(getP(objects[i]), "changed", "proto load after prototype change");
+    check(getMissing(objects[i]), "found", "missing load after prototype change");
+}
+
+// Accessors on the prototype.
+Object.defineProperty(Proto.prototype, "p", { get: function () { return "getter"; }, configurable: true });
+for (var i = 0; i < shapeCount; i++)
+{
+    check(getP(objects[i]), "getter", "getter load");
+}
+
+// A setter on the prototype must win over a cached add-property store.
+var setterCalls = 0;
+Object.defineProperty(Proto.prototype, "y", { set: function (v) { setterCalls++; }, configurable: true });
+for (var i = 0; i < shapeCount; i++)
+{
+    var o = new Proto();
+    o["g" + i] = i;
+    addY(o, i);
+    check(o.hasOwnProperty("y"), false, "add property store after setter definition");
+}
+check(setterCalls, shapeCount, "setter calls");
+
+// Shadowing on the instance after the proto load was cached.
+for (var i = 0; i < shapeCount; i++)
+{
+    Object.defineProperty(objects[i], "p", { value: "own" + i });
+    check(getP(objects[i]), "own" + i, "shadowed proto load");
+}
+
+if (passed)
+{
+    WScript.Echo("pass");
+}
@@ -0,0 +1,104 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// Covers the block scanning, exact number and string slicing paths of JSON.parse against the general paths.
+
+var failed = 0;
+function check(actual, expected, message) {
+    if (actual !== expected && !(actual !== actual && expected !== expected)) {
+        WScript.Echo("FAILED: " + message + ": expected " + expected + ", got " + actual);
+        failed++;
+    }
+}
+
+function checkThrows(text, message) {
+    try {
+        JSON.parse(text);
+        WScript.Echo("FAILED: " + message + ": expected a SyntaxError");
+        failed++;
+    } catch (e) {
+        check(e instanceof SyntaxError, true, message);
+    }
+}
+
+// Numbers: the exact fast path must agree with the general conversion, including on its boundaries
+var numbers = [
+    "0", "1", "9", "10", "123456789", "999999999999999", "1000000000000000", "9007199254740993",
+    "12345678901234567890", "0.5", "0.1", "0.000001", "0.0000000000000000000001", "1.5e10", "1E22", "1e23",
+    "1e-22", "1e-23", "123456789012345e22", "1.7976931348623157e308", "5e-324", "2e308", "1e-400",
+    "0e500", "0.0", "3.14159265358979", "3.141592653589793", "1.000000000000000000001", "1e+5", "1E-5",
+    "0.30000000000000004", "4.35", "2.675", "1.0000000000000002"
+];
+numbers.forEach(function (n) {
+    check(JSON.parse(n), Number(n), "number " + n);
+    check(JSON.parse("-" + n), -Number(n), "number -" + n);
+    check(JSON.parse("[" + n + "]")[0], Number(n), "array element " + n);
+    check(JSON.parse("{\"v\":" + n + "}").v, Number(n), "property value " + n);
+});
+check(1 / JSON.parse("-0"), -Infinity, "negative zero");
+
+["01", "1.", ".5", "1e", "1e+", "1.e5", "00", "-", "0x10", "1.5e", "--1"].forEach(function (n) {
+    checkThrows(n, "malformed number " + n);
+});
+
+// Strings: put escapes, quotes and control characters at every offset of a block
+var plain = "abcdefghijklmnopqrstuvwxyz0123456789";
+for (var i = 0; i <= 20; i++) {
+    var prefix = plain.substr(0, i);
+    check(JSON.parse("\"" + prefix + "\""), prefix, "plain string of length " + i);
+    check(JSON.parse("\"" + prefix + "\\n" + prefix + "\""), prefix + "\n" + prefix, "escape at offset " + i);
+    check(JSON.parse("\"" + prefix + "\\u00e9\\\"" + plain + "\""), prefix + "\u00e9\"" + plain, "unicode escape at offset " + i);
+    check(JSON.parse("\"" + prefix + "\u2028\u00ff\uffff\""), prefix + "\u2028\u00ff\uffff", "non-ASCII at offset " + i);
+    checkThrows("\"" + prefix + "\u0001" + plain + "\"", "control character at offset " + i);
+    checkThrows("\"" + prefix + "\t\"", "tab at offset " + i);
+    checkThrows("\"" + prefix, "unterminated string of length " + i);
+}
+
+// Whitespace runs of every length around tokens
+for (var i = 0; i <= 20; i++) {
+    var ws = "";
+    for (var j = 0; j < i; j++) {
+        ws += " \t\r\n"[j % 4];
+    }
+    var obj = JSON.parse(ws + "{" + ws + "\"a\"" + ws + ":" + ws + "[" + ws + "1" + ws + "," + ws + "\"x\"" + ws + "]" + ws + "}" + ws);
+    check(obj.a.length, 2, "whitespace run " + i);
+    check(obj.a[0], 1, "whitespace run " + i);
+    check(obj.a[1], "x", "whitespace run " + i);
+}
+
+// Short string values are copied, large ones are shared with the input text; both must survive the input and stay usable
+var parts = [];
+for (var i = 0; i < 200; i++) {
+    parts.push("{\"id\":" + i + ",\"name\":\"item" + i + "\",\"tag\":\"t\\u0041" + i + "\"}");
+}
+var text = "[" + parts.join(",") + "]";
+var items = JSON.parse(text);
+text = null;
+parts = null;
+CollectGarbage();
+for (var i = 0; i < items.length; i++) {
+    check(items[i].id, i, "item id " + i);
+    check(items[i].name, "item" + i, "item name " + i);
+    check(items[i].tag, "tA" + i, "item tag " + i);
+    check(items[i].name.length, ("item" + i).length, "item name length " + i);
+}
+check(items[5].name + items[6].name, "item5item6", "concatenated slices");
+check(JSON.parse(JSON.stringify(items))[199].name, "item199", "round trip");
+
+var big = "";
+for (var i = 0; i < 100; i++) {
+    big += "0123456789";
+}
+var bigItems = JSON.parse("[\"" + big + "\",\"short\",\"" + big + "x\"]");
+CollectGarbage();
+check(bigItems[0], big, "large value");
+check(bigItems[1], "short", "short value next to large ones");
+check(bigItems[2].length, big.length + 1, "large value length");
+check(bigItems[2].substring(995), "56789x", "large value tail");
+check(bigItems[0] + bigItems[1], big + "short", "concatenated large value");
+
+if (failed == 0) {
+    WScript.Echo("pass");
+}
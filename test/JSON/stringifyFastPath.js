@@ -0,0 +1,106 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// Covers the plain object and array path of JSON.stringify and the cases that have to leave it.
+
+var failed = 0;
+function check(actual, expected, message) {
+    if (actual !== expected) {
+        WScript.Echo("FAILED: " + message + ": expected " + expected + ", got " + actual);
+        failed++;
+    }
+}
+
+// Plain data
+check(JSON.stringify({}), '{}', "empty object");
+check(JSON.stringify([]), '[]', "empty array");
+check(JSON.stringify({ a: 1, b: "x", c: true, d: false, e: null }), '{"a":1,"b":"x","c":true,"d":false,"e":null}', "primitive members");
+check(JSON.stringify({ a: { b: { c: [1, [2, [3]]] } } }), '{"a":{"b":{"c":[1,[2,[3]]]}}}', "nesting");
+check(JSON.stringify([1, 2, 3]), '[1,2,3]', "int array");
+check(JSON.stringify([1.5, -0, 2]), '[1.5,0,2]', "float array");
+check(JSON.stringify([1, "a", null, true]), '[1,"a",null,true]', "var array");
+check(JSON.stringify([NaN, Infinity, -Infinity, -0, 1e21, 1e-7, 0.1, -2147483648, 2147483648]),
+    '[null,null,null,0,1e+21,1e-7,0.1,-2147483648,2147483648]', "numbers");
+check(JSON.stringify({ a: undefined, b: Symbol(), c: 1 }), '{"c":1}', "skipped members");
+check(JSON.stringify({ a: undefined }), '{}', "all members skipped");
+check(JSON.stringify([undefined, Symbol()]), '[null,null]', "undefined elements");
+var withSymbolKey = { a: 1 };
+withSymbolKey[Symbol("s")] = 2;
+withSymbolKey.b = 3;
+check(JSON.stringify(withSymbolKey), '{"a":1,"b":3}', "symbol keys");
+
+// Escaping, in values and in property names
+check(JSON.stringify({ "q\"k\\\n": "\b\f\n\r\t\u0001\u001f\"\\/\u2028\u00ff" }),
+    '{"q\\"k\\\\\\n":"\\b\\f\\n\\r\\t\\u0001\\u001f\\"\\\\/\u2028\u00ff"}', "escapes");
+
+// Objects of one shape share their key prefixes
+var rows = [];
+for (var i = 0; i < 100; i++) {
+    rows.push({ id: i, name: "row" + i, tags: ["t" + i], nested: { x: i / 2 } });
+}
+var text = JSON.stringify(rows);
+check(text.length > 0 && JSON.stringify(JSON.parse(text)), text, "round trip");
+check(JSON.stringify(rows[3]), '{"id":3,"name":"row3","tags":["t3"],"nested":{"x":1.5}}', "row");
+
+// Gap
+check(JSON.stringify({ a: [1, { b: 2 }], c: {}, d: [] }, null, 2),
+    '{\n  "a": [\n    1,\n    {\n      "b": 2\n    }\n  ],\n  "c": {},\n  "d": []\n}', "numeric gap");
+check(JSON.stringify([{ a: 1 }], null, "--"), '[\n--{\n----"a": 1\n--}\n]', "string gap");
+
+// Cases that go through the general path
+check(JSON.stringify({ a: 1, 0: 2 }), '{"0":2,"a":1}', "indexed property");
+check(JSON.stringify([1, , 3]), '[1,null,3]', "hole");
+Array.prototype[1] = "fromProto";
+check(JSON.stringify([1, , 3]), '[1,"fromProto",3]', "hole filled from the prototype");
+delete Array.prototype[1];
+check(JSON.stringify({ a: new Date(0) }), '{"a":"1970-01-01T00:00:00.000Z"}', "toJSON on a prototype");
+check(JSON.stringify({ a: { toJSON: function (key) { return key + "!"; } } }), '{"a":"a!"}', "own toJSON");
+check(JSON.stringify({ get a() { return 1; } }), '{"a":1}', "getter");
+check(JSON.stringify({ a: new Number(1), b: new String("s"), c: new Boolean(false) }), '{"a":1,"b":"s","c":false}', "wrappers");
+check(JSON.stringify({ a: function () {} }), '{}', "function member");
+check(JSON.stringify([function () {}]), '[null]', "function element");
+check(JSON.stringify({ a: 1, b: 2 }, ["b"]), '{"b":2}', "replacer array");
+check(JSON.stringify({ a: 1 }, function (k, v) { return typeof v === "number" ? v + 1 : v; }), '{"a":2}', "replacer function");
+check(JSON.stringify({ a: new Proxy({ b: 1 }, {}) }), '{"a":{"b":1}}', "proxy");
+var nonEnumerable = { a: 1 };
+Object.defineProperty(nonEnumerable, "b", { value: 2, enumerable: false });
+check(JSON.stringify(nonEnumerable), '{"a":1}', "non-enumerable property");
+var dictionary = { a: 1, b: 2, c: 3 };
+delete dictionary.b;
+check(JSON.stringify(dictionary), '{"a":1,"c":3}', "deleted property");
+
+Object.prototype.toJSON = function () { return "replaced"; };
+check(JSON.stringify({ a: 1 }), '"replaced"', "toJSON added to Object.prototype");
+delete Object.prototype.toJSON;
+check(JSON.stringify({ a: 1 }), '{"a":1}', "toJSON removed from Object.prototype");
+
+var cyclic = { a: [] };
+cyclic.a.push(cyclic);
+try {
+    JSON.stringify(cyclic);
+    WScript.Echo("FAILED: cycle: expected a TypeError");
+    failed++;
+} catch (e) {
+    check(e instanceof TypeError, true, "cycle");
+}
+
+// A member the fast path can't write is stringified on its own; the members around it stay on the fast path
+check(JSON.stringify({ a: 1, d: new Date(0), b: [1, , { c: 2 }], e: "x" }),
+    '{"a":1,"d":"1970-01-01T00:00:00.000Z","b":[1,null,{"c":2}],"e":"x"}', "mixed members");
+check(JSON.stringify([{ a: 1 }, new Date(0), { a: 2 }], null, 1),
+    '[\n {\n  "a": 1\n },\n "1970-01-01T00:00:00.000Z",\n {\n  "a": 2\n }\n]', "mixed elements with a gap");
+check(JSON.stringify({ a: { b: { toJSON: function () { return { c: [1, 2] }; } } } }, null, 1),
+    '{\n "a": {\n  "b": {\n   "c": [\n    1,\n    2\n   ]\n  }\n }\n}', "nested toJSON with a gap");
+var mutated = { a: 1, b: { toJSON: function () { mutated.c = "changed"; delete mutated.d; return "b"; } }, c: 3, d: 4, e: 5 };
+check(JSON.stringify(mutated), '{"a":1,"b":"b","c":"changed","e":5}', "toJSON that changes the holder");
+var grown = [1, { toJSON: function () { grown.length = 3; grown[2] = "late"; return "x"; } }, 3, 4];
+check(JSON.stringify(grown), '[1,"x","late",null]', "toJSON that changes the array");
+
+var shared = { x: 1 };
+check(JSON.stringify([shared, shared]), '[{"x":1},{"x":1}]', "repeated object is not a cycle");
+
+if (failed === 0) {
+    WScript.Echo("pass");
+}
@@ -0,0 +1,110 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// Without background sweep, blocks with garbage are swept lazily: by allocation, on idle, or by the next
+// collection's sweep. Objects that survive must keep their contents whichever of those sweeps their block.
+
+var failed = false;
+
+function check(condition, message) {
+    if (!condition) {
+        WScript.Echo("FAILED: " + message);
+        failed = true;
+    }
+}
+
+// Objects of several small and medium sizes, in normal and leaf blocks
+function make(i) {
+    switch (i % 5) {
+        case 0: return { index: i, next: null };
+        case 1: return [i, i + 1, i + 2];
+        case 2: return "s" + i + "_".repeat(i % 40);
+        case 3: return new Float64Array(1 + (i % 300));
+        default: var o = {}; for (var k = 0; k < 12; k++) { o["p" + k] = i + k; } return o;
+    }
+}
+
+function verify(value, i) {
+    switch (i % 5) {
+        case 0: return value.index === i;
+        case 1: return value[0] === i && value[2] === i + 2;
+        case 2: return value === "s" + i + "_".repeat(i % 40);
+        case 3: return value.length === 1 + (i % 300);
+        default: return value.p0 === i && value.p11 === i + 11;
+    }
+}
+
+var survivors = [];
+for (var round = 0; round < 6; round++) {
+    // Keep one object in eight, so most blocks are left with garbage to sweep
+    for (var i = 0; i < 20000; i++) {
+        var value = make(i);
+        if ((i & 7) === round % 8) {
+            survivors.push({ i: i, value: value });
+        }
+    }
+
+    CollectGarbage();
+
+    // Allocate a few sizes only, so most of the pending blocks are not reached by allocation before the next collection
+    var churn = [];
+    for (var i = 0; i < 2000 * round; i++) {
+        churn.push({ a: i });
+    }
+
+    for (var j = 0; j < survivors.length; j++) {
+        if (!verify(survivors[j].value, survivors[j].i)) {
+            check(false, "round " + round + ": survivor " + survivors[j].i + " was corrupted");
+            break;
+        }
+    }
+
+    // Drop half of the survivors, so the next collection frees objects in blocks swept lazily before
+    survivors = survivors.filter(function (s, k) { return k % 2 === 0; });
+}
+
+check(churn.length === 10000 && churn[9999].a === 9999, "churn");
+
+// Allocate the same sizes while blocks are still pending sweep, so allocation sweeps them and reuses their
+// free slots. Collect again before allocation has reached all of them, and check both generations.
+var old = [];
+for (var i = 0; i < 20000; i++) {
+    var value = make(i);
+    if (i % 3 === 0) {
+        old.push({ i: i, value: value });
+    }
+}
+CollectGarbage();
+
+var young = [];
+for (var round = 0; round < 4; round++) {
+    for (var i = 0; i < 1500; i++) {
+        var n = 20000 + round * 1500 + i;
+        young.push({ i: n, value: make(n) });
+    }
+
+    for (var j = 0; j < old.length; j++) {
+        if (!verify(old[j].value, old[j].i)) {
+            check(false, "pending round " + round + ": old object " + old[j].i + " was corrupted");
+            break;
+        }
+    }
+    for (var j = 0; j < young.length; j++) {
+        if (!verify(young[j].value, young[j].i)) {
+            check(false, "pending round " + round + ": new object " + young[j].i + " was corrupted");
+            break;
+        }
+    }
+
+    // Free some of each generation, then collect while blocks from the last collection may still be pending
+    old = old.filter(function (s, k) { return k % 3 !== 0; });
+    young = young.filter(function (s, k) { return k % 2 === 0; });
+    CollectGarbage();
+}
+check(old.length > 0 && young.length > 0, "pending");
+
+if (!failed) {
+    WScript.Echo("pass");
+}
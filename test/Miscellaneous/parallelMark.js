@@ -0,0 +1,99 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// The mark stack is split between the parallel markers, which steal work from each other as they run dry.
+// Build graphs that leave uneven work behind (a long list, wide arrays, deep trees) and check every
+// reachable object survives the collections.
+
+var failed = false;
+
+function check(condition, message) {
+    if (!condition) {
+        WScript.Echo("FAILED: " + message);
+        failed = true;
+    }
+}
+
+// A long linked list: one marker gets all of it, the others have to steal
+function makeList(length) {
+    var head = null;
+    for (var i = 0; i < length; i++) {
+        head = { value: i, next: head };
+    }
+    return head;
+}
+
+function verifyList(head, length) {
+    for (var i = length - 1; i >= 0; i--) {
+        if (head === null || head.value !== i) {
+            return false;
+        }
+        head = head.next;
+    }
+    return head === null;
+}
+
+// A wide array of small objects: spreads over many mark stack chunks at once
+function makeWide(count) {
+    var wide = [];
+    for (var i = 0; i < count; i++) {
+        wide.push({ index: i, name: "w" + i, data: [i, i * 2] });
+    }
+    return wide;
+}
+
+function verifyWide(wide, count) {
+    if (wide.length !== count) {
+        return false;
+    }
+    for (var i = 0; i < count; i++) {
+        var o = wide[i];
+        if (o.index !== i || o.name !== "w" + i || o.data[1] !== i * 2) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// A deep binary tree: keeps pushing new work while it is being marked
+function makeTree(depth) {
+    if (depth === 0) {
+        return null;
+    }
+    return { depth: depth, left: makeTree(depth - 1), right: makeTree(depth - 1) };
+}
+
+function countTree(node) {
+    if (node === null) {
+        return 0;
+    }
+    return 1 + countTree(node.left) + countTree(node.right);
+}
+
+var list = makeList(30000);
+var wide = makeWide(20000);
+var tree = makeTree(14);
+var treeCount = (1 << 14) - 1;
+
+for (var round = 0; round < 5; round++) {
+    // Garbage in between, so the collections have something to free
+    for (var i = 0; i < 10000; i++) {
+        var garbage = { round: round, i: i, payload: [i] };
+    }
+
+    CollectGarbage();
+
+    check(verifyList(list, 30000), "round " + round + ": list");
+    check(verifyWide(wide, 20000), "round " + round + ": wide array");
+    check(countTree(tree) === treeCount, "round " + round + ": tree");
+
+    // Replace part of the graphs, so the next mark sees new objects as well as old ones
+    wide = makeWide(20000);
+    tree.left = makeTree(13);
+}
+
+if (!failed) {
+    WScript.Echo("pass");
+}
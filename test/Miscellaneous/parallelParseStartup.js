@@ -0,0 +1,105 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// With -ParallelParseStartupFunctions and a dynamic profile from an earlier run, the functions the profile
+// recorded as executed at startup are parsed on background threads. Mix functions that run at startup with
+// ones that don't, and nest closures so captured variables have to be resolved across the parse boundary.
+// Builds without the JIT have neither dynamic profiles nor background parsing, so there the flag must change nothing.
+
+var failed = false;
+
+function check(actual, expected, message) {
+    if (actual !== expected) {
+        WScript.Echo("FAILED: " + message + ": expected " + expected + ", got " + actual);
+        failed = true;
+    }
+}
+
+var counter = 0;
+
+function startupSimple(x) {
+    return x * 2 + 1;
+}
+
+function startupClosure(base) {
+    var captured = base + 10;
+    function inner(y) {
+        counter++;
+        return captured + y;
+    }
+    return inner;
+}
+
+function startupNested(n) {
+    function level1(a) {
+        function level2(b) {
+            return a + b + n;
+        }
+        return level2(a * 2);
+    }
+    return level1(n);
+}
+
+var startupExpression = function (values) {
+    var sum = 0;
+    for (var i = 0; i < values.length; i++) {
+        sum += values[i];
+    }
+    return sum;
+};
+
+var startupArrow = (a, b = 3) => a * b;
+
+class StartupClass {
+    constructor(name) {
+        this.name = name;
+    }
+    greet() {
+        return "hello " + this.name;
+    }
+    static create(name) {
+        return new StartupClass(name);
+    }
+}
+
+function startupWithEval(s) {
+    var local = 5;
+    return eval(s);
+}
+
+function startupArguments() {
+    return arguments.length + (arguments[0] || 0);
+}
+
+// Never called at startup, so a profile leaves these deferred
+function notAtStartup(x) {
+    function innerNotAtStartup() {
+        return x + counter;
+    }
+    return innerNotAtStartup();
+}
+
+function alsoNotAtStartup() {
+    return "later";
+}
+
+check(startupSimple(20), 41, "startupSimple");
+check(startupClosure(1)(5), 16, "startupClosure");
+check(startupClosure(2)(0), 12, "startupClosure second instance");
+check(startupNested(3), 12, "startupNested");
+check(startupExpression([1, 2, 3, 4]), 10, "startupExpression");
+check(startupArrow(4), 12, "startupArrow default");
+check(startupArrow(4, 5), 20, "startupArrow");
+check(StartupClass.create("world").greet(), "hello world", "StartupClass");
+check(startupWithEval("local + 1"), 6, "startupWithEval");
+check(startupArguments(7, 8, 9), 10, "startupArguments");
+check(counter, 2, "counter");
+
+check(notAtStartup(1), 3, "notAtStartup");
+check(alsoNotAtStartup(), "later", "alsoNotAtStartup");
+
+if (!failed) {
+    WScript.Echo("pass");
+}
@@ -0,0 +1,72 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// After a sweep, leaf blocks with only a few live objects are moved behind the denser ones so that they
+// are allocated from last and can drain. Leave a thin set of survivors spread over many leaf blocks, keep
+// allocating, and check the survivors and the new strings keep their contents as their blocks drain.
+
+var failed = false;
+
+function check(condition, message) {
+    if (!condition) {
+        WScript.Echo("FAILED: " + message);
+        failed = true;
+    }
+}
+
+// The string buffers of these are leaf allocations of a few small sizes
+function make(i) {
+    return ("v" + i + "_").repeat(1 + (i % 4));
+}
+
+var survivors = [];
+var count = 40000;
+
+// Fill many leaf blocks and keep one string in thirty, so every block is left sparse
+var all = [];
+for (var i = 0; i < count; i++) {
+    all.push(make(i));
+}
+for (var i = 0; i < count; i += 30) {
+    survivors.push(i);
+    survivors.push(all[i]);
+}
+all = null;
+
+for (var round = 0; round < 6; round++) {
+    CollectGarbage();
+
+    // New strings go into the dense blocks first; the sparse ones are only reused once those are full
+    var live = [];
+    for (var i = 0; i < count / 4; i++) {
+        var s = make(i + round);
+        if (i % 3 === 0) {
+            live.push(s);
+        }
+    }
+
+    for (var i = 0; i < live.length; i++) {
+        if (live[i] !== make(i * 3 + round)) {
+            check(false, "round " + round + ": new string " + i);
+            break;
+        }
+    }
+
+    for (var j = 0; j < survivors.length; j += 2) {
+        if (survivors[j + 1] !== make(survivors[j])) {
+            check(false, "round " + round + ": survivor " + survivors[j]);
+            break;
+        }
+    }
+
+    // Drop half of the survivors, so some of the sparse blocks become empty
+    if (round % 2 === 1) {
+        survivors = survivors.slice(0, survivors.length / 2 & ~1);
+    }
+}
+
+if (!failed) {
+    WScript.Echo("pass");
+}
@@ -0,0 +1,459 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// Decimal strings with up to 20 significant digits must convert to the correctly rounded double through every path
+// that parses numbers. Debug builds also check every fast conversion against the BIGNUM based one.
+
+var float64 = new Float64Array(1);
+var uint32 = new Uint32Array(float64.buffer);
+
+function toBits(value) {
+    float64[0] = value;
+    return ("00000000" + uint32[1].toString(16)).slice(-8) + ("00000000" + uint32[0].toString(16)).slice(-8);
+}
+
+var failures = 0;
+function check(string, how, value, expected) {
+    if (toBits(value) !== expected) {
+        failures++;
+        WScript.Echo("FAILED: " + how + "(" + string + ") gave " + toBits(value) + ", expected " + expected);
+    }
+}
+
+// [string, expected bits]
+var corpus = [
+    ["9007199254740993", "4340000000000000"],
+    ["9007199254740993.0", "4340000000000000"],
+    ["90071992547409930e-1", "4340000000000000"],
+    ["9007199254740995", "4340000000000002"],
+    ["18014398509481986", "4350000000000000"],
+    ["18014398509481990", "4350000000000002"],
+    ["0.1", "3fb999999999999a"],
+    ["0.30000000000000004", "3fd3333333333334"],
+    ["2.2250738585072011e-308", "000fffffffffffff"],
+    ["2.2250738585072014e-308", "0010000000000000"],
+    ["4.9406564584124654e-324", "0000000000000001"],
+    ["2.4703282292062327e-324", "0000000000000000"],
+    ["2.4703282292062328e-324", "0000000000000001"],
+    ["1e-324", "0000000000000000"],
+    ["1.7976931348623157e308", "7fefffffffffffff"],
+    ["1.7976931348623158e308", "7fefffffffffffff"],
+    ["1.7976931348623159e308", "7ff0000000000000"],
+    ["1e309", "7ff0000000000000"],
+    ["123456789012345678", "437b69b4ba630f35"],
+    ["1234567890123456789", "43b12210f47de981"],
+    ["12345678901234567890", "43e56a95319d63e1"],
+    ["0.000000000000000000000000000001234567890123456789", "39b90a3e33c69ac3"],
+    ["1.234567890123456789e-200", "166e3d71f622be95"],
+    ["9.999999999999999999e22", "44b52d02c7e14af6"],
+    ["1e23", "44b52d02c7e14af6"],
+    ["8.589973e9", "42000004b0400000"],
+    ["3.141592653589793238", "400921fb54442d18"],
+    ["2.718281828459045235", "4005bf0a8b145769"],
+    ["47.625", "4047d00000000000"],
+    ["4.35", "4011666666666666"],
+    ["1e-7", "3e7ad7f29abcaf48"],
+    ["5e-324", "0000000000000001"],
+    ["1448997445238699", "4314976c0803feac"],
+    ["1.448997445238699e-300", "01af0d6137f29e5a"],
+    ["7.3177701707893310e15", "4339ff792393edd3"],
+    ["9.1e-17", "3c9a3a9d6656f838"],
+    ["6.02214076e23", "44dfe185ca57c517"],
+    ["44111215846342766e-329", "00000014c9a0a6f2"],
+    ["6.466638092685532242e-43", "372cd7986e9ded0a"],
+    ["8.5809181643785899e3", "40c0c27586690d33"],
+    ["1040932241255512e42", "4bc539eb7ae218a0"],
+    ["8.931960088165941785e-130", "2523cff2e52b1082"],
+    ["3.8316586737293790e-223", "11c1ba8342b96b12"],
+    ["89650559573016820e-41", "3af15747db45e5fa"],
+    ["3.73681487281474794e-136", "23d161fede4cdb05"],
+    ["7.54941304784924283e-51", "358698b88df35036"],
+    ["2091469813696130201e-221", "15da3abb2a293e61"],
+    ["6.04643588482065529e-309", "0004590cfe49b63b"],
+    ["1.08516266400740430e82", "50f6e147a0cfc1d3"],
+    ["12928194549546620e-259", "0d81a7a5213c2c7d"],
+    ["3.69864315654517440e185", "6675c2e560f296af"],
+    ["5.616335084817928969e-252", "0bc496975d83fd7b"],
+    ["39604625162654930e-264", "0c91b8eea5e839ef"],
+    ["7.5987859963983115e159", "61214baeb3bc50eb"],
+    ["6.77756724126356597e-56", "347a96f4e7526ee3"],
+    ["111777408996205911e205", "6e08bcf764448182"],
+    ["7.05726386205042266e-220", "126fe3403801aa6b"],
+    ["9.256242574340331487e-103", "2ac095d5fdfb5268"],
+    ["1609978399115125865e-340", "0000000000000021"],
+    ["1.8420309296371700e254", "74b91feb1c0574b6"],
+    ["3.49400400448965115e-260", "0a1130e17e258517"],
+    ["2912445771866549e79", "538becbbf80715f7"],
+    ["7.691698865671563e279", "7a0b1e8179eb2057"],
+    ["5.246284840079439e-55", "34a9ba4af0aaf485"],
+    ["888855748142621562e-144", "25c34101bd0809d7"],
+    ["4.0487806851532688e-157", "1f763c3938d7b2a5"],
+    ["6.087592759917097e124", "59d705b0ccd92c8d"],
+    ["3393863126958318e-50", "38c68e5be02a38cd"],
+    ["7.52735351754882991e-234", "0f87ef03af2bd624"],
+    ["5.833180581071381e285", "7b439d1b6a52d4fc"],
+    ["17886793711146302e-214", "16e11d4408d2ce11"],
+    ["6.16169775084901060e-248", "0c9b92921f95c729"],
+    ["2.82592248807424862e10", "421a518634c2f84e"],
+    ["620521953671315953e-62", "36c1b6782130dac1"],
+    ["2.798238421964819e124", "59c52a37be182cae"],
+    ["8.004983254494020e268", "77c3652be2dce38f"],
+    ["2111833027518104568e-141", "2676562ddbcde96a"],
+    ["7.028295061784207e-290", "03e5eaf11c34d4da"],
+    ["5.644007120611688535e-309", "00040ef85ba274e8"],
+    ["6775662758345007e-274", "0a54d5f0460d54e3"],
+    ["8.55819336472536513e119", "58d5360c9b850fe5"],
+    ["4.616491979933984e14", "42fa3de14750db66"],
+    ["4499849811600680e-310", "02d2649ef3779d12"],
+    ["1.9763073033857981e282", "7a8b38016a1e6587"],
+    ["7.704105847632707e-314", "00000003a16ea0f9"],
+    ["3952689744393039e-124", "296db4aed2902dc2"],
+    ["2.93837831703920056e-37", "3858ff38a75442a7"],
+    ["3.812585937068931e74", "4f6af91c66a64d1e"],
+    ["55019669150075950e-180", "1e0958d14fde7203"],
+    ["8.89551430690516715e182", "65eacbfe1612ff2e"],
+    ["7.602604905369499e45", "49754e99fcb63a40"],
+    ["56963895618909670e237", "749f1427e4b410d9"],
+    ["3.6244518862613664e-140", "22fb9fa463309818"],
+    ["1.002875409211406e126", "5a17b452e16a1b70"],
+    ["14265583223935020e-118", "2ac98f9e7bc51171"],
+    ["6.832835544256303e-301", "019d49281dfb6b9e"],
+    ["5.704933755132997162e184", "664ada3772a01d3a"],
+    ["56566453205810471e180", "68c83724e0627451"],
+    ["6.33287287025467922e-71", "315bf91973889414"],
+    ["2.500459509963687856e186", "66a263bd68b38738"],
+    ["2775072449553368e-52", "38579b9297125a69"],
+    ["9.680500586545736e-36", "38a9bc3511f316b8"],
+    ["1.021110604701062e137", "5c618f91c4dccb19"],
+    ["839945781909441158e-227", "14861755443ad062"],
+    ["3.76186534651819128e-65", "328fb1933ba5a025"],
+    ["1.28123900680647674e-136", "23b7d7112935eca3"],
+    ["902662031021199328e143", "6159ae923f84aecc"],
+    ["3.6270032949364997e16", "43601b6ce3be0921"],
+    ["4.590004391558909494e-98", "2bb919461cc6f332"],
+    ["57635149821628196e73", "52921ba102f4241b"],
+    ["7.5736040169508428e21", "4479a90de96be328"],
+    ["5.23748553716740446e-186", "1976c9ea4bfbd3e3"],
+    ["124095414539224650e-164", "216fbc415a99e3a2"],
+    ["7.33297468101920935e231", "7012e4a30299e041"],
+    ["9.607736034595925e-197", "173cba3f1bc82f45"],
+    ["126762479518489043e122", "5cd1080fe6fd3b63"],
+    ["4.59417767942174763e74", "4f70405701b19c5d"],
+    ["3.850224453335696479e231", "7003d703587b0762"],
+    ["43890351689364247e-190", "1bf15e611c40feb7"],
+    ["9.82194137318676771e-79", "2fbd1d6dff276f58"],
+    ["6.9150262376797088e-152", "208cf93a3cc94d31"],
+    ["5026607154180521657e58", "4fdbc865a6559ae3"],
+    ["6.33344180555290110e204", "6a743355c935126a"],
+    ["5.306109212654016941e222", "6e2d5bb2c2713854"],
+    ["4823591835962635e166", "65a73fba80fddebe"],
+    ["8.46129144130120481e-143", "2270823e6f58a565"],
+    ["9.37928338243744076e42", "48daeacf241407f9"],
+    ["8950341538467026e-142", "25c36344a54a9d9f"],
+    ["8.008615212614200756e177", "64df9f0eb37aa752"],
+    ["2.9357410081964754e-314", "00000001622bd0c0"],
+    ["2126377280600336946e-210", "1823672715e0c061"],
+    ["1.614982751999187e264", "76c9a4cd56f595c9"],
+    ["4.540007639125099e-36", "38982389c63cf08f"],
+    ["7698820315398588e-209", "17d67af27f8c6e53"],
+    ["8.4543602510970364e276", "796e8605e02369d7"],
+    ["7.5189459314355302e-109", "297c40f2b6b07254"],
+    ["631910385576172917e140", "60b26900c2758b0e"],
+    ["3.1124843499395809e-181", "1a74aa1b995e3c6a"],
+    ["4.36187895951455385e-142", "229546acfc78ab9a"],
+    ["8292651090468030773e-184", "1da8733b10b2451f"],
+    ["8.295197507279652372e26", "4585714d1e57f364"],
+    ["7.587536767274036043e82", "5123ff50edc60a3a"],
+    ["80843416417951129e182", "693b099d8f2199a1"],
+    ["5.068165653295994e-233", "0fb424a5a13e792c"],
+    ["5.751304601830384e205", "6aa6ee0413232dc6"],
+    ["495512942693167454e229", "7326ad9e5ce0973d"],
+    ["8.0710807503644719e58", "4c29b7484c099e51"],
+    ["3.3024902085261282e79", "5071d35682e4d029"],
+    ["97906935019235289e-265", "0c718650d0ece990"],
+    ["3.095382366438633e40", "4856bdc465afc1ec"],
+    ["6.548685727848796e-73", "30f283499a7ed724"],
+    ["9988307083946294035e170", "672cb1e46934fdff"],
+    ["3.7371786003449809e-35", "38c8d67adaa37302"],
+    ["2.3690979315534892e209", "6b670f50b346394b"],
+    ["747530657958529799e257", "790145d6c1dd0ff5"],
+    ["8.0962533924942451e-129", "255672bf9f3124cd"],
+    ["8.2179278715898139e-40", "37d1e5a5dbfeb166"],
+    ["1746522370199605e-160", "21e17271fc0ff339"],
+    ["2.954107025823986199e281", "7a6046337a4d6f15"],
+    ["2.843342268952613861e280", "7a290ffb59e9c0d1"],
+    ["61960357462809808e86", "55462197b3ca8f45"],
+    ["9.276463525378284805e186", "66c10e50afb6f705"],
+    ["5.76379077261812374e-110", "294153a499438ed9"],
+    ["85080415752534566e-192", "1b958c4a0a01ac7b"],
+    ["4.73862557909165509e14", "42faef9b96fc0ad8"],
+    ["4.8169336941835238e-327", "0000000000000000"],
+    ["872915214097680828e-237", "1273b89353193324"],
+    ["5.6685473804454682e-159", "1f13ec7611447cb3"],
+    ["3.2743573296312316e-94", "2c85db3016a713c3"],
+    ["489892311170488145e-308", "03a8719464a2b5d3"],
+    ["8.915312514353843e-280", "06002ee1a2e1b6bc"],
+    ["1.552544216747542e-30", "39bf7d453cd3033c"],
+    ["36640550134876596e207", "6e59575145319b8d"],
+    ["2.923062130387027e227", "6f28ad9668ba49b9"],
+    ["6.615523338089164e-53", "3519587c8562e7b9"],
+    ["817506899690809047e-107", "2d70a72516528dac"],
+    ["3.38563742555489426e228", "6f61dd5791934f03"],
+    ["1.656177661692217e-236", "0efaf622a5f3dcf5"],
+    ["1216523160335474e47", "4cd2ed15408adcb4"],
+    ["3.5749157008923743e-13", "3d5927fee01fdcee"],
+    ["5.84864151633669495e239", "71b67449551152b3"],
+    ["808769621559203948e-6", "426789cda1c6e687"],
+    ["5.57160184411486971e-259", "0a512213d6fdc826"],
+    ["9.0373171612934019e54", "4b5796a7d51de4e2"],
+    ["9778061862160435e52", "4e0d03dc22d948bb"],
+    ["2.640770883923385159e285", "7b31c243eeb9b28b"],
+    ["6.05642114559541616e-102", "2aeb21325eb564a4"],
+    ["1155247806631436e193", "6b21fdd500b7de12"],
+    ["3.16133522741061240e-165", "1dc74d61537e46c7"],
+    ["2.45425988749890848e67", "4ded217818d2ec5e"],
+    ["48331920032198241e266", "7aa0a42e60b1a98e"],
+    ["9.673049322794285039e-264", "09537e72c39ff408"],
+    ["7.5254147324303467e-225", "116648c1d0c5f472"],
+    ["56832817580427486e-343", "0000000000000000"],
+    ["9.323852996618163e147", "5ea7557b29fa517f"],
+    ["9.92966703633785936e191", "67cbdb9b5d27a3b3"],
+    ["3547469713093707777e9", "45a6eccbdcf9ed02"],
+    ["2.145229665041214577e-226", "111453eb2597be4e"],
+    ["6.42634262377276300e257", "757566525ebc4198"],
+    ["92948874161464602e1", "43a9cc6a2bf554e6"],
+    ["5.7249190417155155e55", "4b82adaced376608"],
+    ["7.328504018344588e3", "40bca0810758a297"],
+    ["40571714627553065e-20", "3f3a96cddfeb04d0"],
+    ["4.4029780022036945e-316", "00000000054fd253"],
+    ["6.959608909253588e-242", "0dddb3491f27db46"],
+    ["32309848530298055e-331", "0000000026fa9dd7"],
+    ["4.6101412481436244e-79", "2fab54db992aa6d4"],
+    ["4.915667552630510e-245", "0d357b314eae74f9"],
+    ["9377390704986596e42", "4bf7e7086f2f3f10"],
+    ["1.91101942938376426e86", "51d897bb9b9affbe"],
+    ["5.748423255579057e-131", "24e466b8852f6b52"],
+    ["94135718516236568e-343", "0000000000000000"],
+    ["9.50387494903711274e-183", "1a243104968893f7"],
+    ["5.491561792549819861e-118", "2796283be1607776"],
+    ["3898641562886548e47", "4cee539e303045eb"],
+    ["7.1953954671813061e-145", "2201f842ff432840"],
+    ["5.873469928079312129e115", "57f7d9b6713440f8"],
+    ["468023416503405189e94", "571f234cb5a40faa"],
+    ["4.8715462766963943e183", "66125803b38b8e71"],
+    ["1.9464742109640545e-240", "0e29f54ef8c72d87"],
+    ["6696844158554174e-222", "15213349eead8a93"],
+    ["6.307862713375415361e141", "5d608d8b44f92d7a"],
+    ["6.078434895439330e123", "59a263dc0c87dbc2"],
+    ["4757333154808442e-334", "0000000000017821"],
+    ["4.87367866803400122e87", "5223998221790507"],
+    ["8.712841308858952476e-18", "3c6417275a4168ba"],
+    ["1958616126304289669e-40", "3b6d990775a01155"],
+    ["9.068137525696803839e8", "41cb06709c48eb49"],
+    ["7.67416784764447984e-80", "2f8232dd5f4267ee"],
+    ["572086322803604488e49", "4dcb2952f6a9f9a7"],
+    ["9.19675069220657500e-280", "0600b1a9e7101738"],
+    ["8.235662576604987582e170", "636b4724ac3fb72e"],
+    ["6942606090666062e182", "6902934583cf3317"],
+    ["3.5609923654612082e9", "41ea880dcdaec238"],
+    ["2.182771480498517e128", "5a94274a9f7e626d"],
+    ["575901964719685877e130", "5e9cd3391422ec1d"],
+    ["5.379935606253693461e266", "7750af4ecaf5a991"],
+    ["2.813531421680482e-241", "0dfe045ea25b635d"],
+    ["17382668874498763e-227", "142d425f2369708e"],
+    ["9.546622894503751785e199", "6973f47d94fc70c5"],
+    ["9.613560983738223e165", "6264de281d551d6a"],
+    ["6982536914416077707e-338", "0000000000003735"],
+    ["2.285479322490074e-185", "1998dc5b93aaa4a5"],
+    ["1.1064112351896287e267", "77612814d086370e"],
+    ["5788389095435690e198", "6c5131b3fcd5c76b"],
+    ["7.28632650237305408e24", "45181bc23464bfdb"],
+    ["9.661903225461932e260", "761f6b86423fcd3b"],
+    ["2182131715453263e-120", "2a3404d44a0da36d"],
+    ["1.518124439045879939e88", "523e86a20ad8158f"],
+    ["8.17866591780477991e265", "77244aa64224c9ae"],
+    ["858070153782687747e-319", "016d6bf787e63a23"],
+    ["6.410921447722549e-171", "1c98c6768dd8ca8a"],
+    ["7.2865567136800677e-187", "19495d101d9b924b"],
+    ["3446463650352381112e267", "7b372d51e1e3d1ab"],
+    ["5.875304746493181e-191", "1870c0eaa9170da4"],
+    ["1.320990550456513e82", "50fbda2f874ef7e1"],
+    ["149498562070315309e-29", "3d7a4cd112394a50"],
+    ["4.342088154380202e-142", "22952df68494837a"],
+    ["5.244464675951735e281", "7a6ce44fa0a32eb9"],
+    ["276451823108803825e-145", "257329a950b33d73"],
+    ["7.166615163570962e121", "593bc0dd3edcce9a"],
+    ["3.2115798794618723e108", "5675e1306ad502fd"],
+    ["7165556648662975823e-229", "144e2747eff1871e"],
+    ["9.2982782155655630e-268", "087eb39137313b88"],
+    ["5.805283053904217e-95", "2c5f000187df9971"],
+    ["461871922998596813e-272", "0b21566a14d4fadc"],
+    ["3.7683440102879587e-157", "1f74b1f463566cec"],
+    ["6.86195262937914678e-185", "19b2a91b81ecbeef"],
+    ["47796157305241147e-180", "1e0604e736b96a65"],
+    ["5.0972125139975177e90", "52c404a5bf8209a2"],
+    ["1.3332231628155725e127", "5a53b2054f6cb2c9"],
+    ["5579476705894407e272", "7bad50412aa5de1c"],
+    ["1.08126209755485381e73", "4f187a999bee2028"],
+    ["5.2682126935940488e-202", "1624a58d4e15039e"],
+    ["6089168457893182e-166", "20bfe43d78169096"],
+    ["5.2773394618957464e-151", "20bba3c161260cba"],
+    ["6.806202855925234e236", "711ac1f69b259fd8"],
+    ["29760959067490129e173", "67455feb104e691c"],
+    ["7.51864443532646702e87", "522e3c87f2929ac2"],
+    ["8.1598271330260168e271", "78634e97b9e35653"],
+    ["6323873983466154e-159", "2233bdd5db3f79a5"],
+    ["8.70184231110197782e105", "55ee5a63356077cd"],
+    ["6.336862019644719082e-1", "3fe44728492ba4b9"],
+    ["5697238428653635624e168", "66b4f33cce79aacc"],
+    ["1.748251191487885834e-298", "021d451096861aff"],
+    ["4.26917016826764026e125", "5a042e7c4f6554a7"],
+    ["59034632835229449e47", "4d2cb377ebc20a40"],
+    ["3.975871238109028289e-234", "0f794873ecc8a24a"],
+    ["5.9411115979167504e218", "6d5aedacce20f385"],
+    ["91643135492749432e170", "66c0d98710497efb"],
+    ["2.481832262292332490e-299", "01f09ee32d3cd802"],
+    ["5.70965046380199795e91", "52fc077a29401e04"],
+    ["9522625153312285e-320", "00d0b7b080d7e8b0"],
+    ["2.648630562116041e218", "6d480297e1e8ddb7"],
+    ["9.900131220207952e20", "444ad5989494f07a"],
+    ["161183704756925337e56", "4f223ecf2d9b3c1e"],
+    ["5.929066740657390951e-177", "1b5806b04dcff9cf"],
+    ["1.387692600505474e-196", "1744bf0cd2fdf897"],
+    ["1632609683493464e70", "51a0ced2d83a0114"],
+    ["1.4243197315029354e89", "5271e65adae109f1"],
+    ["6.1971693221361949e-276", "06cb76b66a55f80c"],
+    ["78296339992508330e-308", "037f40deb5d50c4e"],
+    ["9.1042352621270743e170", "636e279e84a81628"],
+    ["4.3455963473694378e274", "78f4151137e1fec8"],
+    ["3720798046942790e-203", "1904b8f99c742616"],
+    ["5.90535304690890023e-137", "23a5f9ec82440e13"],
+    ["2.16218375421879860e-44", "36dedc16764aeb46"],
+    ["9339843054652691e-32", "3c9aeb9678cbf5dc"],
+    ["7.6058277802350500e252", "7470993a79d09bd0"],
+    ["8.5274148215284452e-107", "29e908a3948bde68"],
+    ["1266165552836464122e21", "480dc474ec15ca4b"],
+    ["1.1002603375401326e-13", "3d3ef836160b0470"],
+    ["2.9844603009574954e-259", "0a425adad7715e09"],
+    ["37318869454616438e-296", "05eb18b946bb6afd"],
+    ["3.9385416138666913e-167", "1d6294735924f5e2"],
+    ["7.706835922733036e58", "4c288e2e6d9d72d8"],
+    ["9860659565577019e-201", "198573c80dbf8e73"],
+    ["7.221043243720706157e102", "5549cad95eda314b"],
+    ["9.03506258875225602e257", "757e16335a09ea5a"],
+    ["6508230537928094310e205", "6e668181ce512f6c"],
+    ["1.7871179716181680e178", "64f1a404cd447180"],
+    ["2.9146928108619654e40", "485569ed8a70b5b6"],
+    ["2504685644333312946e268", "7b650dfb56c1328d"],
+    ["5.69098661106289901e-274", "0733b419436db64b"],
+    ["1.562225707901154e264", "76c8ce591bdc8ffc"],
+    ["27807297438827105e170", "66a4736b2b7b7dcf"],
+    ["4.545440552263392051e94", "5395ca7f85511ddf"],
+    ["4.40001712944988487e-165", "1dd0375ff4c76256"],
+    ["5180316653084211e33", "4a0c5b2b76176c15"],
+    ["9.34769481731468029e138", "5cc91e60a68750f4"],
+    ["4.6556701166121961e259", "75d839584b169f38"],
+    ["8100815491864634e-3", "429d7878eb4c6289"],
+    ["3.676553402500979349e-238", "0ea3270fee51f18d"],
+    ["8.44959663109311598e-146", "21d0e1b135c9b829"],
+    ["745734600313057838e53", "4ea59c2aaefb8e7f"],
+    ["7.234742512163655e-219", "12a46e56ec538e50"],
+    ["5.8092391081839884e-194", "17d0f6774525a21c"],
+    ["9013354965924945", "434002cc9e7d3e28"],
+    ["90133549659249450e-1", "434002cc9e7d3e28"],
+    ["9008516926816969", "4340009965b02164"],
+    ["90085169268169690e-1", "4340009965b02164"],
+    ["9012329418770197", "434002553acd638a"],
+    ["90123294187701970e-1", "434002553acd638a"],
+    ["9007275823778995", "43400008e9ef665a"],
+    ["90072758237789950e-1", "43400008e9ef665a"],
+    ["9014744482929435", "4340036e6152ad8e"],
+    ["90147444829294350e-1", "4340036e6152ad8e"],
+    ["9010273765830695", "43400165eb921814"],
+    ["90102737658306950e-1", "43400165eb921814"],
+    ["9014354117865277", "43400340ef89979e"],
+    ["90143541178652770e-1", "43400340ef89979e"],
+    ["9013715384167215", "434002f693ca3598"],
+    ["90137153841672150e-1", "434002f693ca3598"],
+    ["9015071064654821", "43400394663781f2"],
+    ["90150710646548210e-1", "43400394663781f2"],
+    ["9008532236405457", "4340009b2df30568"],
+    ["90085322364054570e-1", "4340009b2df30568"],
+    ["9010487249143429", "4340017ec5de8342"],
+    ["90104872491434290e-1", "4340017ec5de8342"],
+    ["9009830677841341", "43400132568502de"],
+    ["90098306778413410e-1", "43400132568502de"],
+    ["9009240501225183", "434000eda1e2c370"],
+    ["90092405012251830e-1", "434000eda1e2c370"],
+    ["9009610089039323", "43400118a87602ee"],
+    ["90096100890393230e-1", "43400118a87602ee"],
+    ["9011890205784185", "43400222193c3c3c"],
+    ["90118902057841850e-1", "43400222193c3c3c"],
+    ["9015467674935795", "434003c2921fd0fa"],
+    ["90154676749357950e-1", "434003c2921fd0fa"],
+    ["9012797897031959", "4340028bc48ae08c"],
+    ["90127978970319590e-1", "4340028bc48ae08c"],
+    ["9008526029861095", "4340009a74fad874"],
+    ["90085260298610950e-1", "4340009a74fad874"],
+    ["9014413186520123", "43400347cfebaa1e"],
+    ["90144131865201230e-1", "43400347cfebaa1e"],
+    ["9007961436662577", "43400058baca9598"],
+    ["90079614366625770e-1", "43400058baca9598"],
+    ["9008707798817343", "434000af9e1ded20"],
+    ["90087077988173430e-1", "434000af9e1ded20"],
+    ["9012420440233041", "4340025fd3740a28"],
+    ["90124204402330410e-1", "4340025fd3740a28"],
+    ["9010269430500281", "434001656a5e25dc"],
+    ["90102694305002810e-1", "434001656a5e25dc"],
+    ["9015897266487139", "434003f494f33fb2"],
+    ["90158972664871390e-1", "434003f494f33fb2"],
+    ["9015988625594613", "434003ff37a9ec7a"],
+    ["90159886255946130e-1", "434003ff37a9ec7a"],
+    ["9011606932993801", "434002011f0c5b84"],
+    ["90116069329938010e-1", "434002011f0c5b84"],
+    ["9014113587751219", "43400324ef2e749a"],
+    ["90141135877512190e-1", "43400324ef2e749a"],
+    ["9009757823482955", "43400129db4a5e26"],
+    ["90097578234829550e-1", "43400129db4a5e26"],
+    ["9014211011450087", "4340033046a24a74"],
+    ["90142110114500870e-1", "4340033046a24a74"],
+    ["9012022300731267", "4340023179f8b3c2"],
+    ["90120223007312670e-1", "4340023179f8b3c2"],
+    ["9012958155860549", "4340029e6ca0b522"],
+    ["90129581558605490e-1", "4340029e6ca0b522"],
+    ["9014521341381381", "43400354672fc582"],
+    ["90145213413813810e-1", "43400354672fc582"],
+    ["9010520190124469", "434001829b9640da"],
+    ["90105201901244690e-1", "434001829b9640da"],
+    ["9013403038168411", "434002d237275aae"],
+    ["90134030381684110e-1", "434002d237275aae"],
+    ["9013484503392569", "434002dbb301b09c"],
+    ["90134845033925690e-1", "434002dbb301b09c"],
+    ["9007726277789217", "4340003d5a82c310"],
+    ["90077262777892170e-1", "4340003d5a82c310"],
+    ["9009737468176441", "434001277ca7b41c"],
+    ["90097374681764410e-1", "434001277ca7b41c"],
+    ["9013330114318073", "434002c9b9da877c"],
+    ["90133301143180730e-1", "434002c9b9da877c"],
+    ["9012903816430489", "43400298192fc1cc"],
+    ["90129038164304890e-1", "43400298192fc1cc"],
+    ["9012938287242857", "4340029c1c7f2f34"],
+    ["90129382872428570e-1", "4340029c1c7f2f34"]
+];
+
+corpus.forEach(function (entry) {
+    var string = entry[0];
+    var expected = entry[1];
+    check(string, "Number", Number(string), expected);
+    check(string, "parseFloat", parseFloat(string), expected);
+    check(string, "eval", eval(string), expected);
+    check(string, "JSON.parse", JSON.parse(string), expected);
+    check(string, "JSON.parse array", JSON.parse("[" + string + ", 1]")[0], expected);
+    check("-" + string, "Number", -Number("-" + string), expected);
+});
+
+if (failures === 0) {
+    WScript.Echo("pass");
+}
@@ -0,0 +1,453 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// Number to string conversion must produce the shortest digits that round trip and, of those, the ones closest
+// to the value. Debug builds also check every conversion against the BIGNUM based implementation.
+
+var float64 = new Float64Array(1);
+var uint32 = new Uint32Array(float64.buffer);
+
+function fromBits(hi, lo) {
+    uint32[1] = hi;
+    uint32[0] = lo;
+    return float64[0];
+}
+
+function toBits(value) {
+    float64[0] = value;
+    return ("00000000" + uint32[1].toString(16)).slice(-8) + ("00000000" + uint32[0].toString(16)).slice(-8);
+}
+
+var failures = 0;
+function check(condition, message) {
+    if (!condition) {
+        failures++;
+        WScript.Echo("FAILED: " + message);
+    }
+}
+
+// [bits, expected string]
+var corpus = [
+    ["0000000000000001", "5e-324"],
+    ["0000000000000002", "1e-323"],
+    ["0010000000000000", "2.2250738585072014e-308"],
+    ["000fffffffffffff", "2.225073858507201e-308"],
+    ["7fefffffffffffff", "1.7976931348623157e+308"],
+    ["44b52d02c7e14af6", "1e+23"],
+    ["444b1ae4d6e2ef50", "1e+21"],
+    ["3e7ad7f29abcaf48", "1e-7"],
+    ["3eb0c6f7a0b5ed8d", "0.000001"],
+    ["3c36b082c2148b8e", "1.23e-18"],
+    ["3fb999999999999a", "0.1"],
+    ["3fc999999999999a", "0.2"],
+    ["3fd3333333333333", "0.3"],
+    ["3fd3333333333334", "0.30000000000000004"],
+    ["3fd5555555555555", "0.3333333333333333"],
+    ["3fe5555555555555", "0.6666666666666666"],
+    ["400921fb54442d18", "3.141592653589793"],
+    ["4005bf0a8b145769", "2.718281828459045"],
+    ["4011666666666666", "4.35"],
+    ["3eb0c6f7a0b5ed8d", "0.000001"],
+    ["3e8421f5f40d8376", "1.5e-7"],
+    ["433fffffffffffff", "9007199254740991"],
+    ["4340000000000000", "9007199254740992"],
+    ["4350000000000000", "18014398509481984"],
+    ["441ac53a7e04bcda", "123456789012345680000"],
+    ["4480f0cf064dd592", "1e+22"],
+    ["3ea0c6f7a0b5ed8d", "5e-7"],
+    ["0000000000000064", "4.94e-322"],
+    ["41b1de784a800000", "299792458.5"],
+    ["44dfe185ca57c517", "6.02214076e+23"],
+    ["3c07a4da290c1653", "1.602176634e-19"],
+    ["4059100000000000", "100.25"],
+    ["bfe0000000000000", "-0.5"],
+    ["81a56e1fc2f8f359", "-1e-300"],
+    ["0010000000000000", "2.2250738585072014e-308"],
+    ["0008000000000000", "1.1125369292536007e-308"],
+    ["7fe0000000000000", "8.98846567431158e+307"],
+    ["0000000000000003", "1.5e-323"],
+    ["0000000000000001", "5e-324"],
+    ["0000000000000002", "1e-323"],
+    ["0000000000000000", "0"],
+    ["0000002000000000", "6.7903865311e-313"],
+    ["0000002000000001", "6.79038653114e-313"],
+    ["0000001fffffffff", "6.79038653104e-313"],
+    ["0170000000000000", "9.332636185032189e-302"],
+    ["0170000000000001", "9.33263618503219e-302"],
+    ["016fffffffffffff", "9.332636185032188e-302"],
+    ["03c0000000000000", "1.2826677504057426e-290"],
+    ["03c0000000000001", "1.282667750405743e-290"],
+    ["03bfffffffffffff", "1.2826677504057424e-290"],
+    ["0610000000000000", "1.7628851326804976e-279"],
+    ["0610000000000001", "1.762885132680498e-279"],
+    ["060fffffffffffff", "1.7628851326804974e-279"],
+    ["0860000000000000", "2.4228908772695546e-268"],
+    ["0860000000000001", "2.422890877269555e-268"],
+    ["085fffffffffffff", "2.4228908772695543e-268"],
+    ["0ab0000000000000", "3.329995865487836e-257"],
+    ["0ab0000000000001", "3.3299958654878365e-257"],
+    ["0aafffffffffffff", "3.3299958654878354e-257"],
+    ["0d00000000000000", "4.5767114681873503e-246"],
+    ["0d00000000000001", "4.576711468187351e-246"],
+    ["0cffffffffffffff", "4.57671146818735e-246"],
+    ["0f50000000000000", "6.290184345309701e-235"],
+    ["0f50000000000001", "6.290184345309702e-235"],
+    ["0f4fffffffffffff", "6.2901843453097e-235"],
+    ["11a0000000000000", "8.645163535653227e-224"],
+    ["11a0000000000001", "8.645163535653229e-224"],
+    ["119fffffffffffff", "8.645163535653226e-224"],
+    ["13f0000000000000", "1.188182228934475e-212"],
+    ["13f0000000000001", "1.1881822289344752e-212"],
+    ["13efffffffffffff", "1.1881822289344748e-212"],
+    ["1640000000000000", "1.6330252207878255e-201"],
+    ["1640000000000001", "1.633025220787826e-201"],
+    ["163fffffffffffff", "1.6330252207878253e-201"],
+    ["1890000000000000", "2.2444127733846047e-190"],
+    ["1890000000000001", "2.244412773384605e-190"],
+    ["188fffffffffffff", "2.2444127733846045e-190"],
+    ["1ae0000000000000", "3.084697427331692e-179"],
+    ["1ae0000000000001", "3.0846974273316924e-179"],
+    ["1adfffffffffffff", "3.0846974273316913e-179"],
+    ["1d30000000000000", "4.239575861902385e-168"],
+    ["1d30000000000001", "4.239575861902386e-168"],
+    ["1d2fffffffffffff", "4.2395758619023843e-168"],
+    ["1f80000000000000", "5.826828696250162e-157"],
+    ["1f80000000000001", "5.826828696250163e-157"],
+    ["1f7fffffffffffff", "5.826828696250161e-157"],
+    ["21d0000000000000", "8.008332380732404e-146"],
+    ["21d0000000000001", "8.008332380732405e-146"],
+    ["21cfffffffffffff", "8.008332380732403e-146"],
+    ["2420000000000000", "1.1006568214637918e-134"],
+    ["2420000000000001", "1.100656821463792e-134"],
+    ["241fffffffffffff", "1.1006568214637917e-134"],
+    ["2670000000000000", "1.512731216738015e-123"],
+    ["2670000000000001", "1.5127312167380153e-123"],
+    ["266fffffffffffff", "1.5127312167380148e-123"],
+    ["28c0000000000000", "2.07908195312898e-112"],
+    ["28c0000000000001", "2.0790819531289803e-112"],
+    ["28bfffffffffffff", "2.0790819531289796e-112"],
+    ["2b10000000000000", "2.8574684782056875e-101"],
+    ["2b10000000000001", "2.857468478205688e-101"],
+    ["2b0fffffffffffff", "2.857468478205687e-101"],
+    ["2d60000000000000", "3.9272747722381812e-90"],
+    ["2d60000000000001", "3.927274772238182e-90"],
+    ["2d5fffffffffffff", "3.927274772238181e-90"],
+    ["2fb0000000000000", "5.397605346934028e-79"],
+    ["2fb0000000000001", "5.397605346934029e-79"],
+    ["2fafffffffffffff", "5.397605346934027e-79"],
+    ["3200000000000000", "7.418412301374843e-68"],
+    ["3200000000000001", "7.418412301374844e-68"],
+    ["31ffffffffffffff", "7.418412301374842e-68"],
+    ["3450000000000000", "1.0195788231247695e-56"],
+    ["3450000000000001", "1.0195788231247697e-56"],
+    ["344fffffffffffff", "1.0195788231247693e-56"],
+    ["36a0000000000000", "1.401298464324817e-45"],
+    ["36a0000000000001", "1.4012984643248174e-45"],
+    ["369fffffffffffff", "1.4012984643248169e-45"],
+    ["38f0000000000000", "1.925929944387236e-34"],
+    ["38f0000000000001", "1.9259299443872363e-34"],
+    ["38efffffffffffff", "1.9259299443872356e-34"],
+    ["3b40000000000000", "2.6469779601696886e-23"],
+    ["3b40000000000001", "2.646977960169689e-23"],
+    ["3b3fffffffffffff", "2.6469779601696883e-23"],
+    ["3d90000000000000", "3.637978807091713e-12"],
+    ["3d90000000000001", "3.637978807091714e-12"],
+    ["3d8fffffffffffff", "3.6379788070917125e-12"],
+    ["3fe0000000000000", "0.5"],
+    ["3fe0000000000001", "0.5000000000000001"],
+    ["3fdfffffffffffff", "0.49999999999999994"],
+    ["4230000000000000", "68719476736"],
+    ["4230000000000001", "68719476736.00002"],
+    ["422fffffffffffff", "68719476735.99999"],
+    ["4480000000000000", "9.44473296573929e+21"],
+    ["4480000000000001", "9.444732965739293e+21"],
+    ["447fffffffffffff", "9.444732965739289e+21"],
+    ["46d0000000000000", "1.298074214633707e+33"],
+    ["46d0000000000001", "1.2980742146337072e+33"],
+    ["46cfffffffffffff", "1.2980742146337068e+33"],
+    ["4920000000000000", "1.78405961588245e+44"],
+    ["4920000000000001", "1.7840596158824502e+44"],
+    ["491fffffffffffff", "1.7840596158824497e+44"],
+    ["4b70000000000000", "2.4519928653854222e+55"],
+    ["4b70000000000001", "2.4519928653854227e+55"],
+    ["4b6fffffffffffff", "2.451992865385422e+55"],
+    ["4dc0000000000000", "3.36999333339383e+66"],
+    ["4dc0000000000001", "3.369993333393831e+66"],
+    ["4dbfffffffffffff", "3.3699933333938296e+66"],
+    ["5010000000000000", "4.631683569492648e+77"],
+    ["5010000000000001", "4.631683569492649e+77"],
+    ["500fffffffffffff", "4.6316835694926473e+77"],
+    ["5260000000000000", "6.365737426045269e+88"],
+    ["5260000000000001", "6.36573742604527e+88"],
+    ["525fffffffffffff", "6.365737426045268e+88"],
+    ["54b0000000000000", "8.749002899132048e+99"],
+    ["54b0000000000001", "8.74900289913205e+99"],
+    ["54afffffffffffff", "8.749002899132047e+99"],
+    ["5700000000000000", "1.2024538023802026e+111"],
+    ["5700000000000001", "1.202453802380203e+111"],
+    ["56ffffffffffffff", "1.2024538023802025e+111"],
+    ["5950000000000000", "1.6526399219756215e+122"],
+    ["5950000000000001", "1.652639921975622e+122"],
+    ["594fffffffffffff", "1.6526399219756213e+122"],
+    ["5ba0000000000000", "2.2713710134237715e+133"],
+    ["5ba0000000000001", "2.271371013423772e+133"],
+    ["5b9fffffffffffff", "2.2713710134237713e+133"],
+    ["5df0000000000000", "3.1217485503159922e+144"],
+    ["5df0000000000001", "3.121748550315993e+144"],
+    ["5defffffffffffff", "3.121748550315992e+144"],
+    ["6040000000000000", "4.290498537581631e+155"],
+    ["6040000000000001", "4.290498537581632e+155"],
+    ["603fffffffffffff", "4.2904985375816306e+155"],
+    ["6290000000000000", "5.896816288783659e+166"],
+    ["6290000000000001", "5.89681628878366e+166"],
+    ["628fffffffffffff", "5.896816288783658e+166"],
+    ["64e0000000000000", "8.10452259547069e+177"],
+    ["64e0000000000001", "8.104522595470691e+177"],
+    ["64dfffffffffffff", "8.1045225954706885e+177"],
+    ["6730000000000000", "1.1138771039116688e+189"],
+    ["6730000000000001", "1.113877103911669e+189"],
+    ["672fffffffffffff", "1.1138771039116686e+189"],
+    ["6980000000000000", "1.5309010345804195e+200"],
+    ["6980000000000001", "1.53090103458042e+200"],
+    ["697fffffffffffff", "1.5309010345804193e+200"],
+    ["6bd0000000000000", "2.1040543606193494e+211"],
+    ["6bd0000000000001", "2.10405436061935e+211"],
+    ["6bcfffffffffffff", "2.1040543606193492e+211"],
+    ["6e20000000000000", "2.891790293717215e+222"],
+    ["6e20000000000001", "2.8917902937172154e+222"],
+    ["6e1fffffffffffff", "2.8917902937172144e+222"],
+    ["7070000000000000", "3.974446316289815e+233"],
+    ["7070000000000001", "3.974446316289816e+233"],
+    ["706fffffffffffff", "3.9744463162898144e+233"],
+    ["72c0000000000000", "5.462437423415177e+244"],
+    ["72c0000000000001", "5.462437423415178e+244"],
+    ["72bfffffffffffff", "5.462437423415176e+244"],
+    ["7510000000000000", "7.5075168288047e+255"],
+    ["7510000000000001", "7.507516828804702e+255"],
+    ["750fffffffffffff", "7.507516828804699e+255"],
+    ["7760000000000000", "1.0318252561243462e+267"],
+    ["7760000000000001", "1.0318252561243464e+267"],
+    ["775fffffffffffff", "1.0318252561243461e+267"],
+    ["79b0000000000000", "1.418129833677085e+278"],
+    ["79b0000000000001", "1.4181298336770853e+278"],
+    ["79afffffffffffff", "1.4181298336770848e+278"],
+    ["7c00000000000000", "1.94906280228e+289"],
+    ["7c00000000000001", "1.9490628022800002e+289"],
+    ["7bffffffffffffff", "1.9490628022799996e+289"],
+    ["7e50000000000000", "2.6787715179656683e+300"],
+    ["7e50000000000001", "2.678771517965669e+300"],
+    ["7e4fffffffffffff", "2.678771517965668e+300"],
+    ["07885aa5155b24a3", "2.250949166316483e-272"],
+    ["c820f4c481b3ac98", "-2.8849349112784514e+39"],
+    ["702a078829a8e24d", "2.0205573849874247e+232"],
+    ["89ca4f1dc5186e29", "-1.6710094656727838e-261"],
+    ["536862a73ab14b11", "6.358254618145329e+93"],
+    ["e9af3df84e0f25f8", "-1.1957129352886148e+201"],
+    ["7cae64a03565ea15", "3.7912320885168665e+292"],
+    ["8cc6cec6f6daad69", "-4.0775144333856304e-247"],
+    ["4d8c4692ee9aa39d", "3.7222207589614215e+65"],
+    ["e7c283c940c4fa94", "-6.599424079819678e+191"],
+    ["2d44bebfeae37c3e", "1.2729964130587458e-90"],
+    ["a9eb2f0ccf4ba921", "-9.2597986208587e-107"],
+    ["778556d6f4b8b651", "5.504585882198115e+267"],
+    ["ac2e0a68c104a7f9", "-7.032032595153672e-96"],
+    ["6a8e0d844ced9b7b", "1.8844820523026246e+205"],
+    ["8fc213faf803d0ac", "-9.097140477661223e-233"],
+    ["40c42547cbe00859", "10314.560909275127"],
+    ["9782e8ac9876b107", "-2.0236654224692012e-195"],
+    ["0488b3accf42219a", "8.111174034661269e-287"],
+    ["e545a0627a60d10e", "-7.010899177344568e+179"],
+    ["686504eed7ecb2d2", "7.671933499659723e+194"],
+    ["f76c93294431f40d", "-1.8427656434338242e+267"],
+    ["2cad43f51cb79314", "1.7537460067513713e-93"],
+    ["b469ebbe28cbc819", "-3.3035463109259295e-56"],
+    ["68c0df5d14539ec0", "3.941367978345428e+196"],
+    ["96ee0da5be1a4600", "-3.140980074070632e-198"],
+    ["2d8d90cd6f0b9eef", "2.9028092791743922e-89"],
+    ["86086004c90c0408", "-1.3428266822591602e-279"],
+    ["7829390ebe1207ca", "6.662555099284244e+270"],
+    ["a38c2f5f6a9411ec", "-1.8934367188643908e-137"],
+    ["7d8552b8af8d5279", "4.3578945063773816e+296"],
+    ["bd8c63980e101787", "-3.2274600612423927e-12"],
+    ["10eecf176a9d78b9", "4.0641543617077634e-227"],
+    ["f4cd75fc94218065", "-4.319884612054221e+254"],
+    ["21833c13862e9d73", "3.0085479284557403e-147"],
+    ["e58a21d395a23163", "-1.3554462511262853e+181"],
+    ["22492c247e701782", "1.6127136088614106e-143"],
+    ["ec8d5182911b695c", "-7.896000550131292e+214"],
+    ["7a227fc48e864009", "2.0987292506852287e+280"],
+    ["966f2a0a16e4203d", "-1.2722987863177267e-200"],
+    ["4e8ae0ccc2e6182d", "2.3188249619276915e+70"],
+    ["bd84a35c961183c3", "-2.3462839071008175e-12"],
+    ["6b4fae174d3d2a79", "8.136783781307963e+208"],
+    ["e62db6404e46597a", "-1.5781128875947042e+184"],
+    ["2842220eec7955ef", "9.204120281394701e-115"],
+    ["9e4e072d09c2c670", "-1.0428916966343879e-162"],
+    ["70813036846cb4dd", "8.539262784359627e+233"],
+    ["cc04a966fe38baba", "-1.6211970928112572e+58"],
+    ["448e4fada016ca18", "1.789259978659181e+22"],
+    ["d3eb20f2c95a1a08", "-1.8108300433665365e+96"],
+    ["4960bfa50e0a6c07", "2.988052280346433e+45"],
+    ["b2cf1582dd888b15", "-5.903209892122547e-64"],
+    ["51a3e1609c710347", "1.931049830220739e+85"],
+    ["bf2e142b48ca553e", "-0.0002294829213453173"],
+    ["4fcf150802b63557", "2.8117714763042103e+76"],
+    ["c78a5c798caa351b", "-4.380010564696808e+36"],
+    ["0b2f33ffc74c4fb7", "8.312501278873814e-255"],
+    ["99eb95aa808aa0a5", "-8.114838233799654e-184"],
+    ["474337aa156a8859", "1.9956529651193044e+35"],
+    ["c840c749c7886db5", "-1.1418834653150761e+40"],
+    ["0debbdeab08698e1", "1.300136954544606e-241"],
+    ["90cbacacce9dde63", "-9.126689167559171e-228"],
+    ["5f611dab66547be1", "2.801350759180243e+151"],
+    ["cc2dc1d5f6fc201e", "-9.339439515565213e+58"],
+    ["2d04f541c63d1e77", "8.03788688362713e-92"],
+    ["db8a5d4e94597ebf", "-9.35679941986563e+132"],
+    ["4a46ac78e4edd114", "6.627535693162283e+49"],
+    ["8720b013b57188c2", "-2.409977922137563e-274"],
+    ["0948d436681da6f9", "6.160163737468625e-264"],
+    ["c48ffb98c6786bae", "-1.8879312793775391e+22"],
+    ["2aa40b2851f2c6c0", "2.7965776089085755e-103"],
+    ["ac6288f5d0eede23", "-6.941990019601768e-95"],
+    ["6e6dcd762dbfb57f", "8.618282462513948e+223"],
+    ["b9072617e768f75d", "-5.572871427605768e-34"],
+    ["49e6581c5e5ef4ae", "1.020501870338893e+48"],
+    ["99a5edaba6036bc3", "-4.0318060096210087e-185"],
+    ["2406a1be740a6c6e", "3.892165410975541e-135"],
+    ["8961a50d87d36745", "-1.751092184253646e-263"],
+    ["0c4de9d81fa8dd03", "2.0890083028771832e-249"],
+    ["850f5fe7b2929a56", "-2.6373799950727498e-284"],
+    ["5acd7dfad922ee2b", "2.5553711416850853e+129"],
+    ["980e4758ce50cb62", "-8.295641893906469e-193"],
+    ["30a0ff7cc6a273bb", "1.8790089351461426e-74"],
+    ["926fadf19ff67c31", "-7.01117908230501e-220"],
+    ["5e6ef5299ba93dc4", "7.731363951116329e+146"],
+    ["be2d9a4c21efc33e", "-3.4462106636196984e-9"],
+    ["688590ba08cd4393", "3.148498465036792e+195"],
+    ["b7410a4c5500e940", "-1.5282204323556382e-42"],
+    ["4d2167d458b13111", "3.5801209537335075e+63"],
+    ["ace6e5587be673b6", "-2.1952738633696816e-92"],
+    ["078dc6be54117b73", "2.7521067282420713e-272"],
+    ["948bff4c053b1455", "-1.0645068589009726e-209"],
+    ["1181762d57d5b86f", "2.358728774947041e-224"],
+    ["fbcd286384fd866b", "-2.2199344559518347e+288"],
+    ["322f7213d1cab885", "5.831913413960399e-67"],
+    ["dd8126e850cf538e", "-2.61446172138529e+142"],
+    ["6d6714f1f0df52ad", "1.0184901972581572e+219"],
+    ["cbc502e89a8692ac", "-1.0303941820366381e+57"],
+    ["52a5ee65005e02f9", "1.396084430774711e+90"],
+    ["c0291dd991dbce10", "-12.55830055053869"],
+    ["6b2ef99cb7b111d2", "1.9889277316280888e+208"],
+    ["a4e879f751070f9c", "-6.896678309158882e-131"],
+    ["2e6e2b260a510ac3", "4.852948262251149e-85"],
+    ["ca2697a78295420e", "-1.6509414613754732e+49"],
+    ["70467be4586e2b59", "6.981348771477626e+232"],
+    ["bdadfebbcd212f46", "-1.364017094612485e-11"],
+    ["71eaff626ccbe549", "5.62563615899587e+240"],
+    ["9c2b62787eff1202", "-5.536046309138997e-173"],
+    ["0b4c97fdadcc1eac", "3.046942442865143e-254"],
+    ["ed28bda0a904dd2e", "-6.823063923807789e+217"],
+    ["66818bbea93a68e5", "5.96434075308154e+185"],
+    ["e0e1e436d2964bad", "-4.912850528958834e+158"],
+    ["678f2ddcc6b9750e", "6.945948267233163e+190"],
+    ["eb00e14212338016", "-2.709675409825318e+207"],
+    ["240f50ce0ed80e6d", "5.385590219079381e-135"],
+    ["eda095071f015a67", "-1.1707048642478383e+220"],
+    ["3de9a861964c4f7b", "1.866846218836377e-10"],
+    ["ebc735eaa23419b7", "-1.526137133938557e+211"],
+    ["014fcff6ec8f0766", "2.3194780951501219e-302"],
+    ["800bebb750c3d521", "-1.6577865392024816e-308"],
+    ["3fdf7dbf487fcb92", "0.49205"],
+    ["3f098dddb32ae379", "0.0000487407"],
+    ["3ecffa35299c4a68", "0.000003812"],
+    ["411deea000000000", "490408"],
+    ["3e932017467379f1", "2.8499e-7"],
+    ["3ea2b9f4e3814121", "5.5809e-7"],
+    ["410ce4a000000000", "236692"],
+    ["3fdbfce3150dae3e", "0.43731"],
+    ["405694ea4a8c154d", "90.3268"],
+    ["3f7e86b0deafa346", "0.00745267"],
+    ["3fee56191148fda0", "0.94801"],
+    ["410c5c5800000000", "232331"],
+    ["3fa486a31cd01a5f", "0.0400897"],
+    ["401d549cf56eac86", "7.33263"],
+    ["409d9851eb851eb8", "1894.08"],
+    ["3f318d281391cf98", "0.000267813"],
+    ["3f0433ad7054eb84", "0.000038532"],
+    ["3f700f8ce5d709e8", "0.00392108"],
+    ["3f4c01da30f4a5c0", "0.000854713"],
+    ["3f45bfa0d080c7a2", "0.000663713"],
+    ["40e194d99999999a", "36006.8"],
+    ["3edc03bc841c8836", "0.0000066792"],
+    ["410e9ef800000000", "250847"],
+    ["3f05b56b53ad738e", "0.000041406"],
+    ["407270189374bc6a", "295.006"],
+    ["3f4cf1b30b2fb3f8", "0.000883305"],
+    ["3ed53898c52ab95e", "0.0000050595"],
+    ["3f64b5cf5a45c6b4", "0.0025281"],
+    ["3f9897f04c2dd5fc", "0.0240171"],
+    ["3f50901b15b01587", "0.00101092"],
+    ["3f31506c4b7a1e4c", "0.000264193"],
+    ["40be2768f5c28f5c", "7719.41"],
+    ["4085626e978d4fdf", "684.304"],
+    ["3f5ab562f8c8a927", "0.00163016"],
+    ["3fe380de4c51116b", "0.609481"],
+    ["4019e0ee8d10f51b", "6.46966"],
+    ["3ee4d5f93c03a0d0", "0.0000099353"],
+    ["3edf1ba478513ec7", "0.00000741672"],
+    ["3f1c944684afe3c4", "0.000109021"],
+    ["3f236fe32ba2b4e5", "0.000148293"]
+];
+
+corpus.forEach(function (entry) {
+    var value = fromBits(parseInt(entry[0].slice(0, 8), 16), parseInt(entry[0].slice(8), 16));
+    check(String(value) === entry[1], entry[0] + ": expected " + entry[1] + ", got " + String(value));
+    check("" + value === entry[1], entry[0] + ": concatenation gave " + ("" + value));
+    check(JSON.stringify([value]) === "[" + entry[1] + "]", entry[0] + ": JSON.stringify gave " + JSON.stringify([value]));
+});
+
+// Every string must round trip and there must be no shorter one that does.
+function significantDigits(string) {
+    return string.replace(/^-/, "").replace(/e.*$/, "").replace(".", "").replace(/^0+/, "").replace(/0+$/, "").length;
+}
+
+var seed = 0x2545F491;
+function nextRandom() {
+    seed ^= seed << 13;
+    seed ^= seed >>> 17;
+    seed ^= seed << 5;
+    return seed >>> 0;
+}
+
+for (var i = 0; i < 20000; i++) {
+    var value = fromBits(nextRandom() & 0x7FEFFFFF, nextRandom());
+    if (value === 0) {
+        continue;
+    }
+    var string = String(value);
+    check(Number(string) === value, toBits(value) + ": " + string + " does not round trip");
+    var digits = significantDigits(string);
+    if (digits > 1) {
+        var shorter = value.toPrecision(digits - 1);
+        check(Number(shorter) !== value, toBits(value) + ": " + string + " is not the shortest, " + shorter + " round trips");
+    }
+}
+
+// Values that share a slot of the conversion cache must not get each other's strings.
+var values = [];
+for (var i = 0; i < 256; i++) {
+    values.push(i + 0.5, i / 7, -i * 1e-10);
+}
+var strings = values.map(String);
+for (var round = 0; round < 3; round++) {
+    values.forEach(function (value, index) {
+        check(String(value) === strings[index], "cached conversion of " + strings[index] + " gave " + String(value));
+    });
+}
+check(strings[3] === "1.5" && strings[4] === "0.14285714285714285" && strings[5] === "-1e-10", "unexpected strings " + strings.slice(3, 6));
+
+if (failures === 0) {
+    WScript.Echo("pass");
+}
@@ -0,0 +1,75 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// Objects built by a constructor that outgrow their initial inline slots, either in the constructor itself or right
+// after it returns, cause the constructor's instances to be allocated with a larger inline slot capacity. Make sure
+// objects created before and after the capacity changes keep the right values and follow the right prototype.
+
+var passed = true;
+
+function check(actual, expected, message)
+{
+    if (actual !== expected)
+    {
+        WScript.Echo("FAILED: " + message + ": expected " + expected + ", actual " + actual);
+        passed = false;
+    }
+}
+
+// All properties are added by the constructor.
+function Wide(i)
+{
+    this.p0 = i + 0;  this.p1 = i + 1;  this.p2 = i + 2;  this.p3 = i + 3;
+    this.p4 = i + 4;  this.p5 = i + 5;  this.p6 = i + 6;  this.p7 = i + 7;
+    this.p8 = i + 8;  this.p9 = i + 9;  this.p10 = i + 10; this.p11 = i + 11;
+}
+Wide.prototype.sum = function ()
+{
+    return this.p0 + this.p1 + this.p2 + this.p3 + this.p4 + this.p5 +
+        this.p6 + this.p7 + this.p8 + this.p9 + this.p10 + this.p11;
+};
+
+// Some properties are added by the caller after the constructor returns.
+function Narrow(i)
+{
+    this.a = i;
+    this.b = i * 2;
+}
+
+var wides = [];
+var narrows = [];
+for (var i = 0; i < 50; i++)
+{
+    wides.push(new Wide(i));
+
+    var n = new Narrow(i);
+    n.c = i * 3; n.d = i * 4; n.e = i * 5; n.f = i * 6;
+    n.g = i * 7; n.h = i * 8; n.j = i * 9; n.k = i * 10;
+    narrows.push(n);
+}
+
+for (var i = 0; i < 50; i++)
+{
+    var w = wides[i];
+    check(w.sum(), 12 * i + 66, "sum of Wide #" + i);
+    check(w.p11, i + 11, "last property of Wide #" + i);
+    check(Object.getPrototypeOf(w), Wide.prototype, "prototype of Wide #" + i);
+    check(Object.keys(w).length, 12, "property count of Wide #" + i);
+
+    var n = narrows[i];
+    check(n.a + n.b + n.c + n.d + n.e + n.f + n.g + n.h + n.j + n.k, 55 * i, "sum of Narrow #" + i);
+    check(Object.keys(n).join(), "a,b,c,d,e,f,g,h,j,k", "property order of Narrow #" + i);
+}
+
+// Changing the prototype after the capacity was grown still has to be honored.
+Wide.prototype = { sum: function () { return -1; } };
+var w = new Wide(1);
+check(w.sum(), -1, "sum after prototype change");
+check(w.p11, 12, "last property after prototype change");
+
+if (passed)
+{
+    WScript.Echo("pass");
+}
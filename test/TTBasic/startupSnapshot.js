@@ -0,0 +1,34 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// Runs in a context inflated from the startup snapshot of startupSnapshotBootstrap.js
+
+var failed = false;
+
+function check(what, actual, expected) {
+    if (actual !== expected) {
+        WScript.Echo("FAILED: " + what + ": " + actual + " != " + expected);
+        failed = true;
+    }
+}
+
+check("config.name", config.name, "startup");
+check("config.total", config.total, 6);
+config.values.push(4);
+check("config.total after push", config.total, 10);
+
+check("counter", counter(), 12);
+check("counter again", counter(), 13);
+
+check("origin", origin instanceof Point, true);
+check("origin.norm1", origin.norm1(), 7);
+check("new Point", new Point(1, 2).norm1(), 3);
+
+check("registry.size", registry.size, 2);
+check("registry.b", registry.get("b"), origin);
+
+if (!failed) {
+    WScript.Echo("pass");
+}
@@ -0,0 +1,29 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// Bootstrap script for the startup snapshot that startupSnapshot.js is run against
+
+var config = { name: "startup", values: [1, 2, 3] };
+
+Object.defineProperty(config, "total", {
+    get: function () { return this.values.reduce(function (a, v) { return a + v; }, 0); }
+});
+
+var counter = (function () {
+    var count = 10;
+    return function () { return ++count; };
+})();
+
+class Point {
+    constructor(x, y) { this.x = x; this.y = y; }
+    norm1() { return Math.abs(this.x) + Math.abs(this.y); }
+}
+
+var origin = new Point(3, -4);
+var registry = new Map([["a", 1], ["b", origin]]);
+
+counter();
+
+WScript.Echo("pass");
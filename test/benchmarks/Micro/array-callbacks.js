@@ -0,0 +1,30 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+var length = 10000;
+var ints = [];
+var doubles = [];
+var objects = [];
+for (var i = 0; i < length; i++) {
+    ints.push(i);
+    doubles.push(i + 0.5);
+    objects.push({ value: i });
+}
+
+var _microStartDate = new Date();
+
+var sum = 0;
+for (var i = 0; i < 100; i++) {
+    ints.forEach(function (v) { sum += v; });
+    sum += doubles.map(function (v) { return v * 2; }).length;
+    sum += objects.filter(function (o) { return o.value & 1; }).length;
+    sum += ints.reduce(function (a, v) { return a + v; }, 0);
+    sum += ints.every(function (v) { return v >= 0; }) ? 1 : 0;
+    sum += doubles.some(function (v) { return v < 0; }) ? 1 : 0;
+}
+
+var _microInterval = new Date() - _microStartDate;
+
+WScript.Echo("### TIME:", _microInterval, "ms");
@@ -0,0 +1,21 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+var _microStartDate = new Date();
+
+var sum = 0;
+for (var i = 0; i < 200; i++) {
+    var a = [];
+    for (var j = 0; j < 50000; j++) {
+        a.push(j);
+    }
+    while (a.length) {
+        sum += a.pop();
+    }
+}
+
+var _microInterval = new Date() - _microStartDate;
+
+WScript.Echo("### TIME:", _microInterval, "ms");
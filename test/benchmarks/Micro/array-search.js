@@ -0,0 +1,39 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+var length = 100000;
+var ints = [];
+var doubles = [];
+var typedInts = new Int32Array(length);
+var typedBytes = new Uint8Array(length);
+var typedDoubles = new Float64Array(length);
+for (var i = 0; i < length; i++) {
+    ints.push(i & 0xFF);
+    doubles.push((i & 0xFF) + 0.5);
+    typedInts[i] = i & 0xFF;
+    typedBytes[i] = i & 0x7F;
+    typedDoubles[i] = (i & 0xFF) + 0.5;
+}
+ints[length - 1] = -1;
+doubles[length - 1] = -1.5;
+typedInts[length - 1] = -1;
+typedBytes[length - 1] = 255;
+typedDoubles[length - 1] = -1.5;
+
+var _microStartDate = new Date();
+
+var sum = 0;
+for (var i = 0; i < 200; i++) {
+    sum += ints.indexOf(-1) + ints.lastIndexOf(1000) + (doubles.includes(NaN) ? 1 : 0) + doubles.indexOf(-1.5);
+    sum += typedInts.indexOf(-1) + typedBytes.indexOf(255) + typedDoubles.lastIndexOf(1000.5) + (typedDoubles.includes(NaN) ? 1 : 0);
+    ints.reverse();
+    typedDoubles.reverse();
+    typedInts.fill(i, 1, length - 1);
+    doubles.copyWithin(1, 2, length - 1);
+}
+
+var _microInterval = new Date() - _microStartDate;
+
+WScript.Echo("### TIME:", _microInterval, "ms");
@@ -0,0 +1,34 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+var length = 100000;
+var presorted = [];
+var reversed = [];
+var random = [];
+var seed = 1;
+for (var i = 0; i < length; i++) {
+    seed = (seed * 1103515245 + 12345) % 2147483648;
+    presorted.push(i);
+    reversed.push(length - i);
+    random.push(seed % length);
+}
+
+function compare(a, b) {
+    return a - b;
+}
+
+var _microStartDate = new Date();
+
+var sum = 0;
+for (var i = 0; i < 10; i++) {
+    sum += presorted.slice().sort(compare)[0];
+    sum += reversed.slice().sort(compare)[0];
+    sum += random.slice().sort(compare)[0];
+    sum += random.slice().sort().length;
+}
+
+var _microInterval = new Date() - _microStartDate;
+
+WScript.Echo("### TIME:", _microInterval, "ms");
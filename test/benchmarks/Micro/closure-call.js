@@ -0,0 +1,24 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+var _microStartDate = new Date();
+
+function makeAdder(n) {
+    return function (x) { return x + n; };
+}
+
+var adders = [];
+for (var i = 0; i < 16; i++) {
+    adders.push(makeAdder(i));
+}
+
+var sum = 0;
+for (var i = 0; i < 5000000; i++) {
+    sum = adders[i & 15](sum) & 0xffffff;
+}
+
+var _microInterval = new Date() - _microStartDate;
+
+WScript.Echo("### TIME:", _microInterval, "ms");
@@ -0,0 +1,40 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+var _microStartDate = new Date();
+
+// more properties than the default inline slot capacity, some added after construction;
+// compare against -off:ConstructorSlackTracking for the memory and access-time difference
+function Record(i) {
+    this.a = i;
+    this.b = i + 1;
+    this.c = i + 2;
+    this.d = i + 3;
+    this.e = i + 4;
+    this.f = i + 5;
+    this.g = i + 6;
+    this.h = i + 7;
+    this.j = i + 8;
+    this.k = i + 9;
+}
+
+var records = [];
+for (var i = 0; i < 200000; i++) {
+    var r = new Record(i);
+    r.extra = i;
+    records.push(r);
+}
+
+var sum = 0;
+for (var n = 0; n < 50; n++) {
+    for (var i = 0; i < records.length; i++) {
+        var r = records[i];
+        sum += r.a + r.h + r.k + r.extra;
+    }
+}
+
+var _microInterval = new Date() - _microStartDate;
+
+WScript.Echo("### TIME:", _microInterval, "ms");
@@ -0,0 +1,19 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+var _microStartDate = new Date();
+
+// short lived small objects with a slowly churning long lived set
+var live = new Array(10000);
+for (var i = 0; i < 2000000; i++) {
+    var o = { index: i, next: null, data: [i, i + 1] };
+    if ((i & 63) === 0) {
+        live[(i >> 6) % live.length] = o;
+    }
+}
+
+var _microInterval = new Date() - _microStartDate;
+
+WScript.Echo("### TIME:", _microInterval, "ms");
@@ -0,0 +1,35 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+var _microStartDate = new Date();
+
+function Point(x, y) {
+    this.x = x;
+    this.y = y;
+}
+
+function Point3(x, y, z) {
+    this.x = x;
+    this.y = y;
+    this.z = z;
+}
+
+// mix two shapes so the loads see a polymorphic site
+var points = [];
+for (var i = 0; i < 1000; i++) {
+    points.push(i & 1 ? new Point(i, i + 1) : new Point3(i, i + 1, i + 2));
+}
+
+var sum = 0;
+for (var n = 0; n < 10000; n++) {
+    for (var i = 0; i < points.length; i++) {
+        var p = points[i];
+        sum += p.x + p.y;
+    }
+}
+
+var _microInterval = new Date() - _microStartDate;
+
+WScript.Echo("### TIME:", _microInterval, "ms");
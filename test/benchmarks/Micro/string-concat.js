@@ -0,0 +1,19 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+var _microStartDate = new Date();
+
+var length = 0;
+for (var i = 0; i < 100; i++) {
+    var s = "";
+    for (var j = 0; j < 20000; j++) {
+        s += "item" + j + ",";
+    }
+    length += s.length + s.charCodeAt(s.length >> 1);
+}
+
+var _microInterval = new Date() - _microStartDate;
+
+WScript.Echo("### TIME:", _microInterval, "ms");
@@ -0,0 +1,29 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+var length = 1000000;
+var doubles = new Float64Array(length);
+var ints = new Int32Array(length);
+var bytes = new Uint8Array(length);
+var seed = 1;
+for (var i = 0; i < length; i++) {
+    seed = (seed * 1103515245 + 12345) % 2147483648;
+    doubles[i] = (seed - 1073741824) / 1024;
+    ints[i] = seed - 1073741824;
+    bytes[i] = seed;
+}
+
+var _microStartDate = new Date();
+
+var sum = 0;
+for (var i = 0; i < 5; i++) {
+    sum += new Float64Array(doubles).sort()[0];
+    sum += new Int32Array(ints).sort()[0];
+    sum += new Uint8Array(bytes).sort()[0];
+}
+
+var _microInterval = new Date() - _microStartDate;
+
+WScript.Echo("### TIME:", _microInterval, "ms");
@@ -0,0 +1,292 @@
+#!/usr/bin/env python
+#-------------------------------------------------------------------------------------------------------
+# Copyright (C) Microsoft. All rights reserved.
+# Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+#-------------------------------------------------------------------------------------------------------
+
+from __future__ import print_function
+from datetime import datetime
+import sys
+import os
+import subprocess as SP
+import argparse
+import json
+import math
+import re
+import time
+
+# handle command line args
+parser = argparse.ArgumentParser(
+    description='ChakraCore benchmark runner',
+    formatter_class=argparse.RawDescriptionHelpFormatter,
+    epilog='''\
+Samples:
+
+record a baseline for all suites:
+    runbenchmarks.py -t --save-baseline base.json
+
+compare a changed build against it:
+    runbenchmarks.py -t --baseline base.json
+
+run a single suite or benchmark:
+    runbenchmarks.py -t Octane
+    runbenchmarks.py -t Octane/richards.js
+''')
+
+parser.add_argument('benchmarks', metavar='benchmark', nargs='*',
+                    help='suites (Octane, Kraken, SunSpider, jetstream, Micro) or suite/file.js, default all')
+parser.add_argument('-b', '--binary', metavar='bin', help='ch full path')
+parser.add_argument('-d', '--debug', action='store_true',
+                    help='use debug build')
+parser.add_argument('-t', '--test', action='store_true', help='use test build')
+parser.add_argument('-r', '--release', action='store_true',
+                    help='use release build')
+parser.add_argument('-n', '--iterations', type=int, default=10,
+                    help='measured runs per benchmark (default 10)')
+parser.add_argument('-w', '--warmup', type=int, default=1,
+                    help='unmeasured runs per benchmark before measuring (default 1)')
+parser.add_argument('--cpu', type=int, default=None,
+                    help='pin ch to the given cpu')
+parser.add_argument('--flags', default='',
+                    help='extra flags passed to ch, e.g. "-nonative"')
+parser.add_argument('--baseline', metavar='file',
+                    help='compare against a baseline saved with --save-baseline')
+parser.add_argument('--save-baseline', metavar='file',
+                    help='save the results as a baseline')
+parser.add_argument('--threshold', type=float, default=3.0,
+                    help='regression threshold in percent (default 3)')
+parser.add_argument('--memory-threshold', type=float, default=10.0,
+                    help='peak memory regression threshold in percent (default 10)')
+parser.add_argument('--timeout', type=int, default=600,
+                    help='warn when a single run takes longer (default 600 seconds)')
+args = parser.parse_args()
+
+
+test_root = os.path.dirname(os.path.realpath(__file__))
+repo_root = os.path.dirname(test_root)
+bench_root = os.path.join(test_root, 'benchmarks')
+suites = ['Octane', 'Kraken', 'SunSpider', 'jetstream', 'Micro']
+
+# flavor: debug, test, release
+flavor = 'Debug' if args.debug else ('Test' if args.test else \
+            ('Release' if args.release else None))
+if flavor == None and args.binary == None:
+    print("ERROR: Test build target wasn't defined.")
+    print("Try '-r' (release build), '-t' (test build) or '-d' (debug build).")
+    sys.exit(1)
+
+# binary: full ch path
+binary = args.binary
+if binary == None:
+    if sys.platform == 'win32':
+        binary = 'Build/VcBuild/bin/x64_{}/ch.exe'.format(flavor)
+    else:
+        binary = 'BuildLinux/{0}/ch'.format(flavor)
+    binary = os.path.join(repo_root, binary)
+if not os.path.isfile(binary):
+    print('{} not found. Did you run ./build.sh already?'.format(binary))
+    sys.exit(1)
+
+# two sided 95% t-distribution critical values by degrees of freedom
+_t95 = [0, 12.706, 4.303, 3.182, 2.776, 2.571, 2.447, 2.365, 2.306, 2.262,
+        2.228, 2.201, 2.179, 2.160, 2.145, 2.131, 2.120, 2.110, 2.101, 2.093,
+        2.086, 2.080, 2.074, 2.069, 2.064, 2.060, 2.056, 2.052, 2.048, 2.045,
+        2.042]
+def t95(df):
+    return _t95[df] if df < len(_t95) else 1.96
+
+# mean and 95% confidence interval half width of a sample list
+class Stats(object):
+    def __init__(self, samples):
+        self.samples = samples
+        self.count = len(samples)
+        self.mean = sum(samples) / float(self.count) if self.count else 0.0
+        if self.count > 1:
+            variance = sum((x - self.mean) ** 2 for x in samples) \
+                        / (self.count - 1)
+            self.stdev = math.sqrt(variance)
+            self.ci = t95(self.count - 1) * self.stdev / math.sqrt(self.count)
+        else:
+            self.stdev = 0.0
+            self.ci = 0.0
+
+    def __str__(self):
+        pct = 100.0 * self.ci / self.mean if self.mean else 0.0
+        return '{:10.2f} +-{:5.2f}%'.format(self.mean, pct)
+
+# The benchmark files report one of
+#   ### SCORE: <score>          (Octane, jetstream: higher is better)
+#   ### TIME: <time> ms         (Kraken, SunSpider, Micro: lower is better)
+# and ch adds these with -PrintRuntimeStats
+#   ### PEAKMEMORY: <bytes> bytes
+#   ### FINALMEMORY: <bytes> bytes
+#   ### GCCOUNT: <count>
+#   ### GCTIME: <microseconds> us
+#   ### GCMAXTIME: <microseconds> us
+#   ### GCPAUSETIME: <microseconds> us
+#   ### GCMAXPAUSE: <microseconds> us
+_result_re = re.compile(br'^### (SCORE|TIME|PEAKMEMORY|FINALMEMORY|GCCOUNT|GCTIME|GCMAXTIME|GCPAUSETIME|GCMAXPAUSE):\s*([0-9.eE+-]+)', re.M)
+
+def parse_output(output):
+    values = {}
+    for key, value in _result_re.findall(output):
+        values[key.decode().lower()] = float(value)
+    return values
+
+def pin_cpu():
+    if args.cpu is not None and hasattr(os, 'sched_setaffinity'):
+        os.sched_setaffinity(0, [args.cpu])
+
+# run ch once on the given benchmark file, return parsed values
+# (plus the peak RSS of the process where the OS reports it)
+def run_once(js_file):
+    cmd = [binary, '-PrintRuntimeStats'] + args.flags.split() + \
+            [os.path.basename(js_file)]
+    proc = SP.Popen(cmd, stdout=SP.PIPE, stderr=SP.STDOUT,
+                    cwd=os.path.dirname(js_file),
+                    preexec_fn=pin_cpu if args.cpu is not None else None)
+    start = time.time()
+    output = proc.stdout.read()
+    proc.stdout.close()
+    peak_rss = None
+    if hasattr(os, 'wait4'):
+        # reap the child ourselves so its rusage is available
+        _, status, usage = os.wait4(proc.pid, 0)
+        proc.returncode = status >> 8 if os.WIFEXITED(status) else -1
+        peak_rss = usage.ru_maxrss * 1024    # KB on Linux
+    exit_code = proc.wait()
+    if time.time() - start > args.timeout:
+        print('WARNING: {} took longer than {} seconds'.format(
+            js_file, args.timeout))
+    values = parse_output(output)
+    if exit_code != 0 or not ('score' in values or 'time' in values):
+        raise RuntimeError('{}\n{}'.format(' '.join(cmd),
+                                            output.decode(errors='replace')))
+    if peak_rss is not None:
+        values['peakrss'] = float(peak_rss)
+    return values
+
+# run one benchmark: warmup, then measured iterations
+def run_benchmark(js_file):
+    for i in range(args.warmup):
+        run_once(js_file)
+    runs = [run_once(js_file) for i in range(args.iterations)]
+    metric = 'score' if 'score' in runs[0] else 'time'
+    result = { 'metric': metric }
+    for key in ('score', 'time', 'peakmemory', 'finalmemory', 'gccount',
+                'gctime', 'gcmaxtime', 'gcpausetime', 'gcmaxpause', 'peakrss'):
+        if all(key in r for r in runs):
+            result[key] = [r[key] for r in runs]
+    return result
+
+def list_benchmarks():
+    names = args.benchmarks or suites
+    benchmarks = []
+    for name in names:
+        path = os.path.join(bench_root, name)
+        if os.path.isfile(path):
+            benchmarks.append(os.path.relpath(path, bench_root))
+        elif os.path.isdir(path):
+            benchmarks += [os.path.join(name, f) for f in sorted(os.listdir(path))
+                            if f.endswith('.js')]
+        else:
+            print('WARNING: {} not found'.format(path))
+    return benchmarks
+
+# percent change where positive is always worse
+def regression_pct(metric, base, new):
+    if base.mean == 0:
+        return 0.0
+    change = 100.0 * (new.mean - base.mean) / base.mean
+    return -change if metric == 'score' else change
+
+# a change only counts when it is over the threshold and the
+# confidence intervals of the two runs don't overlap
+def is_significant(base, new):
+    return abs(new.mean - base.mean) > base.ci + new.ci
+
+def compare(name, result, baseline):
+    base = baseline.get(name)
+    metric = result['metric']
+    new = Stats(result[metric])
+    line = '{:45} {:5} {}'.format(name, metric, new)
+    failed = False
+
+    if 'peakmemory' in result:
+        line += ' {:8.1f}MB'.format(Stats(result['peakmemory']).mean / 1048576.0)
+    if 'gccount' in result:
+        line += ' {:6.1f} gc'.format(Stats(result['gccount']).mean)
+    if 'gctime' in result:
+        line += ' {:8.1f}ms gc'.format(Stats(result['gctime']).mean / 1000.0)
+    if 'gcpausetime' in result:
+        line += ' {:8.1f}ms paused'.format(Stats(result['gcpausetime']).mean / 1000.0)
+    if 'gcmaxpause' in result:
+        line += ' {:7.2f}ms max pause'.format(Stats(result['gcmaxpause']).mean / 1000.0)
+
+    if base is not None and metric in base:
+        old = Stats(base[metric])
+        pct = regression_pct(metric, old, new)
+        verdict = ''
+        if pct > args.threshold and is_significant(old, new):
+            verdict = ' REGRESSION'
+            failed = True
+        elif pct < -args.threshold and is_significant(old, new):
+            verdict = ' improvement'
+        line += '  vs {} {:+6.2f}%{}'.format(old, -pct, verdict)
+
+        if 'peakmemory' in result and 'peakmemory' in base:
+            old_mem = Stats(base['peakmemory'])
+            new_mem = Stats(result['peakmemory'])
+            mem_pct = regression_pct('time', old_mem, new_mem)
+            if mem_pct > args.memory_threshold and is_significant(old_mem, new_mem):
+                line += ' MEMORY REGRESSION {:+.1f}%'.format(mem_pct)
+                failed = True
+
+    print(line)
+    return failed
+
+def main():
+    baseline = {}
+    if args.baseline:
+        with open(args.baseline) as f:
+            baseline = json.load(f)['results']
+
+    benchmarks = list_benchmarks()
+    print('{} {} ({} warmup, {} measured runs{})'.format(
+        binary, args.flags, args.warmup, args.iterations,
+        ', cpu {}'.format(args.cpu) if args.cpu is not None else ''))
+    print()
+
+    start_time = datetime.now()
+    results = {}
+    failed = []
+    errors = []
+    for name in benchmarks:
+        try:
+            results[name] = run_benchmark(os.path.join(bench_root, name))
+        except Exception as e:
+            print('{:45} ERROR'.format(name))
+            print(str(e))
+            errors.append(name)
+            continue
+        if compare(name, results[name], baseline):
+            failed.append(name)
+    elapsed_time = datetime.now() - start_time
+
+    if args.save_baseline:
+        with open(args.save_baseline, 'w') as f:
+            json.dump({ 'binary': binary, 'flags': args.flags,
+                        'results': results }, f, indent=1, sort_keys=True)
+        print('\nbaseline saved to {}'.format(args.save_baseline))
+
+    print()
+    for name in failed:
+        print('regressed: {}'.format(name))
+    for name in errors:
+        print('error: {}'.format(name))
+    ok = not failed and not errors
+    print('[{}] {}'.format(str(elapsed_time), 'Success!' if ok else 'Failed!'))
+    return 0 if ok else 1
+
+if __name__ == '__main__':
+    sys.exit(main())
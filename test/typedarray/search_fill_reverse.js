@@ -0,0 +1,210 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// indexOf, lastIndexOf, includes, fill, copyWithin and reverse work on whole blocks of the buffer; check them
+// against element by element versions for every element type, at lengths and offsets around the block size.
+
+var failed = false;
+
+function fail(message) {
+    WScript.Echo("FAILED: " + message);
+    failed = true;
+}
+
+var seed = 1;
+function random(limit) {
+    seed = (seed * 1103515245 + 12345) % 2147483648;
+    return seed % limit;
+}
+
+function sameValueZero(a, b) {
+    return a === b || (a !== a && b !== b);
+}
+
+function sameValue(a, b) {
+    return a === b ? (a !== 0 || 1 / a === 1 / b) : (a !== a && b !== b);
+}
+
+function referenceIndexOf(array, value, from) {
+    for (var i = from; i < array.length; i++) {
+        if (array[i] === value) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+function referenceLastIndexOf(array, value, from) {
+    for (var i = Math.min(from, array.length - 1); i >= 0; i--) {
+        if (array[i] === value) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+function referenceIncludes(array, value, from) {
+    for (var i = from; i < array.length; i++) {
+        if (sameValueZero(array[i], value)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+function checkSameElements(name, actual, expected) {
+    if (actual.length !== expected.length) {
+        fail(name + ": length " + actual.length + " != " + expected.length);
+        return;
+    }
+    for (var i = 0; i < expected.length; i++) {
+        if (!sameValue(actual[i], expected[i])) {
+            fail(name + ": index " + i + ": " + actual[i] + " != " + expected[i]);
+            return;
+        }
+    }
+}
+
+var types = [
+    { ctor: Int8Array, values: [0, 1, -1, 127, -128, 5] },
+    { ctor: Uint8Array, values: [0, 1, 255, 128, 5] },
+    { ctor: Uint8ClampedArray, values: [0, 1, 255, 128, 5] },
+    { ctor: Int16Array, values: [0, 1, -1, 32767, -32768, 5] },
+    { ctor: Uint16Array, values: [0, 1, 65535, 32768, 5] },
+    { ctor: Int32Array, values: [0, 1, -1, 2147483647, -2147483648, 5] },
+    { ctor: Uint32Array, values: [0, 1, 4294967295, 2147483648, 5] },
+    { ctor: Float32Array, values: [0, -0, 1, 1.5, NaN, Infinity, -Infinity, Math.fround(0.1), 3.4028234663852886e38] },
+    { ctor: Float64Array, values: [0, -0, 1, 1.5, NaN, Infinity, -Infinity, 0.1, 1.7976931348623157e308] }
+];
+
+// Values that are near the elements but are not all representable in every type
+var searches = [0, -0, 1, -1, 5, 1.5, 0.1, NaN, Infinity, -Infinity, 127, 128, 255, 256, -129, 65535, 65536,
+    2147483648, -2147483649, 4294967295, 4294967296, Math.fround(0.1), 3.4028234663852886e38, "1", undefined, null, {}];
+
+var lengths = [0, 1, 3, 7, 8, 15, 16, 17, 31, 33, 64, 100];
+
+types.forEach(function (type) {
+    var name = type.ctor.name;
+    lengths.forEach(function (length) {
+        // A view at an element offset into the buffer, so blocks don't line up with the start of the buffer
+        var buffer = new ArrayBuffer((length + 2) * type.ctor.BYTES_PER_ELEMENT);
+        var array = new type.ctor(buffer, type.ctor.BYTES_PER_ELEMENT, length);
+        for (var i = 0; i < length; i++) {
+            array[i] = type.values[random(type.values.length)];
+        }
+        var plain = Array.prototype.slice.call(array);
+
+        searches.forEach(function (search) {
+            [0, 1, length >> 1, length - 1].forEach(function (from) {
+                if (from < 0) {
+                    return;
+                }
+                var what = name + " " + length + " " + String(search) + " from " + from;
+                if (array.indexOf(search, from) !== referenceIndexOf(plain, search, from)) {
+                    fail("indexOf " + what + ": " + array.indexOf(search, from));
+                }
+                if (array.lastIndexOf(search, from) !== referenceLastIndexOf(plain, search, from)) {
+                    fail("lastIndexOf " + what + ": " + array.lastIndexOf(search, from));
+                }
+                if (array.includes(search, from) !== referenceIncludes(plain, search, from)) {
+                    fail("includes " + what + ": " + array.includes(search, from));
+                }
+            });
+            if (array.lastIndexOf(search) !== referenceLastIndexOf(plain, search, length - 1)) {
+                fail("lastIndexOf " + name + " " + length + " " + String(search));
+            }
+        });
+
+        // The elements around the view are never touched
+        var outside = new Uint8Array(buffer);
+        function checkOutside(what) {
+            for (var i = 0; i < type.ctor.BYTES_PER_ELEMENT; i++) {
+                if (outside[i] !== 0 || outside[outside.length - 1 - i] !== 0) {
+                    fail(what + " " + name + " " + length + ": wrote outside of the view");
+                    return;
+                }
+            }
+        }
+
+        var expected = plain.slice().reverse();
+        if (array.reverse() !== array) {
+            fail("reverse " + name + ": result");
+        }
+        checkSameElements("reverse " + name + " " + length, array, expected);
+        checkOutside("reverse");
+
+        for (var trial = 0; trial < 4; trial++) {
+            var target = random(length + 1);
+            var start = random(length + 1);
+            var end = random(length + 1);
+            var before = Array.prototype.slice.call(array);
+            var copied = Array.prototype.slice.call(array);
+            var count = Math.min(end - start, length - target);
+            var source = before.slice(start, start + Math.max(count, 0));
+            for (var i = 0; i < source.length; i++) {
+                copied[target + i] = source[i];
+            }
+            array.copyWithin(target, start, end);
+            checkSameElements("copyWithin " + name + " " + length + " " + [target, start, end], array, copied);
+            checkOutside("copyWithin");
+
+            var value = type.values[random(type.values.length)];
+            var filled = Array.prototype.slice.call(array);
+            for (var i = start; i < end; i++) {
+                filled[i] = value;
+            }
+            array.fill(value, start, end);
+            checkSameElements("fill " + name + " " + length + " " + [value, start, end], array, Array.prototype.slice.call(new type.ctor(filled)));
+            checkOutside("fill");
+        }
+    });
+});
+
+// fill converts the value the same way a store does
+function checkFill(ctor, value, expected) {
+    var array = new ctor(40);
+    array.fill(value, 1, 39);
+    if (!sameValue(array[0], 0) || !sameValue(array[39], 0)) {
+        fail("fill " + ctor.name + " " + value + ": outside of the range");
+    }
+    for (var i = 1; i < 39; i++) {
+        if (!sameValue(array[i], expected)) {
+            fail("fill " + ctor.name + " " + value + ": " + array[i] + " != " + expected);
+            return;
+        }
+    }
+}
+checkFill(Int8Array, 200, -56);
+checkFill(Int8Array, -1.9, -1);
+checkFill(Uint8Array, -1, 255);
+checkFill(Uint8ClampedArray, 300, 255);
+checkFill(Uint8ClampedArray, -5, 0);
+checkFill(Uint8ClampedArray, 2.5, 2);
+checkFill(Uint8ClampedArray, 3.5, 4);
+checkFill(Int16Array, 65536 + 7, 7);
+checkFill(Uint32Array, -1, 4294967295);
+checkFill(Int32Array, NaN, 0);
+checkFill(Float32Array, 0.1, Math.fround(0.1));
+checkFill(Float32Array, -0, -0);
+checkFill(Float64Array, NaN, NaN);
+checkFill(Float64Array, -0, -0);
+checkFill(Float64Array, "2.5", 2.5);
+checkFill(Int32Array, { valueOf: function () { return 9; } }, 9);
+
+// The Array.prototype versions share the implementation
+var generic = new Int32Array([1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20]);
+Array.prototype.reverse.call(generic);
+checkSameElements("Array reverse", generic, [20, 19, 18, 17, 16, 15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1]);
+Array.prototype.fill.call(generic, 0, 5, 15);
+checkSameElements("Array fill", generic, [20, 19, 18, 17, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 4, 3, 2, 1]);
+Array.prototype.copyWithin.call(generic, 0, 12);
+checkSameElements("Array copyWithin", generic, [0, 0, 0, 5, 4, 3, 2, 1, 0, 0, 0, 0, 0, 0, 0, 5, 4, 3, 2, 1]);
+if (Array.prototype.indexOf.call(generic, 5) !== 3 || Array.prototype.lastIndexOf.call(generic, 5) !== 15 || !Array.prototype.includes.call(generic, 1)) {
+    fail("Array search");
+}
+
+if (!failed) {
+    WScript.Echo("pass");
+}
@@ -0,0 +1,108 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+var failed = false;
+
+function fail(message) {
+    WScript.Echo("FAILED: " + message);
+    failed = true;
+}
+
+var seed = 1;
+function random(limit) {
+    seed = (seed * 1103515245 + 12345) % 2147483648;
+    return seed % limit;
+}
+
+// The default order: numeric, -0 before +0, NaN last
+function defaultOrder(a, b) {
+    if (a !== a) {
+        return b !== b ? 0 : 1;
+    }
+    if (b !== b) {
+        return -1;
+    }
+    if (a < b) {
+        return -1;
+    }
+    if (a > b) {
+        return 1;
+    }
+    if (a === 0 && b === 0) {
+        var aNegative = 1 / a < 0;
+        var bNegative = 1 / b < 0;
+        return aNegative === bNegative ? 0 : (aNegative ? -1 : 1);
+    }
+    return 0;
+}
+
+function same(a, b) {
+    return a !== a ? b !== b : (a === b && (a !== 0 || 1 / a === 1 / b));
+}
+
+var floatValues = [NaN, -0, 0, Infinity, -Infinity, 1.5, -1.5, 5e-324, -5e-324, 1.7976931348623157e308, -1.7976931348623157e308];
+
+function check(name, array) {
+    var expected = Array.prototype.slice.call(array).sort(defaultOrder);
+    var result = array.sort();
+    if (result !== array) {
+        fail(name + ": sort should return the array");
+    }
+    for (var i = 0; i < expected.length; i++) {
+        if (!same(array[i], expected[i])) {
+            fail(name + ": index " + i + ": " + array[i] + " != " + expected[i]);
+            return;
+        }
+    }
+}
+
+var types = [Int8Array, Uint8Array, Uint8ClampedArray, Int16Array, Uint16Array, Int32Array, Uint32Array, Float32Array, Float64Array];
+var lengths = [0, 1, 2, 10, 63, 64, 65, 1000, 20000];
+
+types.forEach(function (type) {
+    var isFloat = type === Float32Array || type === Float64Array;
+    lengths.forEach(function (length) {
+        var randomArray = new type(length);
+        var duplicates = new type(length);
+        var descending = new type(length);
+        for (var i = 0; i < length; i++) {
+            var value = random(4294967296) - 2147483648;
+            if (isFloat) {
+                value = i % 7 == 0 ? floatValues[random(floatValues.length)] : value / (1 + random(1000));
+            }
+            randomArray[i] = value;
+            duplicates[i] = random(3) - 1;
+            descending[i] = length - i;
+        }
+        check(type.name + " random " + length, randomArray);
+        check(type.name + " duplicates " + length, duplicates);
+        check(type.name + " descending " + length, descending);
+    });
+});
+
+// Zeros and NaNs of either sign
+var zeros = new Float64Array([0, -0, NaN, 0, -0, -NaN, -1, 1]);
+check("zeros", zeros);
+if (1 / zeros[2] !== -Infinity || 1 / zeros[3] !== Infinity || zeros[6] === zeros[6] || zeros[7] === zeros[7]) {
+    fail("zeros: -0 should sort before +0 and NaN last");
+}
+
+// Sorting a view sorts only the viewed elements
+var buffer = new ArrayBuffer(88 * 4);
+var whole = new Int32Array(buffer);
+for (var i = 0; i < whole.length; i++) {
+    whole[i] = whole.length - i;
+}
+new Int32Array(buffer, 8 * 4, 80).sort();
+for (var i = 0; i < 8; i++) {
+    if (whole[i] !== whole.length - i) {
+        fail("view: element " + i + " outside the view changed");
+    }
+}
+check("view", new Int32Array(buffer, 8 * 4, 80));
+
+if (!failed) {
+    WScript.Echo("pass");
+}